@@ -5,7 +5,7 @@ public class ModioUICore : ModuleRules
 {
 	public ModioUICore(ReadOnlyTargetRules Target) : base(Target)
 	{
-		PrivateDependencyModuleNames.AddRange(new string[] { "OnlineSubsystem" });
+		PrivateDependencyModuleNames.AddRange(new string[] { "OnlineSubsystem", "ImageWrapper", "Json", "JsonUtilities" });
 		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
 
 		if (Target.Version.MajorVersion < 5 || (Target.Version.MajorVersion == 5 && Target.Version.MinorVersion <= 4))
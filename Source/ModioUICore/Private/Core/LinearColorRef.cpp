@@ -10,6 +10,7 @@
 
 #include "Core/LinearColorRef.h"
 #include "Core/ModioAssetPaths.h"
+#include "Core/ModioUIAssetLoading.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(LinearColorRef)
 
@@ -19,7 +20,7 @@ FLinearColor ULinearColorRefLibrary::Resolve(const FLinearColorRef& Target, bool
 {
 	bResolved = false;
 	FSoftObjectPath DefaultColorTablePath = ModioUI::AssetPaths::GetUiColorsTablePath();
-	UDataTable* DefaultColorTable = Cast<UDataTable>(DefaultColorTablePath.TryLoad());
+	UDataTable* DefaultColorTable = Cast<UDataTable>(ModioUI::LoadUIAsset(DefaultColorTablePath));
 	if (DefaultColorTable)
 	{
 		const UScriptStruct* ColorTableStruct = DefaultColorTable->GetRowStruct();
@@ -68,7 +69,7 @@ TArray<FName> ULinearColorRefLibrary::GetValidColorKeys()
 {
 	TArray<FName> ColorKeys;
 	FSoftObjectPath DefaultColorTablePath = ModioUI::AssetPaths::GetUiColorsTablePath();
-	UDataTable* DefaultColorTable = Cast<UDataTable>(DefaultColorTablePath.TryLoad());
+	UDataTable* DefaultColorTable = Cast<UDataTable>(ModioUI::LoadUIAsset(DefaultColorTablePath));
 	if (DefaultColorTable)
 	{
 		ColorKeys = DefaultColorTable->GetRowNames();
@@ -84,7 +85,7 @@ void ULinearColorRefLibrary::AddColorChangeHandler(const FLinearColorRefColorCha
 	{
 		FSoftObjectPath DefaultColorTablePath =
 			FSoftObjectPath("/ModioComponentUI/UI/Data/DT_UIColors.DT_UIColors");
-		UDataTable* DefaultColorTable = Cast<UDataTable>(DefaultColorTablePath.TryLoad());
+		UDataTable* DefaultColorTable = Cast<UDataTable>(ModioUI::LoadUIAsset(DefaultColorTablePath));
 		if (DefaultColorTable)
 		{
 			DefaultColorTable->OnDataTableChanged().AddLambda(
@@ -0,0 +1,179 @@
+/*
+ *  Copyright (C) 2025 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io UE Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue/blob/main/LICENSE>)
+ *
+ */
+
+#include "Core/ModioModListItemIndex.h"
+
+#include "UI/Interfaces/IModioModInfoUIDetails.h"
+
+namespace ModioModListItemIndex
+{
+	bool HasModID(UObject* Item, FModioModID ModID)
+	{
+		return Item && Item->Implements<UModioModInfoUIDetails>() &&
+		       IModioModInfoUIDetails::Execute_GetModID(Item) == ModID;
+	}
+} // namespace ModioModListItemIndex
+
+void FModioModListItemIndex::Rebuild(const TArray<UObject*>& Items)
+{
+	Reset();
+	Append(Items, 0);
+}
+
+void FModioModListItemIndex::Append(const TArray<UObject*>& Items, int32 FirstNewIndex)
+{
+	if (bOutOfDate || FirstNewIndex != NumIndexedItems)
+	{
+		Rebuild(Items);
+		return;
+	}
+
+	ItemToIndex.Reserve(Items.Num());
+	ModIDToIndex.Reserve(Items.Num());
+	for (int32 Index = FirstNewIndex; Index < Items.Num(); ++Index)
+	{
+		IndexItem(Items[Index], Index);
+	}
+	NumIndexedItems = Items.Num();
+}
+
+void FModioModListItemIndex::NotifyItemsChanged(const TArray<UObject*>& Items, const TArray<UObject*>& AddedItems,
+												const TArray<UObject*>& RemovedItems)
+{
+	if (Items.Num() == 0)
+	{
+		Reset();
+		return;
+	}
+	if (bOutOfDate)
+	{
+		return;
+	}
+
+	// Items added to the end, as UListView::AddItem does, keep every existing position
+	if (RemovedItems.Num() == 0 && Items.Num() == NumIndexedItems + AddedItems.Num())
+	{
+		bool bAddedToEnd = true;
+		for (int32 AddedIndex = 0; AddedIndex < AddedItems.Num() && bAddedToEnd; ++AddedIndex)
+		{
+			bAddedToEnd = Items[NumIndexedItems + AddedIndex] == AddedItems[AddedIndex];
+		}
+		if (bAddedToEnd)
+		{
+			Append(Items, NumIndexedItems);
+			return;
+		}
+	}
+
+	// So do items removed from the end
+	if (AddedItems.Num() == 0 && RemoveTailItems(Items, RemovedItems))
+	{
+		return;
+	}
+
+	// Anything else, such as a removal from the middle or a reorder, moves items around
+	Invalidate();
+}
+
+void FModioModListItemIndex::Invalidate()
+{
+	bOutOfDate = true;
+}
+
+void FModioModListItemIndex::Reset()
+{
+	ItemToIndex.Reset();
+	ModIDToIndex.Reset();
+	NumIndexedItems = 0;
+	bOutOfDate = false;
+}
+
+int32 FModioModListItemIndex::FindItem(const UObject* Item, const TArray<UObject*>& Items)
+{
+	RebuildIfOutOfDate(Items);
+
+	const int32* Index = ItemToIndex.Find(Item);
+	if (Index && !(Items.IsValidIndex(*Index) && Items[*Index] == Item))
+	{
+		Rebuild(Items);
+		Index = ItemToIndex.Find(Item);
+	}
+	return Index ? *Index : INDEX_NONE;
+}
+
+int32 FModioModListItemIndex::FindModID(FModioModID ModID, const TArray<UObject*>& Items)
+{
+	RebuildIfOutOfDate(Items);
+
+	const int32* Index = ModIDToIndex.Find(ModID);
+	if (Index && !(Items.IsValidIndex(*Index) && ModioModListItemIndex::HasModID(Items[*Index], ModID)))
+	{
+		Rebuild(Items);
+		Index = ModIDToIndex.Find(ModID);
+	}
+	return Index ? *Index : INDEX_NONE;
+}
+
+void FModioModListItemIndex::IndexItem(UObject* Item, int32 Index)
+{
+	if (!Item)
+	{
+		return;
+	}
+
+	// FindOrAdd keeps the existing value, so duplicates resolve to their first occurrence like a linear search would
+	ItemToIndex.FindOrAdd(Item, Index);
+	if (Item->Implements<UModioModInfoUIDetails>())
+	{
+		ModIDToIndex.FindOrAdd(IModioModInfoUIDetails::Execute_GetModID(Item), Index);
+	}
+}
+
+bool FModioModListItemIndex::RemoveTailItems(const TArray<UObject*>& Items, const TArray<UObject*>& RemovedItems)
+{
+	if (Items.Num() != NumIndexedItems - RemovedItems.Num())
+	{
+		return false;
+	}
+
+	// Items are indexed by their first occurrence, so an item indexed past the new end had no earlier occurrence
+	for (const UObject* RemovedItem : RemovedItems)
+	{
+		const int32* Index = ItemToIndex.Find(RemovedItem);
+		if (!Index || *Index < Items.Num())
+		{
+			return false;
+		}
+	}
+
+	for (UObject* RemovedItem : RemovedItems)
+	{
+		ItemToIndex.Remove(RemovedItem);
+		if (RemovedItem && RemovedItem->Implements<UModioModInfoUIDetails>())
+		{
+			const FModioModID ModID = IModioModInfoUIDetails::Execute_GetModID(RemovedItem);
+			const int32* ModIndex = ModIDToIndex.Find(ModID);
+			if (ModIndex && *ModIndex >= Items.Num())
+			{
+				ModIDToIndex.Remove(ModID);
+			}
+		}
+	}
+	NumIndexedItems = Items.Num();
+	return true;
+}
+
+void FModioModListItemIndex::RebuildIfOutOfDate(const TArray<UObject*>& Items)
+{
+	if (bOutOfDate || Items.Num() != NumIndexedItems)
+	{
+		Rebuild(Items);
+	}
+}
@@ -10,6 +10,8 @@
 
 #include "Core/ModioPropertyOverrides.h"
 
+#include "Core/ModioUIAssetLoading.h"
+
 #include UE_INLINE_GENERATED_CPP_BY_NAME(ModioPropertyOverrides)
 
 int32 UPropertyOverridesLibrary::ResolveIntOverride(const FIntegerOverride& Target, bool& bOverrideSet)
@@ -132,7 +134,7 @@ FSoftClassPath UPropertyOverridesLibrary::ApplyClassPathOverride(const FClassPat
 UClass* UPropertyOverridesLibrary::ResolveClassPathOverride_Casted(const FClassPathOverride& Target,
 																   TSubclassOf<UObject> BaseClass, bool& bOverrideSet)
 {
-	UClass* LoadedClass = ResolveClassPathOverride(Target, bOverrideSet).TryLoadClass<UObject>();
+	UClass* LoadedClass = ModioUI::LoadUIClass(ResolveClassPathOverride(Target, bOverrideSet));
 	if (LoadedClass && LoadedClass->IsChildOf(BaseClass.Get()))
 	{
 		return LoadedClass;
@@ -154,7 +156,7 @@ UClass* UPropertyOverridesLibrary::ApplyClassPathOverride_Casted(const FClassPat
 																 TSubclassOf<UObject> BaseClass, UClass* DefaultValue)
 {
 	bool bOverrideSet = false;
-	UClass* LoadedClass = ResolveClassPathOverride(Target, bOverrideSet).TryLoadClass<UObject>();
+	UClass* LoadedClass = ModioUI::LoadUIClass(ResolveClassPathOverride(Target, bOverrideSet));
 	if (bOverrideSet && LoadedClass && LoadedClass->IsChildOf(BaseClass.Get()))
 	{
 		return LoadedClass;
@@ -0,0 +1,148 @@
+/*
+ *  Copyright (C) 2025 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io UE Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue/blob/main/LICENSE>)
+ *
+ */
+
+#include "Core/ModioTagOptionsUI.h"
+
+#include "ModioUICore.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(ModioTagOptionsUI)
+
+void UModioModTagUI::SetSelectionState_Implementation(bool bNewSelectionState)
+{
+	if (bSelectionState == bNewSelectionState)
+	{
+		return;
+	}
+	if (bShared)
+	{
+		UE_LOG(ModioUICore, Warning, TEXT("Ignoring selection change for shared tag %s"), *Underlying);
+		return;
+	}
+
+	bSelectionState = bNewSelectionState;
+	if (UModioModTagOptionsUI* Options = OwningOptions.Get())
+	{
+		Options->NotifyTagSelectionChanged(*this, bNewSelectionState);
+	}
+}
+
+void UModioModTagUI::SetUnderlying(const FString& NewUnderlying)
+{
+	if (bShared)
+	{
+		UE_LOG(ModioUICore, Warning, TEXT("Ignoring raw value change for shared tag %s"), *Underlying);
+		return;
+	}
+	Underlying = NewUnderlying;
+}
+
+void UModioModTagUI::SetLocalizedText(const FText& NewLocalizedText)
+{
+	if (bShared)
+	{
+		UE_LOG(ModioUICore, Warning, TEXT("Ignoring localized text change for shared tag %s"), *Underlying);
+		return;
+	}
+	LocalizedText = NewLocalizedText;
+}
+
+void UModioModTagOptionsUI::IndexTags()
+{
+	IndexedTags.Reset();
+	for (UModioModTagInfoUI* CurrentCategory : BindableTagCategories)
+	{
+		if (!CurrentCategory)
+		{
+			continue;
+		}
+		for (UModioModTagUI* CurrentTag : CurrentCategory->BindableTags)
+		{
+			if (CurrentTag)
+			{
+				CurrentTag->TagIndex = IndexedTags.Add(CurrentTag);
+				CurrentTag->OwningOptions = this;
+				CurrentTag->OwningCategory = CurrentCategory;
+			}
+		}
+	}
+
+	SelectedTagBits.Init(false, IndexedTags.Num());
+	NumSelectedTags = 0;
+	for (int32 Index = 0; Index < IndexedTags.Num(); ++Index)
+	{
+		if (IndexedTags[Index]->bSelectionState)
+		{
+			SelectedTagBits[Index] = true;
+			++NumSelectedTags;
+		}
+	}
+}
+
+void UModioModTagOptionsUI::IndexTagsIfRequired()
+{
+	if (IndexedTags.Num() == 0 && BindableTagCategories.Num() > 0)
+	{
+		IndexTags();
+	}
+}
+
+int32 UModioModTagOptionsUI::GetNumSelectedTags()
+{
+	IndexTagsIfRequired();
+	return NumSelectedTags;
+}
+
+TArray<UModioModTagUI*> UModioModTagOptionsUI::GetSelectedTagObjects()
+{
+	IndexTagsIfRequired();
+
+	TArray<UModioModTagUI*> SelectedTags;
+	SelectedTags.Reserve(NumSelectedTags);
+	for (TConstSetBitIterator<> It(SelectedTagBits); It; ++It)
+	{
+		SelectedTags.Add(IndexedTags[It.GetIndex()]);
+	}
+	return SelectedTags;
+}
+
+void UModioModTagOptionsUI::NotifyTagSelectionChanged(UModioModTagUI& Tag, bool bNewSelectionState)
+{
+	IndexTagsIfRequired();
+	if (!SelectedTagBits.IsValidIndex(Tag.TagIndex) || IndexedTags[Tag.TagIndex] != &Tag)
+	{
+		return;
+	}
+
+	if (SelectedTagBits[Tag.TagIndex] != bNewSelectionState)
+	{
+		SelectedTagBits[Tag.TagIndex] = bNewSelectionState;
+		NumSelectedTags += bNewSelectionState ? 1 : -1;
+		OnTagSelectionToggled.Broadcast(&Tag, bNewSelectionState);
+	}
+}
+
+TArray<FString> UModioModTagOptionsUI::GetSelectedTags_Implementation()
+{
+	TArray<FString> SelectedTags;
+	for (UModioModTagUI* CurrentTag : GetSelectedTagObjects())
+	{
+		SelectedTags.Add(CurrentTag->Underlying);
+	}
+	return SelectedTags;
+}
+
+void UModioModTagOptionsUI::ClearSelectedTags_Implementation()
+{
+	// Gathered up front because deselecting a tag updates SelectedTagBits
+	for (UModioModTagUI* CurrentTag : GetSelectedTagObjects())
+	{
+		IModioModTagUIDetails::Execute_SetSelectionState(CurrentTag, false);
+	}
+}
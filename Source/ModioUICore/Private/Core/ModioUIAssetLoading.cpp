@@ -0,0 +1,88 @@
+/*
+ *  Copyright (C) 2025 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io UE Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue/blob/main/LICENSE>)
+ *
+ */
+
+#include "Core/ModioUIAssetLoading.h"
+
+#include "Misc/ScopeLock.h"
+#include "ModioUICore.h"
+
+namespace ModioUI
+{
+	namespace AssetLoadingPrivate
+	{
+		// Style constructors can run on the async loading thread, so the record needs a lock
+		FCriticalSection& GetSynchronousLoadsLock()
+		{
+			static FCriticalSection SynchronousLoadsLock;
+			return SynchronousLoadsLock;
+		}
+
+		TSet<FSoftObjectPath>& GetSynchronousLoads()
+		{
+			static TSet<FSoftObjectPath> SynchronousLoads;
+			return SynchronousLoads;
+		}
+
+		void RecordSynchronousLoad(const FSoftObjectPath& Path)
+		{
+			bool bAlreadyRecorded = false;
+			{
+				FScopeLock Lock(&GetSynchronousLoadsLock());
+				GetSynchronousLoads().Add(Path, &bAlreadyRecorded);
+			}
+			if (!bAlreadyRecorded)
+			{
+				UE_LOG(ModioUICore, Log,
+					   TEXT("Loaded %s synchronously; add it to the UI preload manifest to avoid the hitch"),
+					   *Path.ToString());
+			}
+		}
+	} // namespace AssetLoadingPrivate
+
+	UObject* LoadUIAsset(const FSoftObjectPath& Path)
+	{
+		if (Path.IsNull())
+		{
+			return nullptr;
+		}
+		if (UObject* ResidentObject = Path.ResolveObject())
+		{
+			return ResidentObject;
+		}
+		AssetLoadingPrivate::RecordSynchronousLoad(Path);
+		return Path.TryLoad();
+	}
+
+	UClass* LoadUIClass(const FSoftClassPath& Path)
+	{
+		if (Path.IsNull())
+		{
+			return nullptr;
+		}
+		if (UClass* ResidentClass = Path.ResolveClass())
+		{
+			return ResidentClass;
+		}
+		AssetLoadingPrivate::RecordSynchronousLoad(Path);
+		return Path.TryLoadClass<UObject>();
+	}
+
+	TArray<FSoftObjectPath> GetSynchronousUILoads()
+	{
+		FScopeLock Lock(&AssetLoadingPrivate::GetSynchronousLoadsLock());
+		return AssetLoadingPrivate::GetSynchronousLoads().Array();
+	}
+
+	void ResetSynchronousUILoads()
+	{
+		FScopeLock Lock(&AssetLoadingPrivate::GetSynchronousLoadsLock());
+		AssetLoadingPrivate::GetSynchronousLoads().Reset();
+	}
+} // namespace ModioUI
@@ -0,0 +1,208 @@
+/*
+ *  Copyright (C) 2025 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io UE Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue/blob/main/LICENSE>)
+ *
+ */
+
+#include "Core/ModioUIDataProvider.h"
+
+#include "Engine/Engine.h"
+#include "Interfaces/OnlineIdentityInterface.h"
+#include "Interfaces/OnlineStoreInterfaceV2.h"
+#include "OnlineSubsystem.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(ModioUIDataProvider)
+
+void UModioUIDataProvider::ListAllModsAsync(const FModioFilterParams& Filter, FOnListAllModsDelegateFast Callback)
+{
+	if (UModioSubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioSubsystem>())
+	{
+		Subsystem->ListAllModsAsync(Filter, Callback);
+		return;
+	}
+	Callback.ExecuteIfBound(FModioErrorCode::SystemError(), {});
+}
+
+void UModioUIDataProvider::ListModCollectionsAsync(const FModioFilterParams& Filter,
+                                                   FOnListModCollectionsDelegateFast Callback)
+{
+	if (UModioSubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioSubsystem>())
+	{
+		Subsystem->ListModCollectionsAsync(Filter, Callback);
+		return;
+	}
+	Callback.ExecuteIfBound(FModioErrorCode::SystemError(), {});
+}
+
+void UModioUIDataProvider::GetModCollectionModsAsync(FModioModCollectionID CollectionID,
+                                                     FOnGetModCollectionModsDelegateFast Callback)
+{
+	if (UModioSubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioSubsystem>())
+	{
+		Subsystem->GetModCollectionModsAsync(CollectionID, Callback);
+		return;
+	}
+	Callback.ExecuteIfBound(FModioErrorCode::SystemError(), {});
+}
+
+void UModioUIDataProvider::GetModTagOptionsAsync(FOnGetModTagOptionsDelegateFast Callback)
+{
+	if (UModioSubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioSubsystem>())
+	{
+		Subsystem->GetModTagOptionsAsync(Callback);
+		return;
+	}
+	Callback.ExecuteIfBound(FModioErrorCode::SystemError(), {});
+}
+
+void UModioUIDataProvider::ListUserFollowedModCollectionsAsync(const FModioFilterParams& Filter,
+                                                               FOnListFollowedModCollectionsDelegateFast Callback)
+{
+	if (UModioSubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioSubsystem>())
+	{
+		Subsystem->ListUserFollowedModCollectionsAsync(Filter, Callback);
+		return;
+	}
+	Callback.ExecuteIfBound(FModioErrorCode::SystemError(), {});
+}
+
+void UModioUIDataProvider::GetModLogoAsync(FModioModID ModID, EModioLogoSize LogoSize,
+                                           FOnGetMediaDelegateFast Callback)
+{
+	if (UModioSubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioSubsystem>())
+	{
+		Subsystem->GetModMediaAsync(ModID, LogoSize, Callback);
+		return;
+	}
+	Callback.ExecuteIfBound(FModioErrorCode::SystemError(), {});
+}
+
+void UModioUIDataProvider::GetModGalleryImageAsync(FModioModID ModID, EModioGallerySize ImageSize, int32 Index,
+                                                   FOnGetMediaDelegateFast Callback)
+{
+	if (UModioSubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioSubsystem>())
+	{
+		Subsystem->GetModMediaAsync(ModID, ImageSize, Index, Callback);
+		return;
+	}
+	Callback.ExecuteIfBound(FModioErrorCode::SystemError(), {});
+}
+
+void UModioUIDataProvider::GetModCollectionLogoAsync(FModioModCollectionID CollectionID, EModioLogoSize LogoSize,
+                                                     FOnGetMediaDelegateFast Callback)
+{
+	if (UModioSubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioSubsystem>())
+	{
+		Subsystem->GetModCollectionMediaAsync(CollectionID, LogoSize, Callback);
+		return;
+	}
+	Callback.ExecuteIfBound(FModioErrorCode::SystemError(), {});
+}
+
+void UModioUIDataProvider::GetUserAvatarAsync(EModioAvatarSize AvatarSize, FOnGetMediaDelegateFast Callback)
+{
+	if (UModioSubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioSubsystem>())
+	{
+		Subsystem->GetUserMediaAsync(AvatarSize, Callback);
+		return;
+	}
+	Callback.ExecuteIfBound(FModioErrorCode::SystemError(), {});
+}
+
+void UModioUIDataProvider::ListAllTokenPacksAsync(FOnListAllTokenPacksDelegateFast Callback)
+{
+	IOnlineSubsystem* OnlineSubsystem = IOnlineSubsystem::GetByPlatform();
+	if (!OnlineSubsystem || !OnlineSubsystem->GetStoreV2Interface().IsValid() ||
+	    !OnlineSubsystem->GetIdentityInterface().IsValid())
+	{
+		Callback.ExecuteIfBound(FModioErrorCode::SystemError(), {});
+		return;
+	}
+
+	FUniqueNetIdPtr Id = OnlineSubsystem->GetIdentityInterface()->GetUniquePlayerId(0);
+	if (!Id.IsValid())
+	{
+		Callback.ExecuteIfBound(FModioErrorCode::SystemError(), {});
+		return;
+	}
+
+	FOnlineStoreFilter Filter;
+	Filter.IncludeCategories.Add({});
+	FOnQueryOnlineStoreOffersComplete OnQueryOffersComplete;
+	OnQueryOffersComplete.BindLambda(
+		[Callback, OnlineSubsystem](bool bWasSuccessful, const TArray<FUniqueOfferId>& OfferIds, const FString& Error) {
+			if (bWasSuccessful && !OfferIds.IsEmpty())
+			{
+				TArray<FModioTokenPack> Offers;
+				for (const FUniqueOfferId& Offer : OfferIds)
+				{
+					// We get the details of the offers from the cache, this is not async
+					Offers.Add(FModioTokenPack(*OnlineSubsystem->GetStoreV2Interface()->GetOffer(Offer).Get()));
+				}
+				Callback.ExecuteIfBound({}, FModioTokenPackList(Offers));
+			}
+			else
+			{
+				Callback.ExecuteIfBound(FModioErrorCode::SystemError(), {});
+			}
+		});
+	// This callback is guaranteed
+	OnlineSubsystem->GetStoreV2Interface()->QueryOffersByFilter(*Id.Get(), Filter, OnQueryOffersComplete);
+}
+
+void UModioUIDataProvider::GetUserWalletBalanceAsync(FOnGetUserWalletBalanceDelegateFast Callback)
+{
+	if (UModioSubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioSubsystem>())
+	{
+		Subsystem->GetUserWalletBalanceAsync(Callback);
+		return;
+	}
+	Callback.ExecuteIfBound(FModioErrorCode::SystemError(), {});
+}
+
+FModioErrorCode UModioUIDataProvider::EnableModManagement(FOnModManagementDelegateFast Callback)
+{
+	if (UModioSubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioSubsystem>())
+	{
+		return Subsystem->EnableModManagement(Callback);
+	}
+	return FModioErrorCode::SystemError();
+}
+
+void UModioUIDataProvider::DisableModManagement()
+{
+	if (UModioSubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioSubsystem>())
+	{
+		Subsystem->DisableModManagement();
+	}
+}
+
+TMap<FModioModID, FModioModInfo> UModioUIDataProvider::QueryLibraryMods(bool bSubscriptionsAndInstallations,
+                                                                       bool bPurchases)
+{
+	TMap<FModioModID, FModioModInfo> LibraryMods;
+	UModioSubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioSubsystem>();
+	if (!Subsystem)
+	{
+		return LibraryMods;
+	}
+
+	if (bSubscriptionsAndInstallations)
+	{
+		TMap<FModioModID, FModioModCollectionEntry> SubscriptionsAndInstalls = Subsystem->QueryUserSubscriptions();
+		SubscriptionsAndInstalls.Append(Subsystem->QuerySystemInstallations());
+		for (const TPair<FModioModID, FModioModCollectionEntry>& Entry : SubscriptionsAndInstalls)
+		{
+			LibraryMods.Add(Entry.Key, Entry.Value.GetModProfile());
+		}
+	}
+	if (bPurchases)
+	{
+		LibraryMods.Append(Subsystem->QueryUserPurchasedMods());
+	}
+	return LibraryMods;
+}
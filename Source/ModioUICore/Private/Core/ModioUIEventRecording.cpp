@@ -0,0 +1,324 @@
+/*
+ *  Copyright (C) 2025 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io UE Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue/blob/main/LICENSE>)
+ *
+ */
+
+#include "Core/ModioUIEventRecording.h"
+
+#include "Engine/Engine.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "JsonObjectConverter.h"
+#include "Misc/FileHelper.h"
+#include "ModioUICore.h"
+#include "ModioUISubsystem.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace ModioUIEventRecording
+{
+	constexpr int32 FormatVersion = 1;
+
+	void WriteErrorCode(FJsonObject& Payload, const FModioErrorCode& ErrorCode)
+	{
+		Payload.SetBoolField(TEXT("Failed"), static_cast<bool>(ErrorCode));
+		if (ErrorCode)
+		{
+			Payload.SetStringField(TEXT("Error"), ErrorCode.GetErrorMessage());
+		}
+	}
+
+	FModioErrorCode ReadErrorCode(const FJsonObject& Payload)
+	{
+		// The original error value cannot be reconstructed outside the SDK, only whether the call failed
+		return Payload.GetBoolField(TEXT("Failed")) ? FModioErrorCode::SystemError() : FModioErrorCode();
+	}
+
+	TOptional<FModioImageWrapper> ReadImage(const FJsonObject& Payload)
+	{
+		FString ImagePath;
+		if (Payload.TryGetStringField(TEXT("Image"), ImagePath))
+		{
+			return FModioImageWrapper(ImagePath);
+		}
+		return {};
+	}
+
+	int64 ReadID(const FJsonObject& Payload)
+	{
+		return FCString::Atoi64(*Payload.GetStringField(TEXT("ID")));
+	}
+} // namespace ModioUIEventRecording
+
+TUniquePtr<FModioUIEventRecorder> FModioUIEventRecorder::Create(const FString& Path)
+{
+	TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*Path));
+	if (!Writer)
+	{
+		UE_LOG(ModioUICore, Error, TEXT("Could not open %s for UI event recording"), *Path);
+		return nullptr;
+	}
+	return TUniquePtr<FModioUIEventRecorder>(new FModioUIEventRecorder(Path, MoveTemp(Writer)));
+}
+
+FModioUIEventRecorder::FModioUIEventRecorder(const FString& InPath, TUniquePtr<FArchive> InWriter)
+	: Path(InPath),
+	  Writer(MoveTemp(InWriter)),
+	  StartTime(FPlatformTime::Seconds())
+{
+	TSharedRef<FJsonObject> Header = MakeShared<FJsonObject>();
+	Header->SetNumberField(TEXT("Version"), ModioUIEventRecording::FormatVersion);
+	Header->SetStringField(TEXT("Started"), FDateTime::UtcNow().ToIso8601());
+	WriteEvent(TEXT("Header"), Header);
+	NumEvents = 0;
+}
+
+FModioUIEventRecorder::~FModioUIEventRecorder()
+{
+	if (Writer)
+	{
+		Writer->Close();
+	}
+	UE_LOG(ModioUICore, Display, TEXT("Recorded %d UI events to %s"), NumEvents, *Path);
+}
+
+void FModioUIEventRecorder::RecordModManagementEvent(const FModioModManagementEvent& Event)
+{
+	TSharedRef<FJsonObject> Payload = MakeShared<FJsonObject>();
+	Payload->SetStringField(TEXT("ID"), Event.ID.ToString());
+	Payload->SetNumberField(TEXT("Event"), static_cast<uint8>(Event.Event));
+	ModioUIEventRecording::WriteErrorCode(*Payload, Event.Status);
+	WriteEvent(TEXT("ModManagement"), Payload);
+}
+
+void FModioUIEventRecorder::RecordSubscriptionChange(FModioErrorCode ErrorCode, FModioModID ID, bool bSubscribed)
+{
+	TSharedRef<FJsonObject> Payload = MakeShared<FJsonObject>();
+	Payload->SetStringField(TEXT("ID"), ID.ToString());
+	ModioUIEventRecording::WriteErrorCode(*Payload, ErrorCode);
+	WriteEvent(bSubscribed ? TEXT("Subscribe") : TEXT("Unsubscribe"), Payload);
+}
+
+void FModioUIEventRecorder::RecordListAllMods(FModioErrorCode ErrorCode, const TOptional<FModioModInfoList>& ModInfos,
+											  const FString& RequestIdentifier)
+{
+	TSharedRef<FJsonObject> Payload = MakeShared<FJsonObject>();
+	Payload->SetStringField(TEXT("RequestIdentifier"), RequestIdentifier);
+	ModioUIEventRecording::WriteErrorCode(*Payload, ErrorCode);
+	if (ModInfos.IsSet())
+	{
+		TSharedRef<FJsonObject> ModInfosObject = MakeShared<FJsonObject>();
+		if (FJsonObjectConverter::UStructToJsonObject(FModioModInfoList::StaticStruct(), &ModInfos.GetValue(),
+													  ModInfosObject))
+		{
+			Payload->SetObjectField(TEXT("ModInfos"), ModInfosObject);
+		}
+	}
+	WriteEvent(TEXT("ListAllMods"), Payload);
+}
+
+void FModioUIEventRecorder::RecordMediaCompleted(const TCHAR* Type, FModioErrorCode ErrorCode,
+												 const TOptional<FModioImageWrapper>& Image, const FString& ID,
+												 int32 Detail)
+{
+	TSharedRef<FJsonObject> Payload = MakeShared<FJsonObject>();
+	Payload->SetStringField(TEXT("ID"), ID);
+	Payload->SetNumberField(TEXT("Detail"), Detail);
+	ModioUIEventRecording::WriteErrorCode(*Payload, ErrorCode);
+	if (Image.IsSet())
+	{
+		Payload->SetStringField(TEXT("Image"), Image->ImagePath);
+	}
+	WriteEvent(Type, Payload);
+}
+
+void FModioUIEventRecorder::WriteEvent(const TCHAR* Type, const TSharedRef<FJsonObject>& Payload)
+{
+	TSharedRef<FJsonObject> Line = MakeShared<FJsonObject>();
+	Line->SetNumberField(TEXT("Time"), FPlatformTime::Seconds() - StartTime);
+	Line->SetStringField(TEXT("Type"), Type);
+	Line->SetObjectField(TEXT("Payload"), Payload);
+
+	FString LineString;
+	TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> JsonWriter =
+		TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&LineString);
+	FJsonSerializer::Serialize(Line, JsonWriter);
+	LineString += LINE_TERMINATOR_ANSI;
+
+	FTCHARToUTF8 Utf8Line(*LineString);
+	Writer->Serialize(const_cast<ANSICHAR*>(Utf8Line.Get()), Utf8Line.Length());
+	NumEvents++;
+}
+
+TSharedPtr<FModioUIEventReplayer> FModioUIEventReplayer::Load(const FString& Path)
+{
+	TArray<FString> Lines;
+	if (!FFileHelper::LoadFileToStringArray(Lines, *Path))
+	{
+		UE_LOG(ModioUICore, Error, TEXT("Could not read UI event recording %s"), *Path);
+		return nullptr;
+	}
+
+	TSharedRef<FModioUIEventReplayer> Replayer = MakeShared<FModioUIEventReplayer>();
+	for (int32 LineIndex = 0; LineIndex < Lines.Num(); LineIndex++)
+	{
+		TSharedPtr<FJsonObject> Line;
+		if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Lines[LineIndex]), Line) || !Line.IsValid())
+		{
+			UE_LOG(ModioUICore, Warning, TEXT("Skipping unreadable line %d of %s"), LineIndex + 1, *Path);
+			continue;
+		}
+
+		FModioUIRecordedEvent Event;
+		Event.Time = Line->GetNumberField(TEXT("Time"));
+		Event.Type = Line->GetStringField(TEXT("Type"));
+		Event.Payload = Line->GetObjectField(TEXT("Payload"));
+		if (Event.Type == TEXT("Header"))
+		{
+			const int32 Version = static_cast<int32>(Event.Payload->GetNumberField(TEXT("Version")));
+			if (Version != ModioUIEventRecording::FormatVersion)
+			{
+				UE_LOG(ModioUICore, Error, TEXT("%s was recorded with unsupported format version %d"), *Path, Version);
+				return nullptr;
+			}
+			continue;
+		}
+		Replayer->Events.Add(MoveTemp(Event));
+	}
+	return Replayer;
+}
+
+FModioUIEventReplayer::~FModioUIEventReplayer()
+{
+	Stop();
+}
+
+void FModioUIEventReplayer::Play(float Speed)
+{
+	Stop();
+	PlaybackSpeed = Speed;
+	PlaybackTime = 0.0;
+	NextEventIndex = 0;
+
+	// Bound weakly, so playback simply ends if the owner lets go of the replayer
+	TickHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateSP(AsShared(), &FModioUIEventReplayer::Tick));
+}
+
+void FModioUIEventReplayer::Stop()
+{
+	if (TickHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+		TickHandle.Reset();
+	}
+}
+
+bool FModioUIEventReplayer::Tick(float DeltaTime)
+{
+	UModioUISubsystem* Subsystem = GEngine ? GEngine->GetEngineSubsystem<UModioUISubsystem>() : nullptr;
+	if (!Subsystem)
+	{
+		TickHandle.Reset();
+		return false;
+	}
+
+	PlaybackTime += DeltaTime * PlaybackSpeed;
+	while (NextEventIndex < Events.Num() && (PlaybackSpeed <= 0.0f || Events[NextEventIndex].Time <= PlaybackTime))
+	{
+		DispatchEvent(*Subsystem, Events[NextEventIndex++]);
+	}
+
+	if (NextEventIndex >= Events.Num())
+	{
+		UE_LOG(ModioUICore, Display, TEXT("Finished replaying %d UI events"), Events.Num());
+		TickHandle.Reset();
+		return false;
+	}
+	return true;
+}
+
+bool FModioUIEventReplayer::DispatchEvent(UModioUISubsystem& Subsystem, const FModioUIRecordedEvent& Event)
+{
+	using namespace ModioUIEventRecording;
+
+	if (!Event.Payload.IsValid())
+	{
+		return false;
+	}
+	const FJsonObject& Payload = *Event.Payload;
+
+	if (Event.Type == TEXT("ModManagement"))
+	{
+		FModioModManagementEvent ManagementEvent;
+		ManagementEvent.ID = FModioModID(ReadID(Payload));
+		ManagementEvent.Event = static_cast<EModioModManagementEventType>(Payload.GetIntegerField(TEXT("Event")));
+		ManagementEvent.Status = ReadErrorCode(Payload);
+		Subsystem.ModManagementEventHandler(ManagementEvent);
+	}
+	else if (Event.Type == TEXT("Subscribe"))
+	{
+		Subsystem.SubscriptionHandler(ReadErrorCode(Payload), FModioModID(ReadID(Payload)));
+	}
+	else if (Event.Type == TEXT("Unsubscribe"))
+	{
+		Subsystem.UnsubscribeHandler(ReadErrorCode(Payload), FModioModID(ReadID(Payload)));
+	}
+	else if (Event.Type == TEXT("ListAllMods"))
+	{
+		TOptional<FModioModInfoList> ModInfos;
+		const TSharedPtr<FJsonObject>* ModInfosObject = nullptr;
+		if (Payload.TryGetObjectField(TEXT("ModInfos"), ModInfosObject))
+		{
+			FModioModInfoList List;
+			if (!FJsonObjectConverter::JsonObjectToUStruct(ModInfosObject->ToSharedRef(), &List))
+			{
+				return false;
+			}
+			ModInfos = MoveTemp(List);
+		}
+		Subsystem.ListAllModsCompletedHandler(ReadErrorCode(Payload), ModInfos,
+											  Payload.GetStringField(TEXT("RequestIdentifier")));
+	}
+	else if (Event.Type == TEXT("ModLogo"))
+	{
+		Subsystem.LogoDownloadHandler(ReadErrorCode(Payload), ReadImage(Payload), FModioModID(ReadID(Payload)),
+									  static_cast<EModioLogoSize>(Payload.GetIntegerField(TEXT("Detail"))));
+	}
+	else if (Event.Type == TEXT("GalleryImage"))
+	{
+		Subsystem.GalleryImageDownloadHandler(ReadErrorCode(Payload), ReadImage(Payload), FModioModID(ReadID(Payload)),
+											  Payload.GetIntegerField(TEXT("Detail")));
+	}
+	else if (Event.Type == TEXT("UserAvatar"))
+	{
+		Subsystem.UserAvatarDownloadHandler(ReadErrorCode(Payload), ReadImage(Payload));
+	}
+	else if (Event.Type == TEXT("CreatorAvatar"))
+	{
+		Subsystem.CreatorAvatarDownloadHandler(ReadErrorCode(Payload), ReadImage(Payload),
+											   FModioModID(ReadID(Payload)));
+	}
+	else if (Event.Type == TEXT("ModCollectionLogo"))
+	{
+		Subsystem.ModCollectionLogoDownloadHandler(ReadErrorCode(Payload), ReadImage(Payload),
+												   FModioModCollectionID(ReadID(Payload)),
+												   static_cast<EModioLogoSize>(Payload.GetIntegerField(TEXT("Detail"))));
+	}
+	else if (Event.Type == TEXT("CuratorAvatar"))
+	{
+		Subsystem.ModCollectionCuratorAvatarDownloadHandler(ReadErrorCode(Payload), ReadImage(Payload),
+															FModioModCollectionID(ReadID(Payload)));
+	}
+	else
+	{
+		UE_LOG(ModioUICore, Warning, TEXT("Cannot replay unknown UI event type %s"), *Event.Type);
+		return false;
+	}
+	return true;
+}
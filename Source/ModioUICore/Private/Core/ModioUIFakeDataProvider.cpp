@@ -0,0 +1,463 @@
+/*
+ *  Copyright (C) 2025 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io UE Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue/blob/main/LICENSE>)
+ *
+ */
+
+#include "Core/ModioUIFakeDataProvider.h"
+
+#include "IImageWrapper.h"
+#include "IImageWrapperModule.h"
+#include "Interfaces/OnlineStoreInterfaceV2.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "ModioUICore.h"
+#include "Modules/ModuleManager.h"
+#include "Types/ModioModCollection.h"
+#include "Types/ModioModInfoList.h"
+#include "Types/ModioModManagementEvent.h"
+#include "Types/ModioModTagOptions.h"
+#include "UObject/UnrealType.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(ModioUIFakeDataProvider)
+
+namespace ModioUIFakeDataProvider
+{
+	// Number of distinct tints used for placeholder images, bounding the number of files written to disk
+	constexpr uint32 NumImageTints = 8;
+
+	// Number of tags applied to each generated mod
+	constexpr int32 TagsPerMod = 3;
+
+	FString MakeTagCategoryName(int32 CategoryIndex)
+	{
+		return FString::Printf(TEXT("Category %d"), CategoryIndex);
+	}
+
+	FString MakeTagName(int32 CategoryIndex, int32 TagIndex)
+	{
+		return FString::Printf(TEXT("Tag %d-%d"), CategoryIndex, TagIndex);
+	}
+} // namespace ModioUIFakeDataProvider
+
+void UModioUIFakeDataProvider::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	Stream.Initialize(Seed);
+}
+
+void UModioUIFakeDataProvider::BeginDestroy()
+{
+	DisableModManagement();
+
+	Super::BeginDestroy();
+}
+
+void UModioUIFakeDataProvider::ApplyOverrides(const TCHAR* Params)
+{
+	for (TFieldIterator<FProperty> PropertyIt(GetClass()); PropertyIt; ++PropertyIt)
+	{
+		FProperty* Property = *PropertyIt;
+		FString Value;
+		if (Property->HasAnyPropertyFlags(CPF_Config) &&
+		    FParse::Value(Params, *(Property->GetName() + TEXT("=")), Value))
+		{
+			Property->ImportText_Direct(*Value, Property->ContainerPtrToValuePtr<void>(this), this, PPF_None);
+		}
+	}
+
+	Stream.Initialize(Seed);
+}
+
+FModioModInfo UModioUIFakeDataProvider::MakeMod(int64 ModIndex) const
+{
+	// Each mod gets its own stream so the content of a mod does not depend on the order it was requested in
+	FRandomStream ModStream(Seed ^ static_cast<int32>(ModIndex));
+
+	FModioModInfo Mod;
+	Mod.ModId = FModioModID(ModIndex + 1);
+	Mod.ProfileName = FString::Printf(TEXT("Fake Mod %lld"), ModIndex + 1);
+	if (NumTagCategories > 0)
+	{
+		for (int32 TagIndex = 0; TagIndex < ModioUIFakeDataProvider::TagsPerMod; TagIndex++)
+		{
+			FModioModTag Tag;
+			Tag.Tag = ModioUIFakeDataProvider::MakeTagName(ModStream.RandRange(0, NumTagCategories - 1),
+			                                               ModStream.RandRange(0, TagsPerCategory - 1));
+			Tag.TagLocalized = FText::FromString(Tag.Tag);
+			Mod.Tags.Add(Tag);
+		}
+	}
+	return Mod;
+}
+
+FModioModCollectionInfo UModioUIFakeDataProvider::MakeModCollection(int64 CollectionIndex) const
+{
+	FModioModCollectionInfo Collection;
+	Collection.Id = FModioModCollectionID(CollectionIndex + 1);
+	Collection.ProfileName = FString::Printf(TEXT("Fake Collection %lld"), CollectionIndex + 1);
+	return Collection;
+}
+
+void UModioUIFakeDataProvider::ListAllModsAsync(const FModioFilterParams& Filter, FOnListAllModsDelegateFast Callback)
+{
+	RecordRequest(TEXT("ListAllMods"));
+
+	if (ShouldFail())
+	{
+		ScheduleCompletion([Callback]() { Callback.ExecuteIfBound(FModioErrorCode::SystemError(), {}); });
+		return;
+	}
+
+	FModioModInfoList Result;
+	if (Filter.IncludedIDs.Num() > 0)
+	{
+		// Mod info requests ask for specific IDs; only IDs inside the fake catalogue resolve
+		for (const FModioModID& ID : Filter.IncludedIDs)
+		{
+			const int64 ModIndex = FCString::Atoi64(*ID.ToString()) - 1;
+			if (ModIndex >= 0 && ModIndex < NumMods)
+			{
+				Result.InternalList.Add(MakeMod(ModIndex));
+			}
+		}
+	}
+	else
+	{
+		// The filter index is treated as a result offset, matching FModioFilterParams::IndexedResults
+		const int64 Count = FMath::Min<int64>(Filter.Count > 0 ? Filter.Count : PageSize, PageSize);
+		const int64 Start = FMath::Max<int64>(Filter.Index, 0);
+		for (int64 ModIndex = Start; ModIndex < FMath::Min<int64>(Start + Count, NumMods); ModIndex++)
+		{
+			Result.InternalList.Add(MakeMod(ModIndex));
+		}
+	}
+
+	ScheduleCompletion([Callback, Result = MoveTemp(Result)]() { Callback.ExecuteIfBound({}, Result); });
+}
+
+void UModioUIFakeDataProvider::ListModCollectionsAsync(const FModioFilterParams& Filter,
+                                                       FOnListModCollectionsDelegateFast Callback)
+{
+	RecordRequest(TEXT("ListModCollections"));
+
+	if (ShouldFail())
+	{
+		ScheduleCompletion([Callback]() { Callback.ExecuteIfBound(FModioErrorCode::SystemError(), {}); });
+		return;
+	}
+
+	FModioModCollectionInfoList Result;
+	const int64 Count = FMath::Min<int64>(Filter.Count > 0 ? Filter.Count : PageSize, PageSize);
+	const int64 Start = FMath::Max<int64>(Filter.Index, 0);
+	for (int64 CollectionIndex = Start; CollectionIndex < FMath::Min<int64>(Start + Count, NumModCollections);
+	     CollectionIndex++)
+	{
+		Result.InternalList.Add(MakeModCollection(CollectionIndex));
+	}
+
+	ScheduleCompletion([Callback, Result = MoveTemp(Result)]() { Callback.ExecuteIfBound({}, Result); });
+}
+
+void UModioUIFakeDataProvider::GetModCollectionModsAsync(FModioModCollectionID CollectionID,
+                                                         FOnGetModCollectionModsDelegateFast Callback)
+{
+	RecordRequest(TEXT("GetModCollectionMods"));
+
+	if (ShouldFail() || NumMods <= 0)
+	{
+		ScheduleCompletion([Callback]() { Callback.ExecuteIfBound(FModioErrorCode::SystemError(), {}); });
+		return;
+	}
+
+	// Collections draw a contiguous, wrapping run of mods so that each collection has stable contents
+	FModioModInfoList Result;
+	const int64 FirstModIndex = GetTypeHash(CollectionID.ToString()) % NumMods;
+	for (int32 EntryIndex = 0; EntryIndex < FMath::Min(ModsPerCollection, NumMods); EntryIndex++)
+	{
+		Result.InternalList.Add(MakeMod((FirstModIndex + EntryIndex) % NumMods));
+	}
+
+	ScheduleCompletion([Callback, Result = MoveTemp(Result)]() { Callback.ExecuteIfBound({}, Result); });
+}
+
+void UModioUIFakeDataProvider::GetModTagOptionsAsync(FOnGetModTagOptionsDelegateFast Callback)
+{
+	RecordRequest(TEXT("GetModTagOptions"));
+
+	if (ShouldFail())
+	{
+		ScheduleCompletion([Callback]() { Callback.ExecuteIfBound(FModioErrorCode::SystemError(), {}); });
+		return;
+	}
+
+	FModioModTagOptions Result;
+	for (int32 CategoryIndex = 0; CategoryIndex < NumTagCategories; CategoryIndex++)
+	{
+		FModioModTagInfo Category;
+		Category.TagGroupName = ModioUIFakeDataProvider::MakeTagCategoryName(CategoryIndex);
+		Category.bAllowMultipleSelection = (CategoryIndex % 2) == 0;
+		for (int32 TagIndex = 0; TagIndex < TagsPerCategory; TagIndex++)
+		{
+			Category.TagGroupValues.Add(ModioUIFakeDataProvider::MakeTagName(CategoryIndex, TagIndex));
+		}
+		Result.InternalList.Add(Category);
+	}
+
+	ScheduleCompletion([Callback, Result = MoveTemp(Result)]() { Callback.ExecuteIfBound({}, Result); });
+}
+
+void UModioUIFakeDataProvider::ListUserFollowedModCollectionsAsync(const FModioFilterParams& Filter,
+                                                                   FOnListFollowedModCollectionsDelegateFast Callback)
+{
+	RecordRequest(TEXT("ListUserFollowedModCollections"));
+
+	if (ShouldFail())
+	{
+		ScheduleCompletion([Callback]() { Callback.ExecuteIfBound(FModioErrorCode::SystemError(), {}); });
+		return;
+	}
+
+	FModioModCollectionInfoList Result;
+	const int64 Count = FMath::Min<int64>(Filter.Count > 0 ? Filter.Count : PageSize, PageSize);
+	const int64 Start = FMath::Max<int64>(Filter.Index, 0);
+	const int64 NumFollowed = FMath::Min(NumFollowedModCollections, NumModCollections);
+	for (int64 CollectionIndex = Start; CollectionIndex < FMath::Min<int64>(Start + Count, NumFollowed);
+	     CollectionIndex++)
+	{
+		Result.InternalList.Add(MakeModCollection(CollectionIndex));
+	}
+
+	ScheduleCompletion([Callback, Result = MoveTemp(Result)]() { Callback.ExecuteIfBound({}, Result); });
+}
+
+void UModioUIFakeDataProvider::GetModLogoAsync(FModioModID ModID, EModioLogoSize LogoSize,
+                                               FOnGetMediaDelegateFast Callback)
+{
+	const bool bSmall = LogoSize == EModioLogoSize::Thumb320;
+	ScheduleMediaCompletion(GetTypeHash(ModID.ToString()), bSmall ? 320 : 640, bSmall ? 180 : 360, Callback);
+}
+
+void UModioUIFakeDataProvider::GetModGalleryImageAsync(FModioModID ModID, EModioGallerySize ImageSize, int32 Index,
+                                                       FOnGetMediaDelegateFast Callback)
+{
+	const bool bLarge = ImageSize == EModioGallerySize::Original;
+	ScheduleMediaCompletion(HashCombine(GetTypeHash(ModID.ToString()), GetTypeHash(Index)), bLarge ? 1280 : 320,
+	                        bLarge ? 720 : 180, Callback);
+}
+
+void UModioUIFakeDataProvider::GetModCollectionLogoAsync(FModioModCollectionID CollectionID, EModioLogoSize LogoSize,
+                                                         FOnGetMediaDelegateFast Callback)
+{
+	const bool bSmall = LogoSize == EModioLogoSize::Thumb320;
+	ScheduleMediaCompletion(GetTypeHash(CollectionID.ToString()), bSmall ? 320 : 640, bSmall ? 180 : 360, Callback);
+}
+
+void UModioUIFakeDataProvider::GetUserAvatarAsync(EModioAvatarSize AvatarSize, FOnGetMediaDelegateFast Callback)
+{
+	ScheduleMediaCompletion(0, 100, 100, Callback);
+}
+
+void UModioUIFakeDataProvider::ListAllTokenPacksAsync(FOnListAllTokenPacksDelegateFast Callback)
+{
+	RecordRequest(TEXT("ListAllTokenPacks"));
+
+	if (ShouldFail())
+	{
+		ScheduleCompletion([Callback]() { Callback.ExecuteIfBound(FModioErrorCode::SystemError(), {}); });
+		return;
+	}
+
+	TArray<FModioTokenPack> Packs;
+	for (int32 PackIndex = 0; PackIndex < NumTokenPacks; PackIndex++)
+	{
+		// Built from a store offer, as the platform store would provide
+		FOnlineStoreOffer Offer;
+		Offer.OfferId = FString::Printf(TEXT("fake_token_pack_%d"), PackIndex + 1);
+		Offer.Title = FText::FromString(FString::Printf(TEXT("Fake Token Pack %d"), PackIndex + 1));
+		Offer.Description = FText::FromString(FString::Printf(TEXT("%d tokens"), (PackIndex + 1) * 500));
+		Offer.NumericPrice = (PackIndex + 1) * 499;
+		Offer.CurrencyCode = TEXT("USD");
+		Packs.Add(FModioTokenPack(Offer));
+	}
+
+	ScheduleCompletion(
+		[Callback, Result = FModioTokenPackList(Packs)]() { Callback.ExecuteIfBound({}, Result); });
+}
+
+void UModioUIFakeDataProvider::GetUserWalletBalanceAsync(FOnGetUserWalletBalanceDelegateFast Callback)
+{
+	RecordRequest(TEXT("GetUserWalletBalance"));
+
+	if (ShouldFail())
+	{
+		ScheduleCompletion([Callback]() { Callback.ExecuteIfBound(FModioErrorCode::SystemError(), {}); });
+		return;
+	}
+
+	ScheduleCompletion([Callback, Balance = static_cast<uint64>(FMath::Max<int64>(WalletBalance, 0))]() {
+		Callback.ExecuteIfBound({}, Balance);
+	});
+}
+
+FModioErrorCode UModioUIFakeDataProvider::EnableModManagement(FOnModManagementDelegateFast Callback)
+{
+	ManagementCallback = Callback;
+	if (!ManagementTickHandle.IsValid() && ManagementEventIntervalSeconds > 0)
+	{
+		ManagementTickHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateUObject(this, &UModioUIFakeDataProvider::TickManagementEvents),
+			ManagementEventIntervalSeconds);
+	}
+	return {};
+}
+
+void UModioUIFakeDataProvider::DisableModManagement()
+{
+	ManagementCallback.Unbind();
+	if (ManagementTickHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(ManagementTickHandle);
+		ManagementTickHandle.Reset();
+	}
+}
+
+TMap<FModioModID, FModioModInfo> UModioUIFakeDataProvider::QueryLibraryMods(bool bSubscriptionsAndInstallations,
+                                                                           bool bPurchases)
+{
+	RecordRequest(TEXT("QueryLibraryMods"));
+
+	TMap<FModioModID, FModioModInfo> LibraryMods;
+	const int64 NumSubscribed = FMath::Min<int64>(NumSubscribedMods, NumMods);
+	const int64 NumPurchased = FMath::Min<int64>(NumPurchasedMods, NumMods - NumSubscribed);
+	const int64 FirstModIndex = bSubscriptionsAndInstallations ? 0 : NumSubscribed;
+	const int64 LastModIndex = bPurchases ? NumSubscribed + NumPurchased : NumSubscribed;
+	for (int64 ModIndex = FirstModIndex; ModIndex < LastModIndex; ModIndex++)
+	{
+		FModioModInfo Mod = MakeMod(ModIndex);
+		LibraryMods.Add(Mod.ModId, MoveTemp(Mod));
+	}
+	return LibraryMods;
+}
+
+int32 UModioUIFakeDataProvider::GetRequestCount(FName RequestName) const
+{
+	return RequestCounts.FindRef(RequestName);
+}
+
+void UModioUIFakeDataProvider::ResetRequestCounts()
+{
+	RequestCounts.Reset();
+}
+
+void UModioUIFakeDataProvider::DumpRequestCounts(FOutputDevice& OutputDevice) const
+{
+	for (const TPair<FName, int32>& RequestCount : RequestCounts)
+	{
+		OutputDevice.Logf(TEXT("%s: %d"), *RequestCount.Key.ToString(), RequestCount.Value);
+	}
+}
+
+void UModioUIFakeDataProvider::RecordRequest(FName RequestName)
+{
+	RequestCounts.FindOrAdd(RequestName)++;
+}
+
+bool UModioUIFakeDataProvider::ShouldFail()
+{
+	return FailureRate > 0 && Stream.FRand() < FailureRate;
+}
+
+void UModioUIFakeDataProvider::ScheduleCompletion(TFunction<void()> Completion)
+{
+	const float Delay = FMath::Max(0.0f, LatencySeconds + Stream.FRandRange(-JitterSeconds, JitterSeconds));
+
+	// Even zero latency completes on a later tick, as callers rely on requests never completing re-entrantly
+	FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateWeakLambda(this, [Completion = MoveTemp(Completion)](float) {
+			Completion();
+			return false;
+		}),
+		Delay);
+}
+
+FString UModioUIFakeDataProvider::GetPlaceholderImagePath(uint32 Key, int32 Width, int32 Height)
+{
+	const uint32 Tint = Key % ModioUIFakeDataProvider::NumImageTints;
+	const FString ImagePath =
+		FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("ModioUI"), TEXT("FakeDataProvider"),
+		                FString::Printf(TEXT("Placeholder_%dx%d_%u.png"), Width, Height, Tint));
+	if (WrittenImagePaths.Contains(ImagePath))
+	{
+		return ImagePath;
+	}
+
+	IImageWrapperModule& ImageWrapperModule = FModuleManager::LoadModuleChecked<IImageWrapperModule>("ImageWrapper");
+	TSharedPtr<IImageWrapper> ImageWrapper = ImageWrapperModule.CreateImageWrapper(EImageFormat::PNG);
+
+	const uint8 Hue = static_cast<uint8>(Tint * 256 / ModioUIFakeDataProvider::NumImageTints);
+	const FColor Color = FLinearColor::MakeFromHSV8(Hue, 128, 200).ToFColor(true);
+	TArray<FColor> Pixels;
+	Pixels.Init(Color, Width * Height);
+
+	if (ImageWrapper.IsValid() &&
+	    ImageWrapper->SetRaw(Pixels.GetData(), Pixels.Num() * sizeof(FColor), Width, Height, ERGBFormat::BGRA, 8) &&
+	    FFileHelper::SaveArrayToFile(ImageWrapper->GetCompressed(), *ImagePath))
+	{
+		WrittenImagePaths.Add(ImagePath);
+	}
+	else
+	{
+		UE_LOG(ModioUICore, Warning, TEXT("Fake data provider could not write placeholder image %s"), *ImagePath);
+	}
+	return ImagePath;
+}
+
+void UModioUIFakeDataProvider::ScheduleMediaCompletion(uint32 Key, int32 Width, int32 Height,
+                                                       FOnGetMediaDelegateFast Callback)
+{
+	RecordRequest(TEXT("GetMedia"));
+
+	if (ShouldFail())
+	{
+		ScheduleCompletion([Callback]() { Callback.ExecuteIfBound(FModioErrorCode::SystemError(), {}); });
+		return;
+	}
+
+	ScheduleCompletion([Callback, Image = FModioImageWrapper(GetPlaceholderImagePath(Key, Width, Height))]() {
+		Callback.ExecuteIfBound({}, Image);
+	});
+}
+
+bool UModioUIFakeDataProvider::TickManagementEvents(float DeltaTime)
+{
+	if (NumMods <= 0)
+	{
+		return true;
+	}
+
+	// Walk through install/update cycles for random mods, emitting the begin event and its completion in turn
+	static const EModioModManagementEventType EventCycle[] = {
+		EModioModManagementEventType::BeginInstall, EModioModManagementEventType::Installed,
+		EModioModManagementEventType::BeginUpdate, EModioModManagementEventType::Updated,
+		EModioModManagementEventType::BeginUninstall, EModioModManagementEventType::Uninstalled};
+
+	const int32 CycleIndex = NextManagementEvent++ % UE_ARRAY_COUNT(EventCycle);
+	if (CycleIndex == 0)
+	{
+		ManagementEventModIndex = Stream.RandRange(0, NumMods - 1);
+	}
+
+	FModioModManagementEvent Event;
+	Event.ID = FModioModID(ManagementEventModIndex + 1);
+	Event.Event = EventCycle[CycleIndex];
+	// Only completion events carry a status, so failures are rolled for those alone
+	Event.Status = (CycleIndex % 2 == 1 && ShouldFail()) ? FModioErrorCode::SystemError() : FModioErrorCode();
+	ManagementCallback.ExecuteIfBound(Event);
+	return true;
+}
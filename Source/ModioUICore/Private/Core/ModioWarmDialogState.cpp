@@ -0,0 +1,41 @@
+/*
+ *  Copyright (C) 2025 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io UE Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue/blob/main/LICENSE>)
+ *
+ */
+
+#include "Core/ModioWarmDialogState.h"
+
+#include "Engine/Engine.h"
+#include "ModioUISubsystem.h"
+
+bool FModioWarmDialogState::BeginSetDataSource(const UObject* InDataSource, const UObject* CurrentDataSource)
+{
+	UModioUISubsystem* UISubsystem = GEngine ? GEngine->GetEngineSubsystem<UModioUISubsystem>() : nullptr;
+	const bool bFromWarmDialog = UISubsystem && UISubsystem->IsSettingWarmDialogDataSource();
+	bPreparing = bFromWarmDialog && UISubsystem->IsPreparingWarmDialog();
+
+	// A caller setting the same data source again outside the warm path is asking for a refresh, so that still rebuilds
+	const bool bAlreadyBound = InDataSource && InDataSource == CurrentDataSource && bDataSourceFromWarmDialog;
+	bDataSourceFromWarmDialog = bFromWarmDialog;
+	return !bAlreadyBound;
+}
+
+void FModioWarmDialogState::DeferMedia()
+{
+	bMediaDeferred = true;
+}
+
+bool FModioWarmDialogState::ConsumeDeferredMedia()
+{
+	if (!bMediaDeferred || bPreparing)
+	{
+		return false;
+	}
+	bMediaDeferred = false;
+	return true;
+}
@@ -10,7 +10,11 @@
 
 #include "ModioUICore.h"
 
+#include "Core/ModioUIAssetLoading.h"
+#include "Core/ModioUIEventRecording.h"
+#include "Core/ModioUIFakeDataProvider.h"
 #include "Engine/Engine.h"
+#include "Misc/Paths.h"
 #include "ModioErrorCondition.h"
 #include "ModioSubsystem.h"
 #include "ModioUISettings.h"
@@ -57,10 +61,41 @@ void FModioUICore::StartupModule()
 		TEXT("Modio.SimulateConnectivityChange"), TEXT("Simulates a change in connectivity state"),
 		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateRaw(this,
 																	   &FModioUICore::SimulateConnectivityChange)));
+
+	ConsoleCommands.Add(IConsoleManager::Get().RegisterConsoleCommand(
+		TEXT("Modio.FakeBackend"),
+		TEXT("Routes UI data through a local fake backend. Pass Off to restore the default provider, Stats to print "
+			 "the requests it has received, or Key=Value pairs (NumMods, PageSize, LatencySeconds, JitterSeconds, "
+			 "FailureRate, ...) to configure it"),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateRaw(this, &FModioUICore::SetFakeBackend)));
+
+	ConsoleCommands.Add(IConsoleManager::Get().RegisterConsoleCommand(
+		TEXT("Modio.RecordUIEvents"),
+		TEXT("Records the events broadcast by the UI subsystem to a file for later replay. Pass a path to start "
+			 "(defaults to Saved/ModioUI/Recordings/<timestamp>.jsonl) or Stop to finish"),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateRaw(this, &FModioUICore::RecordUIEvents)));
+
+	ConsoleCommands.Add(IConsoleManager::Get().RegisterConsoleCommand(
+		TEXT("Modio.ReplayUIEvents"),
+		TEXT("Replays a file written by Modio.RecordUIEvents into the UI subsystem. Usage: Modio.ReplayUIEvents <Path> "
+			 "[Speed], where a Speed of 0 replays everything at once. Pass Stop to cancel"),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateRaw(this, &FModioUICore::ReplayUIEvents)));
+
+	ConsoleCommands.Add(IConsoleManager::Get().RegisterConsoleCommand(
+		TEXT("Modio.UIPreloadReport"),
+		TEXT("Lists the assets in the UI preload manifest and the UI assets that were still loaded synchronously. Pass "
+			 "Reset to clear the list of synchronous loads"),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateRaw(this, &FModioUICore::ReportUIPreload)));
 }
 
 void FModioUICore::ShutdownModule()
 {
+	if (ActiveReplay.IsValid())
+	{
+		ActiveReplay->Stop();
+		ActiveReplay.Reset();
+	}
+
 	for (IConsoleCommand* Command : ConsoleCommands)
 	{
 		IConsoleManager::Get().UnregisterConsoleObject(Command);
@@ -121,6 +156,117 @@ void FModioUICore::SimulateConnectivityChange(const TArray<FString>& Args, UWorl
 	}
 }
 
+void FModioUICore::SetFakeBackend(const TArray<FString>& Args, UWorld*, FOutputDevice& OutputDevice)
+{
+	UModioUISubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioUISubsystem>();
+	if (!Subsystem)
+	{
+		return;
+	}
+
+	if (Args.Num() == 1 && Args[0].Equals(TEXT("Off"), ESearchCase::IgnoreCase))
+	{
+		Subsystem->SetDataProvider(nullptr);
+		OutputDevice.Log(TEXT("Fake backend disabled"));
+		return;
+	}
+
+	if (Args.Num() == 1 && Args[0].Equals(TEXT("Stats"), ESearchCase::IgnoreCase))
+	{
+		if (UModioUIFakeDataProvider* FakeDataProvider = Cast<UModioUIFakeDataProvider>(Subsystem->GetDataProvider()))
+		{
+			FakeDataProvider->DumpRequestCounts(OutputDevice);
+		}
+		else
+		{
+			OutputDevice.Log(ELogVerbosity::Warning, TEXT("Fake backend is not enabled"));
+		}
+		return;
+	}
+
+	UModioUIFakeDataProvider* FakeDataProvider = NewObject<UModioUIFakeDataProvider>(Subsystem);
+	FakeDataProvider->ApplyOverrides(*FString::Join(Args, TEXT(" ")));
+	Subsystem->SetDataProvider(FakeDataProvider);
+	OutputDevice.Logf(TEXT("Fake backend enabled with %d mods"), FakeDataProvider->NumMods);
+}
+
+void FModioUICore::RecordUIEvents(const TArray<FString>& Args, UWorld*, FOutputDevice& OutputDevice)
+{
+	UModioUISubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioUISubsystem>();
+	if (!Subsystem)
+	{
+		return;
+	}
+
+	if (Args.Num() == 1 && Args[0].Equals(TEXT("Stop"), ESearchCase::IgnoreCase))
+	{
+		Subsystem->StopEventRecording();
+		return;
+	}
+
+	const FString Path = Args.Num() > 0 ? Args[0]
+										: FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("ModioUI"), TEXT("Recordings"),
+														  FDateTime::Now().ToString() + TEXT(".jsonl"));
+	if (Subsystem->StartEventRecording(Path))
+	{
+		OutputDevice.Logf(TEXT("Recording UI events to %s"), *Path);
+	}
+	else
+	{
+		OutputDevice.Logf(ELogVerbosity::Warning, TEXT("Could not record UI events to %s"), *Path);
+	}
+}
+
+void FModioUICore::ReplayUIEvents(const TArray<FString>& Args, UWorld*, FOutputDevice& OutputDevice)
+{
+	if (ActiveReplay.IsValid())
+	{
+		ActiveReplay->Stop();
+		ActiveReplay.Reset();
+	}
+	if (Args.Num() == 0 || Args[0].Equals(TEXT("Stop"), ESearchCase::IgnoreCase))
+	{
+		return;
+	}
+
+	ActiveReplay = FModioUIEventReplayer::Load(Args[0]);
+	if (!ActiveReplay.IsValid())
+	{
+		OutputDevice.Logf(ELogVerbosity::Warning, TEXT("Could not load UI event recording %s"), *Args[0]);
+		return;
+	}
+	const float Speed = Args.Num() > 1 ? FCString::Atof(*Args[1]) : 1.0f;
+	ActiveReplay->Play(Speed);
+	OutputDevice.Logf(TEXT("Replaying %d UI events from %s"), ActiveReplay->GetEvents().Num(), *Args[0]);
+}
+
+void FModioUICore::ReportUIPreload(const TArray<FString>& Args, UWorld*, FOutputDevice& OutputDevice)
+{
+	if (Args.Num() == 1 && Args[0].Equals(TEXT("Reset"), ESearchCase::IgnoreCase))
+	{
+		ModioUI::ResetSynchronousUILoads();
+		return;
+	}
+
+	if (UModioUISubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioUISubsystem>())
+	{
+		const TArray<FSoftObjectPath> Manifest = Subsystem->GetUIPreloadManifest();
+		OutputDevice.Logf(TEXT("UI preload manifest (%d assets%s):"), Manifest.Num(),
+						  Subsystem->IsUIPreloadInProgress() ? TEXT(", still loading") : TEXT(""));
+		for (const FSoftObjectPath& Path : Manifest)
+		{
+			OutputDevice.Logf(TEXT("  %s%s"), *Path.ToString(), Path.ResolveObject() ? TEXT("") : TEXT(" (not loaded)"));
+		}
+	}
+
+	const TArray<FSoftObjectPath> SynchronousLoads = ModioUI::GetSynchronousUILoads();
+	OutputDevice.Logf(TEXT("UI assets loaded synchronously (%d):"), SynchronousLoads.Num());
+	for (const FSoftObjectPath& Path : SynchronousLoads)
+	{
+		OutputDevice.Logf(TEXT("  %s"), *Path.ToString());
+	}
+}
+
 #undef LOCTEXT_NAMESPACE
 
 IMPLEMENT_MODULE(FModioUICore, ModioUICore)
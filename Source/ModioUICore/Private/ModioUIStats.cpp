@@ -0,0 +1,34 @@
+/*
+ *  Copyright (C) 2025 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io UE Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue/blob/main/LICENSE>)
+ *
+ */
+
+#include "ModioUIStats.h"
+
+UE_TRACE_CHANNEL_DEFINE(ModioUIChannel);
+
+CSV_DEFINE_CATEGORY_MODULE(MODIOUICORE_API, ModioUI, true);
+
+DEFINE_STAT(STAT_ModioUI_RequestIssue);
+DEFINE_STAT(STAT_ModioUI_RequestCompletion);
+DEFINE_STAT(STAT_ModioUI_TileSetDataSource);
+DEFINE_STAT(STAT_ModioUI_ImageLoad);
+DEFINE_STAT(STAT_ModioUI_ImageDecode);
+DEFINE_STAT(STAT_ModioUI_ListRegeneration);
+DEFINE_STAT(STAT_ModioUI_CommandListRebuild);
+DEFINE_STAT(STAT_ModioUI_DeferredEntryBinding);
+DEFINE_STAT(STAT_ModioUI_DialogPrepare);
+
+DEFINE_STAT(STAT_ModioUI_LiveReceivers);
+DEFINE_STAT(STAT_ModioUI_ImageLoadsInFlight);
+DEFINE_STAT(STAT_ModioUI_EntriesAwaitingBinding);
+DEFINE_STAT(STAT_ModioUI_BroadcastFanOut);
+DEFINE_STAT(STAT_ModioUI_WrappersCreated);
+DEFINE_STAT(STAT_ModioUI_ModInfoQueriesIssued);
+DEFINE_STAT(STAT_ModioUI_TextUpdatesApplied);
+DEFINE_STAT(STAT_ModioUI_TextUpdatesSkipped);
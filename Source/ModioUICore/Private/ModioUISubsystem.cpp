@@ -13,20 +13,37 @@
 #include "Modio.h"
 #include "ModioSubsystem.h"
 #include "Blueprint/UserWidget.h"
+#include "CommonActivatableWidget.h"
+#include "Core/ModioAssetPaths.h"
 #include "Core/ModioModInfoUI.h"
+#include "Core/ModioTagOptionsUI.h"
+#include "Core/ModioUIAssetLoading.h"
+#include "Core/ModioUIDataProvider.h"
 #include "Delegates/DelegateCombinations.h"
 #include "Engine/Engine.h"
+#include "Engine/Texture2DDynamic.h"
 #include "Engine/GameViewportClient.h"
 #include "Engine/UserInterfaceSettings.h"
 #include "GenericPlatform/GenericPlatformMath.h"
 #include "Libraries/ModioErrorConditionLibrary.h"
+#include "Libraries/ModioModTagOptionsLibrary.h"
 #include "Loc/BeginModioLocNamespace.h"
 #include "Math/IntPoint.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
 #include "ModioErrorCondition.h"
 #include "ModioSettings.h"
 #include "ModioSubsystem.h"
 #include "ModioUICore.h"
+#include "ModioUISettings.h"
+#include "ModioUIStats.h"
 #include "OnlineSubsystem.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+#include "UI/Interfaces/IModioUIDataSourceWidget.h"
+#include "UObject/UObjectHash.h"
+#include "UObject/UnrealType.h"
 
 #include "Interfaces/OnlineExternalUIInterface.h"
 #include "Interfaces/OnlineStoreInterfaceV2.h"
@@ -38,6 +55,30 @@
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(ModioUISubsystem)
 
+namespace ModioUISubsystem
+{
+	template<typename MulticastDelegateType>
+	int32 GetNumReceivers(const TModioUIReceiverRegistry<MulticastDelegateType>& Registry)
+	{
+		return Registry.Num();
+	}
+
+	// Request completion delegates are bound by individual callers rather than receiver interfaces, and are not counted
+	template<typename DelegateSignature>
+	int32 GetNumReceivers(const TMulticastDelegate<DelegateSignature>&)
+	{
+		return 0;
+	}
+} // namespace ModioUISubsystem
+
+// Records the receiver fan-out of a subsystem event before broadcasting it
+#define MODIO_UI_BROADCAST(Delegate, ...)                                               \
+	do                                                                                  \
+	{                                                                                   \
+		RecordBroadcastFanOut(ModioUISubsystem::GetNumReceivers(Delegate), #Delegate);  \
+		Delegate.Broadcast(__VA_ARGS__);                                                \
+	} while (0)
+
 void UModioUISubsystem::GetPreloadDependencies(TArray<UObject*>& OutDeps)
 {
 	Super::GetPreloadDependencies(OutDeps);
@@ -54,25 +95,67 @@ bool UModioUISubsystem::QueryIsModEnabled(FModioModID ID)
 
 void UModioUISubsystem::RequestWalletBalanceRefresh()
 {
-	if (UModioSubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioSubsystem>())
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_RequestIssue);
+
+	RequestWalletBalance({});
+}
+
+void UModioUISubsystem::RequestWalletBalanceRefreshWithHandler(const FOnGetUserWalletBalanceDelegate& Callback)
+{
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_RequestIssue);
+
+	RequestWalletBalance(FOnGetUserWalletBalanceDelegateFast::CreateLambda(
+		[Callback](FModioErrorCode ec, TOptional<uint64> Balance) {
+			Callback.ExecuteIfBound(ec, FModioOptionalUInt64{Balance});
+		}));
+}
+
+void UModioUISubsystem::RequestWalletBalance(FOnGetUserWalletBalanceDelegateFast Callback)
+{
+	if (CachedWalletBalance.IsSet() && FPlatformTime::Seconds() - CachedWalletBalanceFetchTime <=
+	                                       GetDefault<UModioUISettings>()->WalletBalanceMaxAgeSeconds)
+	{
+		Callback.ExecuteIfBound({}, CachedWalletBalance);
+		WalletBalanceRequestHandler({}, CachedWalletBalance);
+		return;
+	}
+
+	if (Callback.IsBound())
 	{
-		Subsystem->GetUserWalletBalanceAsync(
-			FOnGetUserWalletBalanceDelegateFast::CreateUObject(this, &UModioUISubsystem::WalletBalanceRequestHandler));
+		PendingWalletBalanceCallbacks.Add(Callback);
 	}
+	if (bWalletBalanceRequestInFlight)
+	{
+		return;
+	}
+
+	bWalletBalanceRequestInFlight = true;
+	DataProvider->GetUserWalletBalanceAsync(FOnGetUserWalletBalanceDelegateFast::CreateUObject(
+		this, &UModioUISubsystem::OnGetUserWalletBalanceComplete, WalletBalanceGeneration));
 }
 
-void UModioUISubsystem::RequestWalletBalanceRefreshWithHandler(const FOnGetUserWalletBalanceDelegate& Callback)
+void UModioUISubsystem::OnGetUserWalletBalanceComplete(FModioErrorCode ErrorCode, TOptional<uint64> Balance,
+                                                       uint32 Generation)
 {
-	if (UModioSubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioSubsystem>())
+	if (Generation != WalletBalanceGeneration)
 	{
-		Subsystem->GetUserWalletBalanceAsync(FOnGetUserWalletBalanceDelegateFast::CreateLambda(
-			[HookedHandler = FOnGetUserWalletBalanceDelegateFast::CreateUObject(
-					this, &UModioUISubsystem::WalletBalanceRequestHandler),
-				Callback](FModioErrorCode ec, TOptional<uint64> Balance) {
-				Callback.ExecuteIfBound(ec, FModioOptionalUInt64{Balance});
-				HookedHandler.ExecuteIfBound(ec, Balance);
-			}));
+		// Fetched for a previous user; InvalidateStoreCaches has already asked again if anyone was waiting
+		return;
+	}
+
+	bWalletBalanceRequestInFlight = false;
+	if (!ErrorCode && Balance.IsSet())
+	{
+		CachedWalletBalance = Balance;
+		CachedWalletBalanceFetchTime = FPlatformTime::Seconds();
 	}
+
+	TArray<FOnGetUserWalletBalanceDelegateFast> Callbacks = MoveTemp(PendingWalletBalanceCallbacks);
+	for (FOnGetUserWalletBalanceDelegateFast& Callback : Callbacks)
+	{
+		Callback.ExecuteIfBound(ErrorCode, Balance);
+	}
+	WalletBalanceRequestHandler(ErrorCode, Balance);
 }
 
 void UModioUISubsystem::RequestPurchaseForModIDWithHandler(FModioModID ID, FModioUnsigned64 ExpectedPrice,
@@ -105,7 +188,114 @@ bool UModioUISubsystem::RequestModEnabledStateChange(FModioModID ID, bool bNewEn
 
 void UModioUISubsystem::RequestShowDialog(EModioUIDialogType DialogType, UObject* DataSource)
 {
-	OnDialogDisplayEvent.Broadcast(DialogType, DataSource);
+	PendingDialogPreparations.Remove(DialogType);
+	SetWarmDialogDataSource(DialogType, DataSource, false);
+
+	MODIO_UI_BROADCAST(OnDialogDisplayEvent, DialogType, DataSource);
+}
+
+void UModioUISubsystem::RegisterWarmDialog(EModioUIDialogType DialogType, UCommonActivatableWidget* Dialog)
+{
+	if (!Dialog)
+	{
+		WarmDialogs.Remove(DialogType);
+		return;
+	}
+
+	if (!Dialog->Implements<UModioUIDataSourceWidget>())
+	{
+		UE_LOG(ModioUICore, Warning, TEXT("Warm dialog %s does not implement IModioUIDataSourceWidget and cannot be "
+		                                  "prepared ahead of display"), *Dialog->GetName());
+	}
+
+	// Build the Slate tree now rather than on the frame the dialog is first shown
+	Dialog->TakeWidget();
+	WarmDialogs.Add(DialogType, Dialog);
+}
+
+UCommonActivatableWidget* UModioUISubsystem::GetWarmDialog(EModioUIDialogType DialogType) const
+{
+	return WarmDialogs.FindRef(DialogType);
+}
+
+void UModioUISubsystem::PrepareDialog(EModioUIDialogType DialogType, UObject* DataSource)
+{
+	if (!DataSource || !WarmDialogs.Contains(DialogType))
+	{
+		return;
+	}
+
+	// Every new request restarts the delay, so only the tile the user settles on is prepared
+	PendingDialogPreparations.Add(DialogType, DataSource);
+	DialogPreparationDeadline =
+		FPlatformTime::Seconds() + GetDefault<UModioUISettings>()->DialogPreparationDelaySeconds;
+	if (!DialogPreparationTickHandle.IsValid())
+	{
+		DialogPreparationTickHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateUObject(this, &UModioUISubsystem::TickDialogPreparations));
+	}
+}
+
+bool UModioUISubsystem::TickDialogPreparations(float DeltaTime)
+{
+	if (FPlatformTime::Seconds() < DialogPreparationDeadline)
+	{
+		return true;
+	}
+
+	DialogPreparationTickHandle.Reset();
+	TMap<EModioUIDialogType, TWeakObjectPtr<UObject>> Preparations = MoveTemp(PendingDialogPreparations);
+	for (const TPair<EModioUIDialogType, TWeakObjectPtr<UObject>>& Preparation : Preparations)
+	{
+		// Never swap the content of a dialog the user is looking at
+		UCommonActivatableWidget* Dialog = WarmDialogs.FindRef(Preparation.Key);
+		if (Dialog && !Dialog->IsActivated() && Preparation.Value.IsValid())
+		{
+			SetWarmDialogDataSource(Preparation.Key, Preparation.Value.Get(), true);
+		}
+	}
+	return false;
+}
+
+void UModioUISubsystem::SetWarmDialogDataSource(EModioUIDialogType DialogType, UObject* DataSource,
+                                                bool bSpeculative)
+{
+	UCommonActivatableWidget* Dialog = WarmDialogs.FindRef(DialogType);
+	if (!Dialog || !Dialog->Implements<UModioUIDataSourceWidget>() ||
+	    (bSpeculative && IModioUIDataSourceWidget::Execute_GetDataSource(Dialog) == DataSource))
+	{
+		return;
+	}
+
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_DialogPrepare);
+	TGuardValue<bool> SettingDataSource(bSettingWarmDialogDataSource, true);
+	TGuardValue<bool> Preparing(bPreparingWarmDialog, bSpeculative);
+	IModioUIDataSourceWidget::Execute_SetDataSource(Dialog, DataSource);
+}
+
+void UModioUISubsystem::RetainIdleSelectorMenu(UObject* Owner, FSimpleDelegate ReleaseContent)
+{
+	ForgetIdleSelectorMenu(Owner);
+	IdleSelectorMenus.Emplace(Owner, MoveTemp(ReleaseContent));
+
+	const int32 MaxIdleMenus = GetDefault<UModioUISettings>()->MaxIdleSelectorMenus;
+	while (IdleSelectorMenus.Num() > MaxIdleMenus)
+	{
+		TPair<TWeakObjectPtr<UObject>, FSimpleDelegate> Evicted = MoveTemp(IdleSelectorMenus[0]);
+		IdleSelectorMenus.RemoveAt(0);
+		if (Evicted.Key.IsValid())
+		{
+			Evicted.Value.ExecuteIfBound();
+		}
+	}
+}
+
+void UModioUISubsystem::ForgetIdleSelectorMenu(UObject* Owner)
+{
+	// Also drop menus whose owners have been collected
+	IdleSelectorMenus.RemoveAll([Owner](const TPair<TWeakObjectPtr<UObject>, FSimpleDelegate>& Menu) {
+		return !Menu.Key.IsValid() || Menu.Key.Get() == Owner;
+	});
 }
 
 void UModioUISubsystem::NotifyConnectivityChange(bool bNewConnectivityState)
@@ -113,7 +303,7 @@ void UModioUISubsystem::NotifyConnectivityChange(bool bNewConnectivityState)
 	if (bCurrentConnectivityState != bNewConnectivityState)
 	{
 		bCurrentConnectivityState = bNewConnectivityState;
-		OnConnectivityChanged.Broadcast(bCurrentConnectivityState);
+		MODIO_UI_BROADCAST(OnConnectivityChanged, bCurrentConnectivityState);
 	}
 }
 
@@ -148,16 +338,20 @@ bool UModioUISubsystem::IsUGCFeatureEnabled(EModioUIFeatureFlags Feature)
 
 void UModioUISubsystem::OnModEnabledChanged(int64 RawModID, bool bNewEnabledState)
 {
-	OnModEnabledStateChanged.Broadcast(FModioModID(RawModID), bNewEnabledState);
+	MODIO_UI_BROADCAST(OnModEnabledStateChanged, FModioModID(RawModID), bNewEnabledState);
 }
 
 void UModioUISubsystem::ModCollectionFollowHandler(FModioErrorCode ErrorCode,
                                                    TOptional<FModioModCollectionInfo> CollectionInfo)
 {
-	OnModCollectionFollowRequestComplete.Broadcast(ErrorCode, CollectionInfo.GetValue().Id);
+	MODIO_UI_BROADCAST(OnModCollectionFollowRequestComplete, ErrorCode, CollectionInfo.GetValue().Id);
 	if (!ErrorCode)
 	{
-		OnModCollectionFollowStateChanged.Broadcast(CollectionInfo.GetValue().Id, true);
+		if (bFollowedModCollectionsFetched)
+		{
+			FollowedModCollectionIDs.Add(CollectionInfo.GetValue().Id);
+		}
+		MODIO_UI_BROADCAST(OnModCollectionFollowStateChanged, CollectionInfo.GetValue().Id, true);
 	}
 	else
 	{
@@ -169,7 +363,7 @@ void UModioUISubsystem::ModCollectionFollowHandler(FModioErrorCode ErrorCode,
 
 void UModioUISubsystem::ModCollectionSubscribeHandler(FModioErrorCode ErrorCode, FModioModCollectionID CollectionID)
 {
-	OnModCollectionSubscribeRequestComplete.Broadcast(ErrorCode, CollectionID);
+	MODIO_UI_BROADCAST(OnModCollectionSubscribeRequestComplete, ErrorCode, CollectionID);
 	if (ErrorCode)
 	{
 		UE_LOG(ModioUICore, Error, TEXT("Subscribe failed for mod collection %s: \"%s\""),
@@ -182,7 +376,8 @@ void UModioUISubsystem::ModCollectionUnfollowHandler(FModioErrorCode ErrorCode,
 {
 	if (!ErrorCode)
 	{
-		OnModCollectionFollowStateChanged.Broadcast(CollectionID, false);
+		FollowedModCollectionIDs.Remove(CollectionID);
+		MODIO_UI_BROADCAST(OnModCollectionFollowStateChanged, CollectionID, false);
 	}
 	else
 	{
@@ -194,7 +389,7 @@ void UModioUISubsystem::ModCollectionUnfollowHandler(FModioErrorCode ErrorCode,
 
 void UModioUISubsystem::ModCollectionUnsubscribeHandler(FModioErrorCode ErrorCode, FModioModCollectionID CollectionID)
 {
-	OnModCollectionUnsubscribeRequestComplete.Broadcast(ErrorCode, CollectionID);
+	MODIO_UI_BROADCAST(OnModCollectionUnsubscribeRequestComplete, ErrorCode, CollectionID);
 	if (ErrorCode)
 	{
 		UE_LOG(ModioUICore, Error, TEXT("Unsubscribe failed for mod collection %s: \"%s\""),
@@ -204,10 +399,17 @@ void UModioUISubsystem::ModCollectionUnsubscribeHandler(FModioErrorCode ErrorCod
 
 void UModioUISubsystem::SubscriptionHandler(FModioErrorCode ErrorCode, FModioModID ID)
 {
-	OnSubscriptionRequestCompleted.Broadcast(ErrorCode, ID);
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_RequestCompletion);
+
+	if (EventRecorder)
+	{
+		EventRecorder->RecordSubscriptionChange(ErrorCode, ID, true);
+	}
+
+	MODIO_UI_BROADCAST(OnSubscriptionRequestCompleted, ErrorCode, ID);
 	if (!ErrorCode)
 	{
-		OnSubscriptionStatusChanged.Broadcast(ID, true);
+		MODIO_UI_BROADCAST(OnSubscriptionStatusChanged, ID, true);
 	}
 	else
 	{
@@ -219,11 +421,14 @@ void UModioUISubsystem::SubscriptionHandler(FModioErrorCode ErrorCode, FModioMod
 void UModioUISubsystem::PurchaseRequestHandler(FModioErrorCode ErrorCode,
                                                TOptional<FModioTransactionRecord> Transaction)
 {
-	OnPurchaseRequestCompleted.Broadcast(ErrorCode, Transaction);
+	MODIO_UI_BROADCAST(OnPurchaseRequestCompleted, ErrorCode, Transaction);
 	if (!ErrorCode)
 	{
-		OnGetUserWalletBalanceRequestCompleted.Broadcast(Transaction.GetValue().UpdatedUserWalletBalance.Underlying);
-		OnSubscriptionStatusChanged.Broadcast(Transaction.GetValue().AssociatedModID, true);
+		// The transaction carries the new balance, so there is no need to fetch it again
+		CachedWalletBalance = Transaction.GetValue().UpdatedUserWalletBalance.Underlying;
+		CachedWalletBalanceFetchTime = FPlatformTime::Seconds();
+		MODIO_UI_BROADCAST(OnGetUserWalletBalanceRequestCompleted, CachedWalletBalance.GetValue());
+		MODIO_UI_BROADCAST(OnSubscriptionStatusChanged, Transaction.GetValue().AssociatedModID, true);
 	}
 	else
 	{
@@ -233,9 +438,16 @@ void UModioUISubsystem::PurchaseRequestHandler(FModioErrorCode ErrorCode,
 
 void UModioUISubsystem::UnsubscribeHandler(FModioErrorCode ErrorCode, FModioModID ID)
 {
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_RequestCompletion);
+
+	if (EventRecorder)
+	{
+		EventRecorder->RecordSubscriptionChange(ErrorCode, ID, false);
+	}
+
 	if (!ErrorCode)
 	{
-		OnSubscriptionStatusChanged.Broadcast(ID, false);
+		MODIO_UI_BROADCAST(OnSubscriptionStatusChanged, ID, false);
 	}
 	else
 	{
@@ -259,7 +471,7 @@ void UModioUISubsystem::UninstallHandler(FModioErrorCode ErrorCode, FModioModID
 	Event.ID = ID;
 	Event.Event = EModioModManagementEventType::Uninstalled;
 	Event.Status = ErrorCode;
-	OnModManagementEvent.Broadcast(Event);
+	MODIO_UI_BROADCAST(OnModManagementEvent, Event);
 }
 
 void UModioUISubsystem::Initialize(FSubsystemCollectionBase& Collection)
@@ -269,6 +481,123 @@ void UModioUISubsystem::Initialize(FSubsystemCollectionBase& Collection)
 
 	SetModRatingStateDataProvider(this);
 	SetModCollectionRatingStateDataProvider(this);
+
+	UModioUIDataProvider* ConfiguredDataProvider = nullptr;
+	if (UClass* DataProviderClass = GetDefault<UModioUISettings>()->DataProviderClass.LoadSynchronous())
+	{
+		ConfiguredDataProvider = NewObject<UModioUIDataProvider>(this, DataProviderClass);
+	}
+	SetDataProvider(ConfiguredDataProvider);
+
+	// Loaded after the provider is known, so options persisted from mod.io are never served for a substitute provider
+	LoadPersistedTagOptions();
+	// Persisted ratings are loaded by ResolveRatingsUser once there is a user, as the SDK is not initialized yet
+
+	// Wait for the first tick so that the preload does not compete with the rest of engine startup
+	if (GetDefault<UModioUISettings>()->bPreloadUIAssetsOnStartup && !IsRunningDedicatedServer() &&
+	    !IsRunningCommandlet())
+	{
+		FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateWeakLambda(this, [this](float) {
+			PreloadUIAssets();
+			return false;
+		}));
+	}
+}
+
+void UModioUISubsystem::Deinitialize()
+{
+	if (RatingSubmissionTickHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(RatingSubmissionTickHandle);
+		RatingSubmissionTickHandle.Reset();
+	}
+	// The SDK may already be shutting down, so ratings still settling are dropped rather than sent. Only confirmed
+	// ratings are persisted, so the next session shows what the server last accepted
+	for (TMap<int64, FPendingRatingSubmission>* PendingSubmissions :
+	     {&PendingModRatingSubmissions, &PendingModCollectionRatingSubmissions})
+	{
+		for (TPair<int64, FPendingRatingSubmission>& Pending : *PendingSubmissions)
+		{
+			for (FOnErrorOnlyDelegateFast& Callback : Pending.Value.Callbacks)
+			{
+				Callback.ExecuteIfBound(FModioErrorCode::SystemError());
+			}
+		}
+		PendingSubmissions->Reset();
+	}
+	if (bConfirmedRatingsDirty)
+	{
+		PersistRatings();
+	}
+
+	if (ModInfoBatchTickHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(ModInfoBatchTickHandle);
+		ModInfoBatchTickHandle.Reset();
+	}
+	if (DialogPreparationTickHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(DialogPreparationTickHandle);
+		DialogPreparationTickHandle.Reset();
+	}
+	WarmDialogs.Reset();
+	IdleSelectorMenus.Reset();
+	StopEventRecording();
+	for (const TSharedPtr<FStreamableHandle>& Handle : UIPreloadHandles)
+	{
+		Handle->CancelHandle();
+	}
+	UIPreloadHandles.Reset();
+	Super::Deinitialize();
+}
+
+void UModioUISubsystem::SetDataProvider(UModioUIDataProvider* InDataProvider)
+{
+	if (!InDataProvider)
+	{
+		InDataProvider = NewObject<UModioUIDataProvider>(this);
+	}
+
+	// Mod management events come from the provider, so carry the enabled state across to the new one
+	if (DataProvider && bModManagementEnabled)
+	{
+		DataProvider->DisableModManagement();
+		InDataProvider->EnableModManagement(
+			FOnModManagementDelegateFast::CreateUObject(this, &UModioUISubsystem::ModManagementEventHandler));
+	}
+	const bool bProviderClassChanged = DataProvider && DataProvider->GetClass() != InDataProvider->GetClass();
+	if (bProviderClassChanged)
+	{
+		// Tag options and mod info from one provider are meaningless to another
+		CachedModTags.Reset();
+		ResetSharedModTags();
+		RecentModInfos.Reset();
+		ResetCollectionModsCache();
+	}
+	DataProvider = InDataProvider;
+
+	// A tag options request in flight on the previous provider will never be answered for this one
+	TagOptionsGeneration++;
+	if (bTagOptionsRequestInFlight)
+	{
+		bTagOptionsRequestInFlight = false;
+		if (PendingTagOptionsCallbacks.Num() > 0)
+		{
+			RequestTagOptionsFromProvider();
+		}
+	}
+	if (bProviderClassChanged)
+	{
+		LoadPersistedTagOptions();
+	}
+	InvalidateFollowedModCollections();
+	InvalidateUserAvatar();
+	InvalidateStoreCaches();
+}
+
+UModioUIDataProvider* UModioUISubsystem::GetDataProvider() const
+{
+	return DataProvider;
 }
 
 void UModioUISubsystem::SetModEnabledStateDataProvider(
@@ -286,20 +615,16 @@ void UModioUISubsystem::SetModEnabledStateDataProvider(
 
 FModioErrorCode UModioUISubsystem::EnableModManagement()
 {
-	if (UModioSubsystem* DependencySubsystem = GEngine->GetEngineSubsystem<UModioSubsystem>())
-	{
-		return DependencySubsystem->EnableModManagement(
-			FOnModManagementDelegateFast::CreateUObject(this, &UModioUISubsystem::ModManagementEventHandler));
-	}
-	return FModioErrorCode::SystemError();
+	FModioErrorCode ErrorCode = DataProvider->EnableModManagement(
+		FOnModManagementDelegateFast::CreateUObject(this, &UModioUISubsystem::ModManagementEventHandler));
+	bModManagementEnabled = !ErrorCode;
+	return ErrorCode;
 }
 
 void UModioUISubsystem::DisableModManagement()
 {
-	if (UModioSubsystem* DependencySubsystem = GEngine->GetEngineSubsystem<UModioSubsystem>())
-	{
-		DependencySubsystem->DisableModManagement();
-	}
+	DataProvider->DisableModManagement();
+	bModManagementEnabled = false;
 }
 
 void UModioUISubsystem::RequestSubscriptionForModID(FModioModID ID, bool IncludeDependencies)
@@ -377,74 +702,24 @@ void UModioUISubsystem::RequestUninstallForModID(FModioModID ID, FOnErrorOnlyDel
 
 void UModioUISubsystem::RequestRateUpForModId(FModioModID ID, FOnErrorOnlyDelegateFast DedicatedCallback)
 {
-	if (UModioSubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioSubsystem>())
-	{
-		// Needs additional payload param so we know which type of operation was completed
-		Subsystem->SubmitModRatingAsync(
-			ID, EModioRating::Positive,
-			FOnErrorOnlyDelegateFast::CreateLambda(
-				[HookedHandler = FOnErrorOnlyDelegateFast::CreateUObject(
-						this, &UModioUISubsystem::OnRatingSubmissionComplete, EModioRating::Positive),
-					DedicatedCallback](FModioErrorCode ec) {
-					DedicatedCallback.ExecuteIfBound(ec);
-					HookedHandler.ExecuteIfBound(ec);
-				}));
-	}
+	QueueRatingSubmission(false, FCString::Atoi64(*ID.ToString()), EModioRating::Positive, DedicatedCallback);
 }
 
 void UModioUISubsystem::RequestRateDownForModId(FModioModID ID, FOnErrorOnlyDelegateFast DedicatedCallback)
 {
-	UModioSubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioSubsystem>();
-	if (Subsystem)
-	{
-		// Needs additional payload param so we know which type of operation was completed
-		Subsystem->SubmitModRatingAsync(
-			ID, EModioRating::Negative,
-			FOnErrorOnlyDelegateFast::CreateLambda(
-				[HookedHandler = FOnErrorOnlyDelegateFast::CreateUObject(
-						this, &UModioUISubsystem::OnRatingSubmissionComplete, EModioRating::Negative),
-					DedicatedCallback](FModioErrorCode ec) {
-					DedicatedCallback.ExecuteIfBound(ec);
-					HookedHandler.ExecuteIfBound(ec);
-				}));
-	}
+	QueueRatingSubmission(false, FCString::Atoi64(*ID.ToString()), EModioRating::Negative, DedicatedCallback);
 }
 
 void UModioUISubsystem::RequestRateUpForModCollectionId(FModioModCollectionID ID,
                                                         FOnErrorOnlyDelegateFast DedicatedCallback)
 {
-	if (UModioSubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioSubsystem>())
-	{
-		// Needs additional payload param so we know which type of operation was completed
-		Subsystem->SubmitModCollectionRatingAsync(
-			ID, EModioRating::Positive,
-			FOnErrorOnlyDelegateFast::CreateLambda(
-				[HookedHandler = FOnErrorOnlyDelegateFast::CreateUObject(
-						this, &UModioUISubsystem::OnModCollectionRatingSubmissionComplete, EModioRating::Positive),
-					DedicatedCallback](FModioErrorCode ec) {
-					DedicatedCallback.ExecuteIfBound(ec);
-					HookedHandler.ExecuteIfBound(ec);
-				}));
-	}
+	QueueRatingSubmission(true, FCString::Atoi64(*ID.ToString()), EModioRating::Positive, DedicatedCallback);
 }
 
 void UModioUISubsystem::RequestRateDownForModCollectionId(FModioModCollectionID ID,
                                                           FOnErrorOnlyDelegateFast DedicatedCallback)
 {
-	UModioSubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioSubsystem>();
-	if (Subsystem)
-	{
-		// Needs additional payload param so we know which type of operation was completed
-		Subsystem->SubmitModCollectionRatingAsync(
-			ID, EModioRating::Negative,
-			FOnErrorOnlyDelegateFast::CreateLambda(
-				[HookedHandler = FOnErrorOnlyDelegateFast::CreateUObject(
-						this, &UModioUISubsystem::OnRatingSubmissionComplete, EModioRating::Negative),
-					DedicatedCallback](FModioErrorCode ec) {
-					DedicatedCallback.ExecuteIfBound(ec);
-					HookedHandler.ExecuteIfBound(ec);
-				}));
-	}
+	QueueRatingSubmission(true, FCString::Atoi64(*ID.ToString()), EModioRating::Negative, DedicatedCallback);
 }
 
 void UModioUISubsystem::OnRatingSubmissionComplete(FModioErrorCode ErrorCode, EModioRating ModioRating)
@@ -466,6 +741,253 @@ void UModioUISubsystem::OnModCollectionRatingSubmissionComplete(FModioErrorCode
 	}
 }
 
+void UModioUISubsystem::QueueRatingSubmission(bool bModCollection, int64 ID, EModioRating NewRating,
+                                              FOnErrorOnlyDelegateFast DedicatedCallback)
+{
+	ResolveRatingsUser();
+
+	TMap<int64, FPendingRatingSubmission>& PendingSubmissions =
+		bModCollection ? PendingModCollectionRatingSubmissions : PendingModRatingSubmissions;
+	TMap<int64, EModioRating>& Ratings = bModCollection ? ModCollectionRatingMap : ModRatingMap;
+
+	FPendingRatingSubmission* Submission = PendingSubmissions.Find(ID);
+	if (!Submission)
+	{
+		const EModioRating* CurrentRating = Ratings.Find(ID);
+		Submission = &PendingSubmissions.Add(ID);
+		Submission->PreviousRating = CurrentRating ? *CurrentRating : EModioRating::Neutral;
+		Submission->UserID = RatingsUserID;
+	}
+	// Each change restarts the window, so only the rating the user settles on is sent
+	Submission->SubmitTime = FPlatformTime::Seconds() + GetDefault<UModioUISettings>()->RatingSubmissionSettleSeconds;
+	if (DedicatedCallback.IsBound())
+	{
+		Submission->Callbacks.Add(MoveTemp(DedicatedCallback));
+	}
+
+	SetLocalRating(bModCollection, ID, NewRating);
+	StartRatingSubmissionTicker();
+}
+
+void UModioUISubsystem::StartRatingSubmissionTicker()
+{
+	if (!RatingSubmissionTickHandle.IsValid())
+	{
+		RatingSubmissionTickHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateUObject(this, &UModioUISubsystem::TickRatingSubmissions));
+	}
+}
+
+bool UModioUISubsystem::TickRatingSubmissions(float DeltaTime)
+{
+	FlushRatingSubmissions(false);
+	// Written here rather than on every change, so that a burst of confirmations costs a single write
+	if (bConfirmedRatingsDirty)
+	{
+		PersistRatings();
+	}
+	if (PendingModRatingSubmissions.Num() == 0 && PendingModCollectionRatingSubmissions.Num() == 0)
+	{
+		RatingSubmissionTickHandle.Reset();
+		return false;
+	}
+	return true;
+}
+
+void UModioUISubsystem::FlushRatingSubmissions(bool bFlushAll)
+{
+	UModioSubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioSubsystem>();
+	const double Now = FPlatformTime::Seconds();
+
+	for (bool bModCollection : {false, true})
+	{
+		TMap<int64, FPendingRatingSubmission>& PendingSubmissions =
+			bModCollection ? PendingModCollectionRatingSubmissions : PendingModRatingSubmissions;
+		const TMap<int64, EModioRating>& Ratings = bModCollection ? ModCollectionRatingMap : ModRatingMap;
+
+		// Taken out of the map first, as completion callbacks are free to queue new ratings
+		TArray<TPair<int64, FPendingRatingSubmission>> DueSubmissions;
+		for (auto It = PendingSubmissions.CreateIterator(); It; ++It)
+		{
+			if (bFlushAll || It.Value().SubmitTime <= Now)
+			{
+				DueSubmissions.Emplace(It.Key(), MoveTemp(It.Value()));
+				It.RemoveCurrent();
+			}
+		}
+
+		for (TPair<int64, FPendingRatingSubmission>& Due : DueSubmissions)
+		{
+			const EModioRating* StoredRating = Ratings.Find(Due.Key);
+			const EModioRating Rating = StoredRating ? *StoredRating : EModioRating::Neutral;
+			if (Rating == Due.Value.PreviousRating || !Subsystem)
+			{
+				// Toggled back to where it started, so the server already has this rating
+				OnPendingRatingSubmitted(Subsystem ? FModioErrorCode() : FModioErrorCode::SystemError(),
+				                         bModCollection, Due.Key, Rating, MoveTemp(Due.Value));
+				continue;
+			}
+
+			FOnErrorOnlyDelegateFast OnSubmitted =
+				FOnErrorOnlyDelegateFast::CreateUObject(this, &UModioUISubsystem::OnPendingRatingSubmitted,
+				                                        bModCollection, Due.Key, Rating, MoveTemp(Due.Value));
+			if (bModCollection)
+			{
+				Subsystem->SubmitModCollectionRatingAsync(FModioModCollectionID(Due.Key), Rating, OnSubmitted);
+			}
+			else
+			{
+				Subsystem->SubmitModRatingAsync(FModioModID(Due.Key), Rating, OnSubmitted);
+			}
+		}
+	}
+}
+
+void UModioUISubsystem::OnPendingRatingSubmitted(FModioErrorCode ErrorCode, bool bModCollection, int64 ID,
+                                                 EModioRating Rating, FPendingRatingSubmission Submission)
+{
+	if (bModCollection)
+	{
+		OnModCollectionRatingSubmissionComplete(ErrorCode, Rating);
+	}
+	else
+	{
+		OnRatingSubmissionComplete(ErrorCode, Rating);
+	}
+
+	if (!ErrorCode && Submission.UserID == RatingsUserID)
+	{
+		SetConfirmedRating(bModCollection, ID, Rating);
+	}
+	else if (ErrorCode && Submission.UserID == RatingsUserID)
+	{
+		// A newer change is already waiting to be submitted, so it inherits the rating to fall back to
+		TMap<int64, FPendingRatingSubmission>& PendingSubmissions =
+			bModCollection ? PendingModCollectionRatingSubmissions : PendingModRatingSubmissions;
+		if (FPendingRatingSubmission* NewerSubmission = PendingSubmissions.Find(ID))
+		{
+			NewerSubmission->PreviousRating = Submission.PreviousRating;
+		}
+		else
+		{
+			SetLocalRating(bModCollection, ID, Submission.PreviousRating);
+		}
+	}
+
+	for (FOnErrorOnlyDelegateFast& Callback : Submission.Callbacks)
+	{
+		Callback.ExecuteIfBound(ErrorCode);
+	}
+}
+
+void UModioUISubsystem::SetLocalRating(bool bModCollection, int64 ID, EModioRating NewRating)
+{
+	TMap<int64, EModioRating>& Ratings = bModCollection ? ModCollectionRatingMap : ModRatingMap;
+	Ratings.Add(ID, NewRating);
+}
+
+void UModioUISubsystem::SetConfirmedRating(bool bModCollection, int64 ID, EModioRating Rating)
+{
+	TMap<int64, EModioRating>& ConfirmedRatings =
+		bModCollection ? ConfirmedModCollectionRatings : ConfirmedModRatings;
+	EModioRating& StoredRating = ConfirmedRatings.FindOrAdd(ID, EModioRating::Neutral);
+	if (StoredRating != Rating)
+	{
+		StoredRating = Rating;
+		bConfirmedRatingsDirty = true;
+		StartRatingSubmissionTicker();
+	}
+}
+
+void UModioUISubsystem::ResolveRatingsUser()
+{
+	if (!RatingsUserID.IsEmpty())
+	{
+		return;
+	}
+	// Covers sessions the SDK restored on its own, which never pass through OnAuthenticationComplete
+	if (UModioSubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioSubsystem>())
+	{
+		TOptional<FModioUser> CurrentUser = Subsystem->QueryUserProfile();
+		if (CurrentUser.IsSet())
+		{
+			LoadPersistedRatings(CurrentUser->UserId.ToString());
+		}
+	}
+}
+
+namespace ModioUISubsystem
+{
+	// Bump whenever the layout of the persisted ratings file changes
+	constexpr int32 PersistedRatingsVersion = 1;
+
+	FString GetPersistedRatingsPath(const FString& UserID)
+	{
+		return FPaths::ProjectSavedDir() / TEXT("ModioUI") / TEXT("Ratings") / (UserID + TEXT(".bin"));
+	}
+} // namespace ModioUISubsystem
+
+void UModioUISubsystem::LoadPersistedRatings(const FString& UserID)
+{
+	if (bConfirmedRatingsDirty)
+	{
+		PersistRatings();
+	}
+
+	RatingsUserID = UserID;
+	ModRatingMap.Reset();
+	ModCollectionRatingMap.Reset();
+	ConfirmedModRatings.Reset();
+	ConfirmedModCollectionRatings.Reset();
+
+	TArray<uint8> FileBytes;
+	if (UserID.IsEmpty() || !GetDefault<UModioUISettings>()->bPersistRatings ||
+	    !FFileHelper::LoadFileToArray(FileBytes, *ModioUISubsystem::GetPersistedRatingsPath(UserID), FILEREAD_Silent))
+	{
+		return;
+	}
+
+	FMemoryReader Reader(FileBytes);
+	int32 Version = 0;
+	Reader << Version;
+	if (Version != ModioUISubsystem::PersistedRatingsVersion)
+	{
+		return;
+	}
+	Reader << ConfirmedModRatings;
+	Reader << ConfirmedModCollectionRatings;
+	if (Reader.IsError())
+	{
+		UE_LOG(ModioUICore, Warning, TEXT("Discarding unreadable persisted ratings for user %s"), *UserID);
+		ConfirmedModRatings.Reset();
+		ConfirmedModCollectionRatings.Reset();
+	}
+	ModRatingMap = ConfirmedModRatings;
+	ModCollectionRatingMap = ConfirmedModCollectionRatings;
+}
+
+void UModioUISubsystem::PersistRatings()
+{
+	bConfirmedRatingsDirty = false;
+	if (RatingsUserID.IsEmpty() || !GetDefault<UModioUISettings>()->bPersistRatings)
+	{
+		return;
+	}
+
+	TArray<uint8> FileBytes;
+	FMemoryWriter Writer(FileBytes);
+	int32 Version = ModioUISubsystem::PersistedRatingsVersion;
+	Writer << Version;
+	Writer << ConfirmedModRatings;
+	Writer << ConfirmedModCollectionRatings;
+
+	const FString Path = ModioUISubsystem::GetPersistedRatingsPath(RatingsUserID);
+	if (!FFileHelper::SaveArrayToFile(FileBytes, *Path))
+	{
+		UE_LOG(ModioUICore, Warning, TEXT("Failed to persist ratings to %s"), *Path);
+	}
+}
+
 void UModioUISubsystem::OnExternalUpdatesFetched(FModioErrorCode ErrorCode)
 {
 	if (ErrorCode)
@@ -494,23 +1016,21 @@ void UModioUISubsystem::RequestRemoveSubscriptionForModID(FModioModID ID)
 void UModioUISubsystem::RequestLogoDownloadForModID(FModioModID ID,
                                                     EModioLogoSize LogoSize /*= EModioLogoSize::Thumb320*/)
 {
-	if (UModioSubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioSubsystem>())
-	{
-		Subsystem->GetModMediaAsync(
-			ID, LogoSize,
-			FOnGetMediaDelegateFast::CreateUObject(this, &UModioUISubsystem::LogoDownloadHandler, ID, LogoSize));
-	}
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_RequestIssue);
+
+	DataProvider->GetModLogoAsync(
+		ID, LogoSize,
+		FOnGetMediaDelegateFast::CreateUObject(this, &UModioUISubsystem::LogoDownloadHandler, ID, LogoSize));
 }
 
 void UModioUISubsystem::RequestLogoDownloadForModCollectionID(FModioModCollectionID ID, EModioLogoSize LogoSize)
 {
-	if (UModioSubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioSubsystem>())
-	{
-		Subsystem->GetModCollectionMediaAsync(ID, LogoSize,
-		                                      FOnGetMediaDelegateFast::CreateUObject(
-			                                      this, &UModioUISubsystem::ModCollectionLogoDownloadHandler, ID,
-			                                      LogoSize));
-	}
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_RequestIssue);
+
+	DataProvider->GetModCollectionLogoAsync(
+		ID, LogoSize,
+		FOnGetMediaDelegateFast::CreateUObject(this, &UModioUISubsystem::ModCollectionLogoDownloadHandler, ID,
+		                                       LogoSize));
 }
 
 float UModioUISubsystem::GetCurrentDPIScaleValue()
@@ -529,96 +1049,208 @@ float UModioUISubsystem::GetCurrentDPIScaleValue()
 
 void UModioUISubsystem::RequestModInfoForModIDs(TArray<FModioModID> IDs)
 {
-	if (UModioSubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioSubsystem>())
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_RequestIssue);
+
+	for (const FModioModID& ID : IDs)
 	{
-		// Bind the list of IDs as an additional parameter so that if we get an error we can report the error for the
-		// specific IDs that were queried
-		Subsystem->ListAllModsAsync(
-			FModioFilterParams().MatchingIDs(IDs),
-			FOnListAllModsDelegateFast::CreateUObject(this, &UModioUISubsystem::ModInfoRequestCompletedHandler, IDs));
+		bool bAlreadyPending = false;
+		PendingModInfoIDSet.Add(ID, &bAlreadyPending);
+		if (!bAlreadyPending)
+		{
+			PendingModInfoIDs.Add(ID);
+		}
+	}
+
+	// The window opens with the first request and is not extended by later ones, so a steady trickle of requests
+	// cannot hold back the batch indefinitely
+	if (!ModInfoBatchTickHandle.IsValid() && PendingModInfoIDs.Num() > 0)
+	{
+		ModInfoBatchDeadline = FPlatformTime::Seconds() + GetDefault<UModioUISettings>()->ModInfoBatchWindowSeconds;
+		ModInfoBatchTickHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateUObject(this, &UModioUISubsystem::TickModInfoBatch));
 	}
 }
 
-void UModioUISubsystem::RequestListAllMods(FModioFilterParams Params, FString RequestIdentifier)
+bool UModioUISubsystem::TickModInfoBatch(float DeltaTime)
 {
-	if (UModioSubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioSubsystem>())
+	if (FPlatformTime::Seconds() < ModInfoBatchDeadline)
 	{
-		Subsystem->ListAllModsAsync(
-			Params, FOnListAllModsDelegateFast::CreateUObject(this, &UModioUISubsystem::ListAllModsCompletedHandler,
-			                                                  RequestIdentifier));
+		return true;
 	}
+
+	ModInfoBatchTickHandle.Reset();
+	FlushModInfoBatch();
+	return false;
 }
 
-void UModioUISubsystem::RequestListModCollections(const FModioFilterParams& Filter, FString RequestIdentifier)
+void UModioUISubsystem::FlushModInfoBatch()
 {
-	if (UModioSubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioSubsystem>())
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_RequestIssue);
+
+	const UModioUISettings* Settings = GetDefault<UModioUISettings>();
+	const double Now = FPlatformTime::Seconds();
+	const double ReuseSeconds = Settings->ModInfoReuseSeconds;
+	for (auto It = RecentModInfos.CreateIterator(); It; ++It)
+	{
+		if (Now - It.Value().FetchTime > ReuseSeconds && It.Value().NumCollections == 0)
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	TArray<FModioModID> IDsToQuery;
+	TArray<FModioModInfo> ReusedInfos;
+	for (const FModioModID& ID : PendingModInfoIDs)
+	{
+		if (InFlightModInfoIDs.Contains(ID))
+		{
+			// Everyone receives the result of the query already covering this ID
+			continue;
+		}
+		const FRecentModInfo* Recent = RecentModInfos.Find(ID);
+		if (Recent && ReuseSeconds > 0.0 && Now - Recent->FetchTime <= ReuseSeconds)
+		{
+			ReusedInfos.Add(Recent->Info);
+			continue;
+		}
+		IDsToQuery.Add(ID);
+	}
+	PendingModInfoIDs.Reset();
+	PendingModInfoIDSet.Reset();
+
+	const int32 MaxIDsPerQuery = FMath::Max(Settings->ModInfoBatchMaxIDs, 1);
+	for (int32 ChunkStart = 0; ChunkStart < IDsToQuery.Num(); ChunkStart += MaxIDsPerQuery)
+	{
+		TArray<FModioModID> ChunkIDs(IDsToQuery.GetData() + ChunkStart,
+		                             FMath::Min(MaxIDsPerQuery, IDsToQuery.Num() - ChunkStart));
+		InFlightModInfoIDs.Append(ChunkIDs);
+		INC_DWORD_STAT(STAT_ModioUI_ModInfoQueriesIssued);
+
+		// Bind the list of IDs as an additional parameter so that if we get an error we can report the error for the
+		// specific IDs that were queried
+		DataProvider->ListAllModsAsync(
+			FModioFilterParams().MatchingIDs(ChunkIDs).IndexedResults(0, ChunkIDs.Num()),
+			FOnListAllModsDelegateFast::CreateUObject(this, &UModioUISubsystem::ModInfoRequestCompletedHandler,
+			                                          ChunkIDs));
+	}
+
+	// Broadcast reused results last, as receivers may request more mod info from inside their handlers
+	for (const FModioModInfo& Info : ReusedInfos)
 	{
-		Subsystem->ListModCollectionsAsync(
-			Filter, FOnListModCollectionsDelegateFast::CreateUObject(
-				this, &UModioUISubsystem::ListModCollectionsCompletedHandler,
-				RequestIdentifier));
+		MODIO_UI_BROADCAST(OnModInfoRequestCompleted, Info.ModId, {}, Info);
 	}
 }
 
+void UModioUISubsystem::RequestListAllMods(FModioFilterParams Params, FString RequestIdentifier)
+{
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_RequestIssue);
+
+	DataProvider->ListAllModsAsync(
+		Params, FOnListAllModsDelegateFast::CreateUObject(this, &UModioUISubsystem::ListAllModsCompletedHandler,
+		                                                  RequestIdentifier));
+}
+
+void UModioUISubsystem::RequestListModCollections(const FModioFilterParams& Filter, FString RequestIdentifier)
+{
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_RequestIssue);
+
+	DataProvider->ListModCollectionsAsync(
+		Filter, FOnListModCollectionsDelegateFast::CreateUObject(
+			this, &UModioUISubsystem::ListModCollectionsCompletedHandler, RequestIdentifier));
+}
+
 void UModioUISubsystem::RequestGetModCollectionMods(FModioModCollectionID CollectionID)
 {
-	if (UModioSubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioSubsystem>())
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_RequestIssue);
+
+	if (const FCachedCollectionMods* Cached = CachedCollectionMods.Find(CollectionID))
+	{
+		const bool bStale = FPlatformTime::Seconds() - Cached->FetchTime >
+		                    GetDefault<UModioUISettings>()->CollectionModsMaxAgeSeconds;
+
+		FModioModInfoList ModInfos;
+		ModInfos.InternalList.Reserve(Cached->ModIDs.Num());
+		for (const FModioModID& ModID : Cached->ModIDs)
+		{
+			ModInfos.InternalList.Add(RecentModInfos.FindChecked(ModID).Info);
+		}
+		CollectionModsLRU.Remove(CollectionID);
+		CollectionModsLRU.Add(CollectionID);
+
+		MODIO_UI_BROADCAST(OnGetModCollectionModsRequestCompleted, CollectionID, {}, ModInfos);
+		if (!bStale)
+		{
+			return;
+		}
+	}
+
+	// Everyone receives the result of the request already fetching this collection
+	bool bAlreadyInFlight = false;
+	InFlightCollectionMods.Add(CollectionID, &bAlreadyInFlight);
+	if (bAlreadyInFlight)
 	{
-		Subsystem->GetModCollectionModsAsync(
-			CollectionID, FOnGetModCollectionModsDelegateFast::CreateUObject(
-				this, &UModioUISubsystem::GetModCollectionModsCompletedHandler, CollectionID));
+		return;
 	}
+
+	DataProvider->GetModCollectionModsAsync(
+		CollectionID, FOnGetModCollectionModsDelegateFast::CreateUObject(
+			this, &UModioUISubsystem::GetModCollectionModsCompletedHandler, CollectionID));
 }
 
 void UModioUISubsystem::RequestListAllTokenPacks()
 {
-	if (IOnlineSubsystem* OnlineSubsystem = IOnlineSubsystem::GetByPlatform())
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_RequestIssue);
+
+	if (CachedTokenPacks.IsSet() && FPlatformTime::Seconds() - CachedTokenPacksFetchTime <=
+	                                    GetDefault<UModioUISettings>()->TokenPackCatalogueMaxAgeSeconds)
 	{
-		if (UModioSubsystem* ModioSubsystem = GEngine->GetEngineSubsystem<UModioSubsystem>())
+		ListAllTokenPacksCompletedHandler({}, CachedTokenPacks);
+		return;
+	}
+
+	// The completion is broadcast to every token pack receiver, so a request already in flight answers this one too
+	if (bTokenPacksRequestInFlight)
+	{
+		return;
+	}
+
+	bTokenPacksRequestInFlight = true;
+	DataProvider->ListAllTokenPacksAsync(FOnListAllTokenPacksDelegateFast::CreateUObject(
+		this, &UModioUISubsystem::OnListAllTokenPacksComplete, TokenPacksGeneration));
+}
+
+void UModioUISubsystem::OnListAllTokenPacksComplete(FModioErrorCode ErrorCode,
+                                                    TOptional<FModioTokenPackList> TokenPacks, uint32 Generation)
+{
+	// A catalogue listed before an invalidation is still passed on, but not cached
+	if (Generation == TokenPacksGeneration)
+	{
+		bTokenPacksRequestInFlight = false;
+		if (!ErrorCode && TokenPacks.IsSet())
 		{
-			if (OnlineSubsystem->GetStoreV2Interface().IsValid())
-			{
-				if (OnlineSubsystem->GetIdentityInterface().IsValid())
-				{
-					EModioPortal CurrentPortal = ModioSubsystem->GetCurrentPortal();
-
-					FUniqueNetIdPtr Id = OnlineSubsystem->GetIdentityInterface()->GetUniquePlayerId(0);
-					FOnlineStoreFilter Filter;
-					Filter.IncludeCategories.Add({});
-					FOnQueryOnlineStoreOffersComplete OnQueryOffersComplete;
-
-					OnQueryOffersComplete.BindLambda([this, Id, OnlineSubsystem](bool bWasSuccessful,
-						const TArray<FUniqueOfferId>& OfferIds,
-						const FString& Error) {
-							if (bWasSuccessful && !OfferIds.IsEmpty())
-							{
-								TArray<FModioTokenPack> Offers;
-								for (const FUniqueOfferId& Offer : OfferIds)
-								{
-									// We get the details of the offers from the cache, this is not async
-									Offers.Add(
-										FModioTokenPack(
-											*OnlineSubsystem->GetStoreV2Interface()->GetOffer(Offer).Get()));
-								}
-								FModioTokenPackList OffersList = FModioTokenPackList(Offers);
-								ListAllTokenPacksCompletedHandler(FModioErrorCode(), FModioTokenPackList(Offers));
-							}
-							else
-							{
-								ListAllTokenPacksCompletedHandler(FModioErrorCode::SystemError(), {});
-							}
-						});
-					// This callback is guaranteed
-					OnlineSubsystem->GetStoreV2Interface()->QueryOffersByFilter(*Id.Get(), Filter,
-						OnQueryOffersComplete);
-					return;
-				}
-			}
+			CachedTokenPacks = TokenPacks;
+			CachedTokenPacksFetchTime = FPlatformTime::Seconds();
 		}
 	}
+	ListAllTokenPacksCompletedHandler(ErrorCode, TokenPacks);
+}
 
-	// We failed somewhere, so call the handler with Error
-	ListAllTokenPacksCompletedHandler(FModioErrorCode::SystemError(), {});
+void UModioUISubsystem::InvalidateStoreCaches()
+{
+	CachedTokenPacks.Reset();
+	bTokenPacksRequestInFlight = false;
+	TokenPacksGeneration++;
+
+	const bool bWalletBalanceWasInFlight = bWalletBalanceRequestInFlight;
+	CachedWalletBalance.Reset();
+	bWalletBalanceRequestInFlight = false;
+	WalletBalanceGeneration++;
+
+	// Whoever was waiting on the balance asked for the current user's, so ask again on their behalf
+	if (bWalletBalanceWasInFlight)
+	{
+		RequestWalletBalance({});
+	}
 }
 
 bool UModioUISubsystem::RequestPurchaseTokenPack(FModioTokenPackID TokenPackID,
@@ -670,37 +1302,148 @@ bool UModioUISubsystem::RequestPurchaseTokenPack(FModioTokenPackID TokenPackID,
 void UModioUISubsystem::LogoDownloadHandler(FModioErrorCode ErrorCode, TOptional<FModioImageWrapper> Image,
                                             FModioModID ID, EModioLogoSize LogoSize)
 {
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_RequestCompletion);
+
+	if (EventRecorder)
+	{
+		EventRecorder->RecordMediaCompleted(TEXT("ModLogo"), ErrorCode, Image, ID.ToString(),
+											static_cast<int32>(LogoSize));
+	}
+
 	if (ErrorCode)
 	{
 		UE_LOG(ModioUICore, Error, TEXT("Failed to download logo for mod %s: \"%s\""), *ID.ToString(),
 		       *ErrorCode.GetErrorMessage());
 	}
-	OnModLogoDownloadCompleted.Broadcast(ID, ErrorCode, Image, LogoSize);
+	MODIO_UI_BROADCAST(OnModLogoDownloadCompleted, ID, ErrorCode, Image, LogoSize);
 }
 
 void UModioUISubsystem::UserAvatarDownloadHandler(FModioErrorCode ErrorCode, TOptional<FModioImageWrapper> Image)
 {
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_RequestCompletion);
+
+	if (EventRecorder)
+	{
+		EventRecorder->RecordMediaCompleted(TEXT("UserAvatar"), ErrorCode, Image);
+	}
+
 	if (ErrorCode)
 	{
 		UE_LOG(ModioUICore, Error, TEXT("Failed to download user avatar: \"%s\""), *ErrorCode.GetErrorMessage());
 	}
-	OnUserAvatarDownloadCompleted.Broadcast(ErrorCode, Image);
+	MODIO_UI_BROADCAST(OnUserAvatarDownloadCompleted, ErrorCode, Image);
+
+	if (!ErrorCode && Image.IsSet())
+	{
+		// Decoded once here and shared, rather than by every avatar widget that received the broadcast
+		CachedUserAvatarImage = Image;
+		bUserAvatarRequestInFlight = true;
+		CachedUserAvatarImage->LoadAsync(FOnLoadImageDelegateFast::CreateUObject(
+			this, &UModioUISubsystem::UserAvatarDecodedHandler, UserAvatarGeneration));
+	}
+	else
+	{
+		CompleteUserAvatarCallbacks(ErrorCode ? ErrorCode : FModioErrorCode::SystemError());
+	}
+}
+
+void UModioUISubsystem::UserAvatarDecodedHandler(UTexture2DDynamic* Texture, uint32 Generation)
+{
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_ImageDecode);
+
+	if (Generation != UserAvatarGeneration)
+	{
+		return;
+	}
+
+	CachedUserAvatarTexture = Texture;
+	if (!Texture)
+	{
+		UE_LOG(ModioUICore, Error, TEXT("Failed to decode user avatar"));
+		CachedUserAvatarImage.Reset();
+	}
+	CompleteUserAvatarCallbacks(Texture ? FModioErrorCode() : FModioErrorCode::SystemError());
+}
+
+void UModioUISubsystem::CompleteUserAvatarCallbacks(FModioErrorCode ErrorCode)
+{
+	bUserAvatarRequestInFlight = false;
+
+	TArray<FOnUserAvatarTextureReadyFast> Callbacks = MoveTemp(PendingUserAvatarCallbacks);
+	for (FOnUserAvatarTextureReadyFast& Callback : Callbacks)
+	{
+		Callback.ExecuteIfBound(ErrorCode, CachedUserAvatarTexture);
+	}
 }
 
 void UModioUISubsystem::RequestUserAvatar()
 {
-	if (UModioSubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioSubsystem>())
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_RequestIssue);
+
+	// Every receiver is notified when the in-flight request completes
+	if (bUserAvatarRequestInFlight)
+	{
+		return;
+	}
+	if (CachedUserAvatarImage.IsSet())
+	{
+		MODIO_UI_BROADCAST(OnUserAvatarDownloadCompleted, FModioErrorCode(), CachedUserAvatarImage);
+		return;
+	}
+
+	bUserAvatarRequestInFlight = true;
+	DataProvider->GetUserAvatarAsync(
+		EModioAvatarSize::Thumb100,
+		FOnGetMediaDelegateFast::CreateWeakLambda(
+			this, [this, Generation = UserAvatarGeneration](FModioErrorCode ErrorCode,
+			                                                 TOptional<FModioImageWrapper> Image) {
+				if (Generation == UserAvatarGeneration)
+				{
+					UserAvatarDownloadHandler(ErrorCode, Image);
+				}
+			}));
+}
+
+void UModioUISubsystem::GetCurrentUserAvatarAsync(FOnUserAvatarTextureReadyFast Callback)
+{
+	if (CachedUserAvatarTexture)
+	{
+		Callback.ExecuteIfBound({}, CachedUserAvatarTexture);
+		return;
+	}
+
+	PendingUserAvatarCallbacks.Add(MoveTemp(Callback));
+	RequestUserAvatar();
+}
+
+UTexture2DDynamic* UModioUISubsystem::GetCachedUserAvatar() const
+{
+	return CachedUserAvatarTexture;
+}
+
+TOptional<FModioImageWrapper> UModioUISubsystem::GetCachedUserAvatarImage() const
+{
+	return CachedUserAvatarImage;
+}
+
+void UModioUISubsystem::InvalidateUserAvatar()
+{
+	CachedUserAvatarTexture = nullptr;
+	CachedUserAvatarImage.Reset();
+	bUserAvatarRequestInFlight = false;
+	UserAvatarGeneration++;
+
+	// Widgets still waiting were asking for the current user's avatar, so answer them with the new user's
+	if (PendingUserAvatarCallbacks.Num())
 	{
-		Subsystem->GetUserMediaAsync(
-			EModioAvatarSize::Thumb100,
-			FOnGetMediaDelegateFast::CreateUObject(this, &UModioUISubsystem::UserAvatarDownloadHandler));
+		RequestUserAvatar();
 	}
 }
 
 void UModioUISubsystem::RequestEmailAuthenticationWithHandler(FModioEmailAuthCode Code,
                                                               const FOnErrorOnlyDelegate Callback)
 {
-	OnAuthenticationChangeStarted.Broadcast();
+	MODIO_UI_BROADCAST(OnAuthenticationChangeStarted);
 
 	if (UModioSubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioSubsystem>())
 	{
@@ -717,58 +1460,86 @@ void UModioUISubsystem::RequestEmailAuthenticationWithHandler(FModioEmailAuthCod
 void UModioUISubsystem::RequestGalleryImageDownloadForModID(
 	FModioModID ID, int32 Index, EModioGallerySize ImageSize /*= EModioGallerySize::Original*/)
 {
-	if (UModioSubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioSubsystem>())
-	{
-		Subsystem->GetModMediaAsync(
-			ID, ImageSize, Index,
-			FOnGetMediaDelegateFast::CreateUObject(this, &UModioUISubsystem::GalleryImageDownloadHandler, ID, Index));
-	}
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_RequestIssue);
+
+	DataProvider->GetModGalleryImageAsync(
+		ID, ImageSize, Index,
+		FOnGetMediaDelegateFast::CreateUObject(this, &UModioUISubsystem::GalleryImageDownloadHandler, ID, Index));
 }
 
 void UModioUISubsystem::GalleryImageDownloadHandler(FModioErrorCode ErrorCode, TOptional<FModioImageWrapper> Image,
                                                     FModioModID ID, int32 Index)
 {
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_RequestCompletion);
+
+	if (EventRecorder)
+	{
+		EventRecorder->RecordMediaCompleted(TEXT("GalleryImage"), ErrorCode, Image, ID.ToString(), Index);
+	}
+
 	if (ErrorCode)
 	{
 		UE_LOG(ModioUICore, Error, TEXT("Failed to download gallery image for mod %s: \"%s\""), *ID.ToString(),
 		       *ErrorCode.GetErrorMessage());
 	}
-	OnModGalleryImageDownloadCompleted.Broadcast(ID, ErrorCode, Index, Image);
+	MODIO_UI_BROADCAST(OnModGalleryImageDownloadCompleted, ID, ErrorCode, Index, Image);
 }
 
 void UModioUISubsystem::CreatorAvatarDownloadHandler(FModioErrorCode ErrorCode, TOptional<FModioImageWrapper> Image,
                                                      FModioModID ID)
 {
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_RequestCompletion);
+
+	if (EventRecorder)
+	{
+		EventRecorder->RecordMediaCompleted(TEXT("CreatorAvatar"), ErrorCode, Image, ID.ToString());
+	}
+
 	if (ErrorCode)
 	{
 		UE_LOG(ModioUICore, Error, TEXT("Failed to download creator avatar for mod %s: \"%s\""), *ID.ToString(),
 		       *ErrorCode.GetErrorMessage());
 	}
-	OnModCreatorAvatarDownloadCompleted.Broadcast(ID, ErrorCode, Image);
+	MODIO_UI_BROADCAST(OnModCreatorAvatarDownloadCompleted, ID, ErrorCode, Image);
 }
 
 void UModioUISubsystem::ModCollectionLogoDownloadHandler(FModioErrorCode ErrorCode, TOptional<FModioImageWrapper> Image,
                                                          FModioModCollectionID ID, EModioLogoSize LogoSize)
 {
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_RequestCompletion);
+
+	if (EventRecorder)
+	{
+		EventRecorder->RecordMediaCompleted(TEXT("ModCollectionLogo"), ErrorCode, Image, ID.ToString(),
+		                                    static_cast<int32>(LogoSize));
+	}
+
 	if (ErrorCode)
 	{
 		UE_LOG(ModioUICore, Error, TEXT("Failed to download logo for mod collection %s: \"%s\""), *ID.ToString(),
 		       *ErrorCode.GetErrorMessage());
 	}
-	OnModCollectionLogoDownloadCompleted.Broadcast(ID, ErrorCode, Image, LogoSize);
+	MODIO_UI_BROADCAST(OnModCollectionLogoDownloadCompleted, ID, ErrorCode, Image, LogoSize);
 }
 
 void UModioUISubsystem::ModCollectionCuratorAvatarDownloadHandler(FModioErrorCode ErrorCode,
                                                                   TOptional<FModioImageWrapper> Image,
                                                                   FModioModCollectionID ID)
 {
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_RequestCompletion);
+
+	if (EventRecorder)
+	{
+		EventRecorder->RecordMediaCompleted(TEXT("CuratorAvatar"), ErrorCode, Image, ID.ToString());
+	}
+
 	if (ErrorCode)
 	{
 		UE_LOG(ModioUICore, Error, TEXT("Failed to download curator avatar for mod collection %s: \"%s\""),
 		       *ID.ToString(),
 		       *ErrorCode.GetErrorMessage());
 	}
-	OnModCollectionCuratorAvatarDownloadCompleted.Broadcast(ID, ErrorCode, Image);
+	MODIO_UI_BROADCAST(OnModCollectionCuratorAvatarDownloadCompleted, ID, ErrorCode, Image);
 }
 
 void UModioUISubsystem::OnAuthenticationComplete(FModioErrorCode ErrorCode)
@@ -777,8 +1548,12 @@ void UModioUISubsystem::OnAuthenticationComplete(FModioErrorCode ErrorCode)
 	{
 		if (UModioSubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioSubsystem>())
 		{
+			InvalidateFollowedModCollections();
+			InvalidateUserAvatar();
+			InvalidateStoreCaches();
 			TOptional<FModioUser> NewUser = Subsystem->QueryUserProfile();
-			OnUserChanged.Broadcast(NewUser);
+			LoadPersistedRatings(NewUser.IsSet() ? NewUser->UserId.ToString() : FString());
+			MODIO_UI_BROADCAST(OnUserChanged, NewUser);
 		}
 	}
 	else
@@ -790,19 +1565,39 @@ void UModioUISubsystem::OnAuthenticationComplete(FModioErrorCode ErrorCode)
 void UModioUISubsystem::ModInfoRequestCompletedHandler(FModioErrorCode ErrorCode, TOptional<FModioModInfoList> ModInfos,
                                                        TArray<FModioModID> IDs)
 {
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_RequestCompletion);
+
+	for (const FModioModID& ID : IDs)
+	{
+		InFlightModInfoIDs.Remove(ID);
+	}
+
 	if (ErrorCode)
 	{
 		// Got an error, notify anybody that the specified IDs got errors when requesting mod info
 		for (FModioModID& ID : IDs)
 		{
-			OnModInfoRequestCompleted.Broadcast(ID, ErrorCode, {});
+			MODIO_UI_BROADCAST(OnModInfoRequestCompleted, ID, ErrorCode, {});
 		}
 	}
 	else
 	{
+		const double Now = FPlatformTime::Seconds();
+		const bool bReuseResults = GetDefault<UModioUISettings>()->ModInfoReuseSeconds > 0.0f;
 		for (FModioModInfo Info : ModInfos.GetValue().GetRawList())
 		{
-			OnModInfoRequestCompleted.Broadcast(Info.ModId, {}, Info);
+			// Entries held by cached collections are always updated, so that they show the latest info for their mods
+			FRecentModInfo* Recent = RecentModInfos.Find(Info.ModId);
+			if (!Recent && bReuseResults)
+			{
+				Recent = &RecentModInfos.Add(Info.ModId);
+			}
+			if (Recent)
+			{
+				Recent->Info = Info;
+				Recent->FetchTime = Now;
+			}
+			MODIO_UI_BROADCAST(OnModInfoRequestCompleted, Info.ModId, {}, Info);
 		}
 	}
 }
@@ -811,19 +1606,21 @@ void UModioUISubsystem::ModCollectionInfoRequestCompletedHandler(FModioErrorCode
                                                                  TOptional<FModioModCollectionInfoList>
                                                                  ModCollectionInfos, TArray<FModioModCollectionID> IDs)
 {
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_RequestCompletion);
+
 	if (ErrorCode)
 	{
 		// Got an error, notify anybody that the specified IDs got errors when requesting mod collection info
 		for (FModioModCollectionID& ID : IDs)
 		{
-			OnModCollectionInfoRequestCompleted.Broadcast(ID, ErrorCode, {});
+			MODIO_UI_BROADCAST(OnModCollectionInfoRequestCompleted, ID, ErrorCode, {});
 		}
 	}
 	else
 	{
 		for (FModioModCollectionInfo Info : ModCollectionInfos.GetValue().GetRawList())
 		{
-			OnModCollectionInfoRequestCompleted.Broadcast(Info.Id, {}, Info);
+			MODIO_UI_BROADCAST(OnModCollectionInfoRequestCompleted, Info.Id, {}, Info);
 		}
 	}
 }
@@ -831,40 +1628,118 @@ void UModioUISubsystem::ModCollectionInfoRequestCompletedHandler(FModioErrorCode
 void UModioUISubsystem::ListAllModsCompletedHandler(FModioErrorCode ErrorCode, TOptional<FModioModInfoList> ModInfos,
                                                     FString RequestIdentifier)
 {
-	OnListAllModsRequestCompleted.Broadcast(RequestIdentifier, ErrorCode, ModInfos);
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_RequestCompletion);
+
+	if (EventRecorder)
+	{
+		EventRecorder->RecordListAllMods(ErrorCode, ModInfos, RequestIdentifier);
+	}
+
+	MODIO_UI_BROADCAST(OnListAllModsRequestCompleted, RequestIdentifier, ErrorCode, ModInfos);
 }
 
 void UModioUISubsystem::ListModCollectionsCompletedHandler(FModioErrorCode ErrorCode,
                                                            TOptional<FModioModCollectionInfoList> ModCollectionInfos,
                                                            FString RequestIdentifier)
 {
-	OnListModCollectionsRequestCompleted.Broadcast(RequestIdentifier, ErrorCode, ModCollectionInfos);
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_RequestCompletion);
+
+	MODIO_UI_BROADCAST(OnListModCollectionsRequestCompleted, RequestIdentifier, ErrorCode, ModCollectionInfos);
 }
 
 void UModioUISubsystem::GetModCollectionModsCompletedHandler(FModioErrorCode ErrorCode,
                                                              TOptional<FModioModInfoList> ModInfos,
                                                              FModioModCollectionID CollectionID)
 {
-	OnGetModCollectionModsRequestCompleted.Broadcast(CollectionID, ErrorCode, ModInfos);
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_RequestCompletion);
+
+	InFlightCollectionMods.Remove(CollectionID);
+	if (!ErrorCode && ModInfos.IsSet())
+	{
+		CacheCollectionMods(CollectionID, ModInfos.GetValue());
+	}
+
+	MODIO_UI_BROADCAST(OnGetModCollectionModsRequestCompleted, CollectionID, ErrorCode, ModInfos);
+}
+
+void UModioUISubsystem::CacheCollectionMods(FModioModCollectionID CollectionID, const FModioModInfoList& ModInfos)
+{
+	const int32 CacheSize = GetDefault<UModioUISettings>()->CollectionModsCacheSize;
+	if (CacheSize <= 0)
+	{
+		return;
+	}
+
+	// Release the previous list's hold on its mods before taking one on the new list's
+	EvictCollectionMods(CollectionID);
+
+	FCachedCollectionMods& Cached = CachedCollectionMods.Add(CollectionID);
+	Cached.FetchTime = FPlatformTime::Seconds();
+	Cached.ModIDs.Reserve(ModInfos.GetRawList().Num());
+	for (const FModioModInfo& Info : ModInfos.GetRawList())
+	{
+		Cached.ModIDs.Add(Info.ModId);
+		FRecentModInfo& Recent = RecentModInfos.FindOrAdd(Info.ModId);
+		Recent.Info = Info;
+		Recent.FetchTime = Cached.FetchTime;
+		Recent.NumCollections++;
+	}
+	CollectionModsLRU.Add(CollectionID);
+
+	while (CollectionModsLRU.Num() > CacheSize)
+	{
+		EvictCollectionMods(CollectionModsLRU[0]);
+	}
+}
+
+void UModioUISubsystem::EvictCollectionMods(FModioModCollectionID CollectionID)
+{
+	FCachedCollectionMods Evicted;
+	if (!CachedCollectionMods.RemoveAndCopyValue(CollectionID, Evicted))
+	{
+		return;
+	}
+
+	CollectionModsLRU.Remove(CollectionID);
+	for (const FModioModID& ModID : Evicted.ModIDs)
+	{
+		// Left in place once unreferenced, as it may still answer mod info requests; FlushModInfoBatch expires it
+		if (FRecentModInfo* Recent = RecentModInfos.Find(ModID))
+		{
+			Recent->NumCollections = FMath::Max(Recent->NumCollections - 1, 0);
+		}
+	}
+}
+
+void UModioUISubsystem::ResetCollectionModsCache()
+{
+	CachedCollectionMods.Reset();
+	CollectionModsLRU.Reset();
+	for (TPair<FModioModID, FRecentModInfo>& Recent : RecentModInfos)
+	{
+		Recent.Value.NumCollections = 0;
+	}
 }
 
 void UModioUISubsystem::TokenPackRequestCompletedHandler(FModioErrorCode ErrorCode,
                                                          TOptional<FModioTokenPackList> TokenPacks,
                                                          TArray<FModioTokenPackID> IDs)
 {
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_RequestCompletion);
+
 	if (ErrorCode)
 	{
 		// Got an error, notify anybody that the specified IDs got errors when requesting mod info
 		for (FModioTokenPackID& ID : IDs)
 		{
-			OnTokenPackRequestCompleted.Broadcast(ID, ErrorCode, {});
+			MODIO_UI_BROADCAST(OnTokenPackRequestCompleted, ID, ErrorCode, {});
 		}
 	}
 	else
 	{
 		for (FModioTokenPack Pack : TokenPacks.GetValue().GetRawList())
 		{
-			OnTokenPackRequestCompleted.Broadcast(Pack.GetId(), {}, Pack);
+			MODIO_UI_BROADCAST(OnTokenPackRequestCompleted, Pack.GetId(), {}, Pack);
 		}
 	}
 }
@@ -872,14 +1747,19 @@ void UModioUISubsystem::TokenPackRequestCompletedHandler(FModioErrorCode ErrorCo
 void UModioUISubsystem::ListAllTokenPacksCompletedHandler(FModioErrorCode ErrorCode,
                                                           TOptional<FModioTokenPackList> TokenPacks)
 {
-	OnListAllTokenPacksRequestCompleted.Broadcast(ErrorCode, TokenPacks);
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_RequestCompletion);
+
+	MODIO_UI_BROADCAST(OnListAllTokenPacksRequestCompleted, ErrorCode, TokenPacks);
 }
 
 void UModioUISubsystem::LogOut(FOnErrorOnlyDelegateFast DedicatedCallback)
 {
 	if (UModioSubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioSubsystem>())
 	{
-		OnAuthenticationChangeStarted.Broadcast();
+		MODIO_UI_BROADCAST(OnAuthenticationChangeStarted);
+
+		// Ratings still settling belong to the user being logged out, so send them while they still can be
+		FlushRatingSubmissions(true);
 
 		Subsystem->ClearUserDataAsync(FOnErrorOnlyDelegateFast::CreateLambda(
 			[HookedHandler = FOnErrorOnlyDelegateFast::CreateUObject(this, &UModioUISubsystem::OnLogoutComplete),
@@ -894,7 +1774,11 @@ void UModioUISubsystem::OnLogoutComplete(FModioErrorCode ErrorCode)
 {
 	if (!ErrorCode)
 	{
-		OnUserChanged.Broadcast({});
+		InvalidateFollowedModCollections();
+		InvalidateUserAvatar();
+		InvalidateStoreCaches();
+		LoadPersistedRatings(FString());
+		MODIO_UI_BROADCAST(OnUserChanged, {});
 	}
 	else
 	{
@@ -907,37 +1791,386 @@ TOptional<FModioModTagOptions> UModioUISubsystem::GetTagOptionsList()
 	return CachedModTags;
 }
 
+UModioModTagUI* UModioUISubsystem::GetSharedModTag(const FString& Tag, const FText& LocalizedText)
+{
+	UModioSubsystem* ModioSubsystem = GEngine->GetEngineSubsystem<UModioSubsystem>();
+	const EModioLanguage Language = ModioSubsystem ? ModioSubsystem->GetLanguage() : EModioLanguage::English;
+	const TPair<FString, EModioLanguage> Key(Tag, Language);
+	if (UModioModTagUI* const* SharedTag = SharedModTags.Find(Key))
+	{
+		if (!LocalizedText.IsEmpty() && SharedModTagsWithFallbackText.Remove(Key) > 0)
+		{
+			(*SharedTag)->LocalizedText = LocalizedText;
+		}
+		return *SharedTag;
+	}
+
+	UModioModTagUI* NewTag = NewObject<UModioModTagUI>(this);
+	NewTag->Underlying = Tag;
+	NewTag->bSelectionState = false;
+	NewTag->bShared = true;
+	NewTag->LocalizedText = LocalizedText;
+	bool bHasLocalizedText = !LocalizedText.IsEmpty();
+
+	// Translations configured for the game take precedence over whatever text the caller had to hand
+	if (CachedModTags.IsSet())
+	{
+		const FString LanguageCode = UModioSDKLibrary::GetLanguageCodeString(Language);
+		for (const FModioModTagInfo& Category : UModioModTagOptionsLibrary::GetTags(CachedModTags.GetValue()))
+		{
+			const FModioModTagLocalizationData* LocalizationData = Category.TagGroupValueLocalizationData.FindByPredicate(
+				[&Tag](const FModioModTagLocalizationData& Data) { return Data.Tag == Tag; });
+			if (const FText* Translation = LocalizationData ? LocalizationData->Translations.Find(LanguageCode) : nullptr)
+			{
+				NewTag->LocalizedText = *Translation;
+				bHasLocalizedText = true;
+				break;
+			}
+		}
+	}
+
+	// The raw string is only a placeholder, so it is not allowed to stand in for the localized text for good
+	if (!bHasLocalizedText)
+	{
+		NewTag->LocalizedText = FText::FromString(Tag);
+		SharedModTagsWithFallbackText.Add(Key);
+	}
+
+	SharedModTagObjects.Add(NewTag);
+	SharedModTags.Add(Key, NewTag);
+	return NewTag;
+}
+
+void UModioUISubsystem::ResetSharedModTags()
+{
+	SharedModTagObjects.Reset();
+	SharedModTags.Reset();
+	SharedModTagsWithFallbackText.Reset();
+}
+
+bool UModioUISubsystem::StartEventRecording(const FString& Path)
+{
+	EventRecorder = FModioUIEventRecorder::Create(Path);
+	return EventRecorder.IsValid();
+}
+
+void UModioUISubsystem::StopEventRecording()
+{
+	EventRecorder.Reset();
+}
+
+bool UModioUISubsystem::IsRecordingEvents() const
+{
+	return EventRecorder.IsValid();
+}
+
+void UModioUISubsystem::PreloadUIAssets(const TArray<FSoftObjectPath>& AdditionalAssets, FSimpleDelegate OnComplete)
+{
+	const UModioUISettings* Settings = GetDefault<UModioUISettings>();
+
+	TArray<FSoftObjectPath> Assets = {ModioUI::AssetPaths::GetUiColorsTablePath(),
+	                                  ModioUI::AssetPaths::GetUiCommandsTablePath(),
+	                                  ModioUI::AssetPaths::GetUnderlineMaterialPath(),
+	                                  ModioUI::AssetPaths::GetFakeCaretMaterialPath()};
+	for (const TSoftClassPtr<UUserWidget>& WidgetClass : Settings->PreloadWidgetClasses)
+	{
+		Assets.Add(WidgetClass.ToSoftObjectPath());
+	}
+	Assets.Append(Settings->PreloadAssets);
+	Assets.Append(AdditionalAssets);
+	RequestUIPreload(MoveTemp(Assets), true, OnComplete);
+}
+
+void UModioUISubsystem::RequestUIPreload(TArray<FSoftObjectPath> Assets, bool bFollowSoftReferences,
+                                         FSimpleDelegate OnComplete)
+{
+	Assets.RemoveAll([](const FSoftObjectPath& Path) { return Path.IsNull(); });
+
+	bool bAnyNewAssets = false;
+	for (const FSoftObjectPath& Path : Assets)
+	{
+		bool bAlreadyInManifest = false;
+		UIPreloadManifest.Add(Path, &bAlreadyInManifest);
+		bAnyNewAssets |= !bAlreadyInManifest;
+	}
+
+	// Requesting assets that are already loaded or loading is cheap, and means OnComplete waits for in-flight loads
+	NumUIPreloadsInFlight++;
+	TSharedPtr<FStreamableHandle> Handle = UIAssetStreamer.RequestAsyncLoad(
+		Assets, FStreamableDelegate::CreateUObject(this, &UModioUISubsystem::OnUIPreloadCompleted, Assets,
+		                                           bFollowSoftReferences, FPlatformTime::Seconds(), OnComplete));
+	// Earlier handles already keep the rest of the manifest resident
+	if (Handle.IsValid() && bAnyNewAssets)
+	{
+		UIPreloadHandles.Add(Handle);
+	}
+}
+
+void UModioUISubsystem::PreloadWidgetClasses(const TArray<TSoftClassPtr<UUserWidget>>& WidgetClasses)
+{
+	TArray<FSoftObjectPath> Assets;
+	for (const TSoftClassPtr<UUserWidget>& WidgetClass : WidgetClasses)
+	{
+		Assets.Add(WidgetClass.ToSoftObjectPath());
+	}
+	PreloadUIAssets(Assets);
+}
+
+TArray<FSoftObjectPath> UModioUISubsystem::GetUIPreloadManifest() const
+{
+	return UIPreloadManifest.Array();
+}
+
+bool UModioUISubsystem::IsUIPreloadInProgress() const
+{
+	return NumUIPreloadsInFlight > 0;
+}
+
+void UModioUISubsystem::OnUIPreloadCompleted(TArray<FSoftObjectPath> Assets, bool bFollowSoftReferences,
+                                             double StartTime, FSimpleDelegate OnComplete)
+{
+	NumUIPreloadsInFlight--;
+	UE_LOG(ModioUICore, Verbose, TEXT("Preloaded %d UI assets in %.3fs"), Assets.Num(),
+	       FPlatformTime::Seconds() - StartTime);
+
+	// Loading a widget class only pulls in its hard references, so follow its soft ones too. Only for the manifest's
+	// own entries, as following references transitively would make the whole soft reference graph resident
+	TArray<FSoftObjectPath> References;
+	if (bFollowSoftReferences)
+	{
+		for (const FSoftObjectPath& Path : Assets)
+		{
+			if (UClass* LoadedClass = Cast<UClass>(Path.ResolveObject()))
+			{
+				if (const UObject* ClassDefaults = LoadedClass->GetDefaultObject(false))
+				{
+					CollectSoftReferences(*ClassDefaults, References);
+				}
+				ForEachObjectWithOuter(
+					LoadedClass, [&References](UObject* Inner) { CollectSoftReferences(*Inner, References); }, true);
+			}
+		}
+	}
+	References.RemoveAll([this](const FSoftObjectPath& Path) {
+		return Path.IsNull() || UIPreloadManifest.Contains(Path);
+	});
+
+	if (References.Num() > 0)
+	{
+		RequestUIPreload(MoveTemp(References), false, OnComplete);
+		return;
+	}
+
+	if (NumUIPreloadsInFlight == 0)
+	{
+		const TArray<FSoftObjectPath> SynchronousLoads = ModioUI::GetSynchronousUILoads();
+		UE_LOG(ModioUICore, Log, TEXT("UI preload finished with %d assets in the manifest; %d were loaded synchronously "
+		                              "before they were preloaded (see Modio.UIPreloadReport)"),
+		       UIPreloadManifest.Num(), SynchronousLoads.Num());
+	}
+	OnComplete.ExecuteIfBound();
+}
+
+void UModioUISubsystem::CollectSoftReferences(const UObject& Object, TArray<FSoftObjectPath>& OutReferences)
+{
+	for (TPropertyValueIterator<FProperty> It(Object.GetClass(), &Object); It; ++It)
+	{
+		if (CastField<FSoftObjectProperty>(It.Key()))
+		{
+			OutReferences.Add(static_cast<const FSoftObjectPtr*>(It.Value())->ToSoftObjectPath());
+		}
+		else if (const FStructProperty* StructProperty = CastField<FStructProperty>(It.Key()))
+		{
+			if (StructProperty->Struct->IsChildOf(TBaseStructure<FSoftObjectPath>::Get()))
+			{
+				OutReferences.Add(*static_cast<const FSoftObjectPath*>(It.Value()));
+				It.SkipRecursiveProperty();
+			}
+		}
+	}
+}
+
 void UModioUISubsystem::GetTagOptionsListAsync()
 {
-	if (UModioSubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioSubsystem>())
+	GetTagOptionsListAsync(FOnGetModTagOptionsDelegateFast());
+}
+
+void UModioUISubsystem::GetTagOptionsListAsync(FOnGetModTagOptionsDelegateFast Callback)
+{
+	if (CachedModTags.IsSet())
+	{
+		const double AgeSeconds = (FDateTime::UtcNow() - CachedModTagsFetchTime).GetTotalSeconds();
+		if (AgeSeconds > GetDefault<UModioUISettings>()->TagOptionsMaxAgeSeconds && !bTagOptionsRequestInFlight)
+		{
+			RequestTagOptionsFromProvider();
+		}
+		Callback.ExecuteIfBound(FModioErrorCode(), CachedModTags);
+		return;
+	}
+
+	if (Callback.IsBound())
+	{
+		PendingTagOptionsCallbacks.Add(MoveTemp(Callback));
+	}
+	if (!bTagOptionsRequestInFlight)
+	{
+		RequestTagOptionsFromProvider();
+	}
+}
+
+void UModioUISubsystem::RequestTagOptionsFromProvider()
+{
+	bTagOptionsRequestInFlight = true;
+	DataProvider->GetModTagOptionsAsync(FOnGetModTagOptionsDelegateFast::CreateUObject(
+		this, &UModioUISubsystem::OnGetModTagOptionsComplete, TagOptionsGeneration));
+}
+
+bool UModioUISubsystem::ShouldPersistTagOptions() const
+{
+	return GetDefault<UModioUISettings>()->bPersistTagOptions && DataProvider &&
+	       DataProvider->GetClass() == UModioUIDataProvider::StaticClass();
+}
+
+FString UModioUISubsystem::GetPersistedTagOptionsPath() const
+{
+	return FPaths::ProjectSavedDir() / TEXT("ModioUI") / TEXT("TagOptionsCache.bin");
+}
+
+namespace ModioUISubsystem
+{
+	// Bump whenever the layout of the persisted tag options file changes
+	constexpr int32 PersistedTagOptionsVersion = 1;
+
+	TArray<uint8> SerializeTagOptions(FModioModTagOptions& Options)
+	{
+		TArray<uint8> Bytes;
+		FMemoryWriter Writer(Bytes);
+		FObjectAndNameAsStringProxyArchive Archive(Writer, false);
+		FModioModTagOptions::StaticStruct()->SerializeItem(Archive, &Options, nullptr);
+		return Bytes;
+	}
+} // namespace ModioUISubsystem
+
+void UModioUISubsystem::LoadPersistedTagOptions()
+{
+	TArray<uint8> FileBytes;
+	if (CachedModTags.IsSet() || !ShouldPersistTagOptions() ||
+	    !FFileHelper::LoadFileToArray(FileBytes, *GetPersistedTagOptionsPath(), FILEREAD_Silent))
+	{
+		return;
+	}
+
+	FMemoryReader Reader(FileBytes);
+	int32 Version = 0;
+	int64 FetchTimeTicks = 0;
+	Reader << Version;
+	if (Version != ModioUISubsystem::PersistedTagOptionsVersion)
+	{
+		return;
+	}
+	Reader << FetchTimeTicks;
+
+	FObjectAndNameAsStringProxyArchive Archive(Reader, false);
+	FModioModTagOptions Options;
+	FModioModTagOptions::StaticStruct()->SerializeItem(Archive, &Options, nullptr);
+	if (Reader.IsError())
 	{
-		Subsystem->GetModTagOptionsAsync(
-			FOnGetModTagOptionsDelegateFast::CreateUObject(this, &UModioUISubsystem::OnGetModTagOptionsComplete));
+		UE_LOG(ModioUICore, Warning, TEXT("Discarding unreadable persisted mod tag options"));
+		return;
+	}
+
+	const TArray<uint8> SerializedTags = ModioUISubsystem::SerializeTagOptions(Options);
+	CachedModTagsHash = FCrc::MemCrc32(SerializedTags.GetData(), SerializedTags.Num());
+	CachedModTagsFetchTime = FDateTime(FetchTimeTicks);
+	CachedModTags = MoveTemp(Options);
+	ResetSharedModTags();
+}
+
+void UModioUISubsystem::PersistTagOptions() const
+{
+	if (!CachedModTags.IsSet() || !ShouldPersistTagOptions())
+	{
+		return;
+	}
+
+	TArray<uint8> FileBytes;
+	FMemoryWriter Writer(FileBytes);
+	int32 Version = ModioUISubsystem::PersistedTagOptionsVersion;
+	int64 FetchTimeTicks = CachedModTagsFetchTime.GetTicks();
+	Writer << Version;
+	Writer << FetchTimeTicks;
+
+	FObjectAndNameAsStringProxyArchive Archive(Writer, false);
+	FModioModTagOptions Options = CachedModTags.GetValue();
+	FModioModTagOptions::StaticStruct()->SerializeItem(Archive, &Options, nullptr);
+
+	if (!FFileHelper::SaveArrayToFile(FileBytes, *GetPersistedTagOptionsPath()))
+	{
+		UE_LOG(ModioUICore, Warning, TEXT("Failed to persist mod tag options to %s"), *GetPersistedTagOptionsPath());
 	}
 }
 
 void UModioUISubsystem::ModManagementEventHandler(FModioModManagementEvent Event)
 {
-	OnModManagementEvent.Broadcast(Event);
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_RequestCompletion);
+
+	if (EventRecorder)
+	{
+		EventRecorder->RecordModManagementEvent(Event);
+	}
+
+	MODIO_UI_BROADCAST(OnModManagementEvent, Event);
 }
 
-void UModioUISubsystem::OnGetModTagOptionsComplete(FModioErrorCode ErrorCode, TOptional<FModioModTagOptions> ModTags)
+void UModioUISubsystem::OnGetModTagOptionsComplete(FModioErrorCode ErrorCode, TOptional<FModioModTagOptions> ModTags,
+                                                   uint32 Generation)
 {
-	if (!ErrorCode)
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_RequestCompletion);
+
+	// Answered by a provider that has since been replaced
+	if (Generation != TagOptionsGeneration)
+	{
+		return;
+	}
+	bTagOptionsRequestInFlight = false;
+
+	if (!ErrorCode && ModTags.IsSet())
 	{
-		CachedModTags = ModTags;
+		// mod.io does not expose a version for tag options, so the content itself is hashed to detect changes
+		const TArray<uint8> SerializedTags = ModioUISubsystem::SerializeTagOptions(ModTags.GetValue());
+		const uint32 NewHash = FCrc::MemCrc32(SerializedTags.GetData(), SerializedTags.Num());
+		const bool bChanged = !CachedModTags.IsSet() || NewHash != CachedModTagsHash;
+
+		CachedModTagsFetchTime = FDateTime::UtcNow();
+		if (bChanged)
+		{
+			CachedModTags = MoveTemp(ModTags);
+			CachedModTagsHash = NewHash;
+			ResetSharedModTags();
+		}
+		PersistTagOptions();
 	}
 	else
 	{
 		UE_LOG(ModioUICore, Error, TEXT("Failed to get mod tag options: \"%s\""), *ErrorCode.GetErrorMessage());
 	}
+
+	// A failed revalidation still leaves the previously cached options usable
+	const FModioErrorCode CallbackErrorCode = CachedModTags.IsSet() ? FModioErrorCode() : ErrorCode;
+	TArray<FOnGetModTagOptionsDelegateFast> Callbacks = MoveTemp(PendingTagOptionsCallbacks);
+	for (FOnGetModTagOptionsDelegateFast& Callback : Callbacks)
+	{
+		Callback.ExecuteIfBound(CallbackErrorCode, CachedModTags);
+	}
 }
 
 void UModioUISubsystem::WalletBalanceRequestHandler(FModioErrorCode ErrorCode, TOptional<uint64> Balance)
 {
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_RequestCompletion);
+
 	if (!ErrorCode)
 	{
-		OnGetUserWalletBalanceRequestCompleted.Broadcast(Balance.GetValue());
+		MODIO_UI_BROADCAST(OnGetUserWalletBalanceRequestCompleted, Balance.GetValue());
 	}
 	else
 	{
@@ -959,6 +2192,7 @@ void UModioUISubsystem::SetModCollectionRatingStateDataProvider(
 
 EModioRating UModioUISubsystem::NativeQueryModRating(int64 ModID)
 {
+	ResolveRatingsUser();
 	if (ModRatingMap.Contains(ModID))
 	{
 		return ModRatingMap[ModID];
@@ -969,20 +2203,15 @@ EModioRating UModioUISubsystem::NativeQueryModRating(int64 ModID)
 
 bool UModioUISubsystem::NativeRequestModCollectionRatingChange(int64 CollectionID, EModioRating NewRating)
 {
-	if (ModCollectionRatingMap.Contains(CollectionID))
-	{
-		ModCollectionRatingMap[CollectionID] = NewRating;
-	}
-	else
-	{
-		ModCollectionRatingMap.Add(CollectionID, NewRating);
-	}
-
+	ResolveRatingsUser();
+	SetLocalRating(true, CollectionID, NewRating);
+	SetConfirmedRating(true, CollectionID, NewRating);
 	return true;
 }
 
 EModioRating UModioUISubsystem::NativeQueryModCollectionRating(int64 ModCollectionID)
 {
+	ResolveRatingsUser();
 	if (ModCollectionRatingMap.Contains(ModCollectionID))
 	{
 		return ModCollectionRatingMap[ModCollectionID];
@@ -1074,8 +2303,11 @@ EModioOpenStoreResult UModioUISubsystem::RequestShowTokenPurchaseUIWithHandler(
 
 void UModioUISubsystem::RequestRefreshEntitlements()
 {
+	// Consumed entitlements may have credited the wallet or changed the offers available
+	InvalidateStoreCaches();
+
 	#if !WITH_EDITOR // Only do this in a build: editor context does not have Online Subsystems
-	OnEntitlementRefreshEvent.Broadcast();
+	MODIO_UI_BROADCAST(OnEntitlementRefreshEvent);
 	#endif
 }
 
@@ -1182,71 +2414,138 @@ void UModioUISubsystem::RequestUnsubscribeFromModCollectionWithHandler(FModioMod
 
 void UModioUISubsystem::QueryIsUserFollowingModCollection(FModioModCollectionID ID)
 {
-	if (UModioSubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioSubsystem>())
+	QueryIsUserFollowingModCollection(
+		ID, FOnQueryFollowedModCollectionCompletedFast::CreateWeakLambda(this, [this, ID](FModioErrorCode ec,
+		                                                                                  bool bIsFollowed) {
+			if (ec)
+			{
+				UE_LOG(ModioUICore, Error, TEXT("Failed to query user following collection state: \"%s\""),
+				       *ec.GetErrorMessage());
+			}
+			else
+			{
+				MODIO_UI_BROADCAST(OnModCollectionFollowStateChanged, ID, bIsFollowed);
+			}
+		}));
+}
+
+void UModioUISubsystem::QueryIsUserFollowingModCollection(FModioModCollectionID ID,
+                                                          FOnQueryFollowedModCollectionCompletedFast Handler)
+{
+	if (bFollowedModCollectionsFetched)
 	{
-		Subsystem->ListUserFollowedModCollectionsAsync(
-			{}, FOnListFollowedModCollectionsDelegateFast::CreateLambda(
-				[ID](FModioErrorCode ec, TOptional<FModioModCollectionInfoList> FollowedCollections) {
-					if (ec)
-					{
-						UE_LOG(ModioUICore, Error, TEXT("Failed to query user following collection state: \"%s\""),
-						       *ec.GetErrorMessage());
-					}
-				}));
+		Handler.ExecuteIfBound({}, FollowedModCollectionIDs.Contains(ID));
+		return;
+	}
+
+	PendingFollowQueries.Emplace(ID, MoveTemp(Handler));
+	if (!bFollowedModCollectionsRequestInFlight)
+	{
+		RequestFollowedModCollectionsFromProvider();
 	}
 }
 
 void UModioUISubsystem::QueryIsUserFollowingModCollectionWithHandler(FModioModCollectionID ID,
                                                                      FOnQueryFollowedModCollectionCompleted Handler)
 {
-	if (UModioSubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioSubsystem>())
+	QueryIsUserFollowingModCollection(
+		ID, FOnQueryFollowedModCollectionCompletedFast::CreateLambda([Handler](FModioErrorCode ec, bool bIsFollowed) {
+			Handler.ExecuteIfBound(ec, bIsFollowed);
+		}));
+}
+
+TOptional<bool> UModioUISubsystem::GetCachedModCollectionFollowState(FModioModCollectionID ID)
+{
+	if (bFollowedModCollectionsFetched)
+	{
+		return FollowedModCollectionIDs.Contains(ID);
+	}
+
+	if (!bFollowedModCollectionsRequestInFlight)
 	{
-		Subsystem->ListUserFollowedModCollectionsAsync({},
-		                                               FOnListFollowedModCollectionsDelegateFast::CreateLambda(
-			                                               [ID, Handler](
-			                                               FModioErrorCode ec,
-			                                               TOptional<FModioModCollectionInfoList> FollowedCollections) {
-				                                               if (ec)
-				                                               {
-					                                               Handler.Execute(ec, false);
-				                                               }
-				                                               else
-				                                               {
-					                                               if (!FollowedCollections.IsSet())
-					                                               {
-						                                               Handler.Execute(ec, false);
-					                                               }
-
-					                                               // can probably do this better
-					                                               bool bFoundCollection = false;
-					                                               for (const FModioModCollectionInfo& Info :
-					                                                    FollowedCollections.GetValue().GetRawList())
-					                                               {
-						                                               if (Info.Id == ID)
-						                                               {
-							                                               bFoundCollection = true;
-							                                               break;
-						                                               }
-					                                               }
-					                                               Handler.ExecuteIfBound(ec, bFoundCollection);
-				                                               }
-			                                               }));
+		RequestFollowedModCollectionsFromProvider();
 	}
+	return {};
 }
 
-bool UModioUISubsystem::NativeRequestModRatingChange(int64 ID, EModioRating NewRating)
+void UModioUISubsystem::InvalidateFollowedModCollections()
+{
+	FollowedModCollectionIDs.Reset();
+	bFollowedModCollectionsFetched = false;
+	bFollowedModCollectionsRequestInFlight = false;
+	FollowedModCollectionsGeneration++;
+
+	// Queries made for the previous user are answered against the new one
+	if (PendingFollowQueries.Num())
+	{
+		RequestFollowedModCollectionsFromProvider();
+	}
+}
+
+void UModioUISubsystem::RequestFollowedModCollectionsFromProvider()
 {
-	if (ModRatingMap.Contains(ID))
+	bFollowedModCollectionsRequestInFlight = true;
+	DataProvider->ListUserFollowedModCollectionsAsync(
+		{}, FOnListFollowedModCollectionsDelegateFast::CreateUObject(
+			    this, &UModioUISubsystem::OnListFollowedModCollectionsComplete, FollowedModCollectionsGeneration));
+}
+
+void UModioUISubsystem::OnListFollowedModCollectionsComplete(FModioErrorCode ErrorCode,
+                                                             TOptional<FModioModCollectionInfoList> FollowedCollections,
+                                                             uint32 Generation)
+{
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_RequestCompletion);
+
+	if (Generation != FollowedModCollectionsGeneration)
 	{
-		ModRatingMap[ID] = NewRating;
+		return;
+	}
+	bFollowedModCollectionsRequestInFlight = false;
+
+	if (!ErrorCode && FollowedCollections.IsSet())
+	{
+		FollowedModCollectionIDs.Reset();
+		for (const FModioModCollectionInfo& Info : FollowedCollections.GetValue().GetRawList())
+		{
+			FollowedModCollectionIDs.Add(Info.Id);
+		}
+		bFollowedModCollectionsFetched = true;
 	}
 	else
 	{
-		ModRatingMap.Add(ID, NewRating);
+		UE_LOG(ModioUICore, Error, TEXT("Failed to list followed mod collections: \"%s\""),
+		       *ErrorCode.GetErrorMessage());
+	}
+
+	// On failure nothing is cached, so the next query retries
+	TArray<TPair<FModioModCollectionID, FOnQueryFollowedModCollectionCompletedFast>> Queries =
+		MoveTemp(PendingFollowQueries);
+	for (TPair<FModioModCollectionID, FOnQueryFollowedModCollectionCompletedFast>& Query : Queries)
+	{
+		Query.Value.ExecuteIfBound(ErrorCode,
+		                           bFollowedModCollectionsFetched && FollowedModCollectionIDs.Contains(Query.Key));
 	}
+}
 
+bool UModioUISubsystem::NativeRequestModRatingChange(int64 ID, EModioRating NewRating)
+{
+	ResolveRatingsUser();
+	SetLocalRating(false, ID, NewRating);
+	SetConfirmedRating(false, ID, NewRating);
 	return true;
 }
 
+void UModioUISubsystem::RecordBroadcastFanOut(int32 FanOut, const char* DelegateName)
+{
+#if MODIO_UI_WITH_STATS
+	INC_DWORD_STAT_BY(STAT_ModioUI_BroadcastFanOut, FanOut);
+	#if CSV_PROFILER
+	// Recorded per delegate so a capture shows which event dominates the fan-out cost
+	FCsvProfiler::RecordCustomStat(DelegateName, CSV_CATEGORY_INDEX(ModioUI), FanOut, ECsvCustomStatOp::Max);
+	#endif
+#endif
+}
+
+#undef MODIO_UI_BROADCAST
 
 #include "Loc/EndModioLocNamespace.h"
\ No newline at end of file
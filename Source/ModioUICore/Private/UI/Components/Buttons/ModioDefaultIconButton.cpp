@@ -13,6 +13,7 @@
 #include "UI/Components/ComponentHelpers.h"
 #include "Engine/Texture2DDynamic.h"
 #include "Brushes/SlateImageBrush.h"
+#include "ModioUIStats.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(ModioDefaultIconButton)
 
@@ -33,6 +34,9 @@ void UModioDefaultIconButton::NativeRemoveImageLoadEventHandler(const FModioImag
 
 void UModioDefaultIconButton::NativeBeginLoadImageFromFile(FModioImageWrapper Image)
 {
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_ImageLoad);
+	INC_DWORD_STAT(STAT_ModioUI_ImageLoadsInFlight);
+
 	CurrentlyLoadingImageWrapper = Image;
 	CurrentlyLoadingImageWrapper->LoadAsync(FOnLoadImageDelegateFast::CreateUObject(this, &UModioDefaultIconButton::ImageLoadCompletedHandler));
 }
@@ -55,6 +59,9 @@ void UModioDefaultIconButton::NativeSetDesiredBrushSize(FVector2D DesiredSize)
 
 void UModioDefaultIconButton::ImageLoadCompletedHandler(UTexture2DDynamic* LoadedImage)
 {
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_ImageDecode);
+	DEC_DWORD_STAT(STAT_ModioUI_ImageLoadsInFlight);
+
 	if (LoadedImage && GetImageWidget())
 	{
 		if (UWidget* ImageWidget = ModioUI::GetInterfaceWidgetChecked(GetImageWidget()))
@@ -70,6 +77,15 @@ void UModioDefaultIconButton::ImageLoadCompletedHandler(UTexture2DDynamic* Loade
 	}
 }
 
+void UModioDefaultIconButton::NativeSetTexture(UTexture2DDynamic* Texture, FModioImageWrapper SourceImage)
+{
+	if (UWidget* ImageWidget = ModioUI::GetInterfaceWidgetChecked(GetImageWidget()))
+	{
+		IModioUIImageDisplayWidget::DisplayTexture(ImageWidget, Texture, SourceImage);
+	}
+	OnLoadStateChanged.Broadcast(this, Texture != nullptr);
+}
+
 void UModioDefaultIconButton::NativeSetBrush(const FSlateBrush& NewBrush)
 {
 	if (UWidget* ImageWidget = ModioUI::GetInterfaceWidgetChecked(GetImageWidget()))
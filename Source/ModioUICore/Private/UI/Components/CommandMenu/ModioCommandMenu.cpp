@@ -10,6 +10,8 @@
 
 #include "UI/Components/CommandMenu/ModioCommandMenu.h"
 
+#include "ModioUIStats.h"
+
 #include UE_INLINE_GENERATED_CPP_BY_NAME(ModioCommandMenu)
 
 void UModioCommandMenu::AddCommandListBuilder_Implementation(const FModioCommandListBuilder& Builder)
@@ -24,6 +26,8 @@ void UModioCommandMenu::RemoveCommandListBuilder_Implementation(const FModioComm
 
 void UModioCommandMenu::RebuildCommandList_Implementation()
 {
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_CommandListRebuild);
+
 	CommandObjects.Empty();
 	OnBuildCommandList.Broadcast(MutableView(CommandObjects), this);
 	if (UWidget* SelectorWidget = ModioUI::GetInterfaceWidgetChecked(GetSelectorWidget()))
@@ -0,0 +1,289 @@
+/*
+ *  Copyright (C) 2025 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io UE Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue/blob/main/LICENSE>)
+ *
+ */
+
+#include "UI/Components/ComponentHelpers.h"
+
+#include "Blueprint/WidgetTree.h"
+#include "Components/MenuAnchor.h"
+#include "Engine/Engine.h"
+#include "ModioUISubsystem.h"
+#include "UI/Interfaces/IModioToggleableWidget.h"
+
+namespace ModioUI
+{
+	UWidget* FindMenuAnchorWidget(const UWidgetTree* WidgetTree)
+	{
+		UWidget* MenuAnchor = nullptr;
+		if (WidgetTree)
+		{
+			WidgetTree->ForEachWidget([&MenuAnchor](UWidget* Widget) {
+				if (!MenuAnchor && Widget->IsA<UMenuAnchor>() && Widget->Implements<UModioToggleableWidget>())
+				{
+					MenuAnchor = Widget;
+				}
+			});
+		}
+		return MenuAnchor;
+	}
+
+	void FSelectorMenuState::Initialize(UObject& InOwner, UObject* MenuAnchor, UObject* MenuToggle,
+										FFillMenu InFillMenu, FEmptyMenu InEmptyMenu)
+	{
+		Owner = &InOwner;
+		OpenStateSource =
+			MenuAnchor ? MenuAnchor
+					   : (MenuToggle && MenuToggle->Implements<UModioToggleableWidget>() ? MenuToggle : nullptr);
+		FillMenu = MoveTemp(InFillMenu);
+		EmptyMenu = MoveTemp(InEmptyMenu);
+
+		// Content set before the selector was constructed is handled as though it had just changed
+		if (!bPopulated && !IsKnownClosed())
+		{
+			ContentChanged();
+		}
+	}
+
+	UObject* FSelectorMenuState::GetOpenStateSource() const
+	{
+		return OpenStateSource.Get();
+	}
+
+	bool FSelectorMenuState::IsKnownClosed() const
+	{
+		const UObject* Source = OpenStateSource.Get();
+		return Source && !IModioToggleableWidget::Execute_IsOpen(Source);
+	}
+
+	void FSelectorMenuState::ContentChanged()
+	{
+		if (!FillMenu || !EmptyMenu)
+		{
+			return;
+		}
+		if (!IsKnownClosed())
+		{
+			bPopulated = FillMenu();
+			if (!bPopulated)
+			{
+				EmptyMenu();
+			}
+		}
+		else if (bPopulated)
+		{
+			EmptyMenu();
+			bPopulated = false;
+			ForgetIdle();
+		}
+	}
+
+	void FSelectorMenuState::Populate()
+	{
+		if (bPopulated || !FillMenu)
+		{
+			return;
+		}
+		bPopulated = FillMenu();
+
+		// A menu populated ahead of being opened counts against the idle budget until it actually opens
+		if (bPopulated && IsKnownClosed())
+		{
+			RetainWhileIdle();
+		}
+	}
+
+	void FSelectorMenuState::Release()
+	{
+		if (!bPopulated || !IsKnownClosed() || !EmptyMenu)
+		{
+			return;
+		}
+		EmptyMenu();
+		bPopulated = false;
+	}
+
+	void FSelectorMenuState::OpenStateChanged(bool bIsOpen)
+	{
+		if (bIsOpen)
+		{
+			Populate();
+			ForgetIdle();
+		}
+		else if (bPopulated)
+		{
+			RetainWhileIdle();
+		}
+	}
+
+	void FSelectorMenuState::RetainWhileIdle()
+	{
+		UObject* OwnerObject = Owner.Get();
+		UModioUISubsystem* Subsystem = GEngine ? GEngine->GetEngineSubsystem<UModioUISubsystem>() : nullptr;
+		if (OwnerObject && Subsystem)
+		{
+			// The state lives on its owner, so the owner being alive keeps it valid
+			Subsystem->RetainIdleSelectorMenu(OwnerObject,
+											  FSimpleDelegate::CreateWeakLambda(OwnerObject, [this]() { Release(); }));
+		}
+	}
+
+	void FSelectorMenuState::ForgetIdle()
+	{
+		UObject* OwnerObject = Owner.Get();
+		UModioUISubsystem* Subsystem = GEngine ? GEngine->GetEngineSubsystem<UModioUISubsystem>() : nullptr;
+		if (OwnerObject && Subsystem)
+		{
+			Subsystem->ForgetIdleSelectorMenu(OwnerObject);
+		}
+	}
+} // namespace ModioUI
+
+#if WITH_EDITOR
+
+	#include "Components/Widget.h"
+	#include "Misc/ScopeRWLock.h"
+
+namespace ModioUI
+{
+	namespace ComponentHelpersPrivate
+	{
+		FRWLock& GetCacheLock()
+		{
+			static FRWLock CacheLock;
+			return CacheLock;
+		}
+
+		TMap<FString, UClass*>& GetInterfaceClassesByName()
+		{
+			static TMap<FString, UClass*> InterfaceClassesByName;
+			return InterfaceClassesByName;
+		}
+
+		TMap<const UClass*, TArray<FModioBoundWidgetContract>>& GetContractsByNativeClass()
+		{
+			static TMap<const UClass*, TArray<FModioBoundWidgetContract>> ContractsByNativeClass;
+			return ContractsByNativeClass;
+		}
+
+		TArray<FModioBoundWidgetContract> CollectBoundWidgetContracts(const UClass* NativeClass)
+		{
+			TArray<FModioBoundWidgetContract> Contracts;
+			for (TFieldIterator<FProperty> PropIterator(NativeClass); PropIterator; ++PropIterator)
+			{
+				FObjectProperty* ObjectProperty = CastField<FObjectProperty>(*PropIterator);
+				if (!ObjectProperty || !ObjectProperty->PropertyClass ||
+					!ObjectProperty->PropertyClass->IsChildOf<UWidget>())
+				{
+					continue;
+				}
+				if (!(ObjectProperty->HasMetaData("BindWidget") || ObjectProperty->HasMetaData("BindWidgetOptional")) ||
+					!ObjectProperty->HasMetaData("MustImplement"))
+				{
+					continue;
+				}
+
+				FModioBoundWidgetContract& Contract = Contracts.AddDefaulted_GetRef();
+				Contract.PropertyName = ObjectProperty->GetFName();
+				ObjectProperty->GetMetaData("MustImplement").ParseIntoArrayWS(Contract.RequiredInterfaceNames, TEXT(","));
+				for (const FString& InterfaceName : Contract.RequiredInterfaceNames)
+				{
+					Contract.RequiredInterfaces.Add(FindInterfaceClass(InterfaceName));
+				}
+			}
+			return Contracts;
+		}
+	} // namespace ComponentHelpersPrivate
+
+	UClass* FindInterfaceClass(const FString& ClassName)
+	{
+		{
+			FReadScopeLock ReadLock(ComponentHelpersPrivate::GetCacheLock());
+			if (UClass* const* CachedClass = ComponentHelpersPrivate::GetInterfaceClassesByName().Find(ClassName))
+			{
+				return *CachedClass;
+			}
+		}
+
+		// Misses are not cached because the module declaring the class may simply not be loaded yet
+		check(IsInGameThread());
+		UClass* FoundClass = UClass::TryFindTypeSlow<UClass>(*ClassName);
+		if (FoundClass)
+		{
+			FWriteScopeLock WriteLock(ComponentHelpersPrivate::GetCacheLock());
+			ComponentHelpersPrivate::GetInterfaceClassesByName().Add(ClassName, FoundClass);
+		}
+		return FoundClass;
+	}
+
+	TArray<FModioBoundWidgetContract> GetBoundWidgetContracts(const UClass* WidgetClass)
+	{
+		const UClass* NativeClass = WidgetClass;
+		while (NativeClass && !NativeClass->HasAnyClassFlags(CLASS_Native))
+		{
+			NativeClass = NativeClass->GetSuperClass();
+		}
+		if (!NativeClass)
+		{
+			return {};
+		}
+
+		{
+			FReadScopeLock ReadLock(ComponentHelpersPrivate::GetCacheLock());
+			if (const TArray<FModioBoundWidgetContract>* CachedContracts =
+					ComponentHelpersPrivate::GetContractsByNativeClass().Find(NativeClass))
+			{
+				return *CachedContracts;
+			}
+		}
+
+		TArray<FModioBoundWidgetContract> Contracts = ComponentHelpersPrivate::CollectBoundWidgetContracts(NativeClass);
+		// Only cache contracts whose interfaces all resolved, so that a later lookup can pick up late-loaded classes
+		if (!Contracts.ContainsByPredicate(
+				[](const FModioBoundWidgetContract& Contract) { return Contract.RequiredInterfaces.Contains(nullptr); }))
+		{
+			FWriteScopeLock WriteLock(ComponentHelpersPrivate::GetCacheLock());
+			ComponentHelpersPrivate::GetContractsByNativeClass().Add(NativeClass, Contracts);
+		}
+		return Contracts;
+	}
+
+	bool ValidateBoundWidgets(const UClass* WidgetClass, const UWidgetTree& WidgetTree, TArray<FText>& OutErrors)
+	{
+		return ValidateBoundWidgets(GetBoundWidgetContracts(WidgetClass), WidgetTree, OutErrors);
+	}
+
+	bool ValidateBoundWidgets(TArrayView<const FModioBoundWidgetContract> Contracts, const UWidgetTree& WidgetTree,
+							  TArray<FText>& OutErrors)
+	{
+		bool bValid = true;
+		for (const FModioBoundWidgetContract& Contract : Contracts)
+		{
+			UWidget* Widget = WidgetTree.FindWidget(Contract.PropertyName);
+			if (!Widget)
+			{
+				continue;
+			}
+			for (int32 InterfaceIndex = 0; InterfaceIndex < Contract.RequiredInterfaces.Num(); ++InterfaceIndex)
+			{
+				const UClass* InterfaceClass = Contract.RequiredInterfaces[InterfaceIndex];
+				if (!InterfaceClass || !Widget->GetClass()->ImplementsInterface(InterfaceClass))
+				{
+					bValid = false;
+					OutErrors.Add(
+						FText::Format(FTextFormat(FText::FromString("{0} does not implement required interface {1}")),
+									  FText::FromName(Contract.PropertyName),
+									  FText::FromString(Contract.RequiredInterfaceNames[InterfaceIndex])));
+				}
+			}
+		}
+		return bValid;
+	}
+} // namespace ModioUI
+
+#endif
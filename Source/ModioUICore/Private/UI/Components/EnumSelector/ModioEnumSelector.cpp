@@ -15,14 +15,16 @@
 void UModioEnumSelector::SetValues_Implementation(const TArray<UObject*>& InValues)
 {
 	CachedValues = InValues;
-	if (UWidget* SelectorMenu = ModioUI::GetInterfaceWidgetChecked(GetSelectorMenuWidget()))
-	{
-		IModioUIObjectSelector::Execute_SetValues(SelectorMenu, CachedValues);
-	}
+	PendingSelection.Reset();
+	MenuState.ContentChanged();
 }
 
 UObject* UModioEnumSelector::GetSingleSelectedValue_Implementation()
 {
+	if (!MenuState.IsPopulated())
+	{
+		return PendingSelection.Num() ? PendingSelection[0].Get() : nullptr;
+	}
 	if (UWidget* SelectorMenu = ModioUI::GetInterfaceWidgetChecked(GetSelectorMenuWidget()))
 	{
 		return IModioUIObjectSelector::Execute_GetSingleSelectedValue(SelectorMenu);
@@ -32,6 +34,11 @@ UObject* UModioEnumSelector::GetSingleSelectedValue_Implementation()
 
 void UModioEnumSelector::ClearSelectedValues_Implementation()
 {
+	if (!MenuState.IsPopulated())
+	{
+		PendingSelection.Reset();
+		return;
+	}
 	if (UWidget* SelectorMenu = ModioUI::GetInterfaceWidgetChecked(GetSelectorMenuWidget()))
 	{
 		IModioUIObjectSelector::Execute_ClearSelectedValues(SelectorMenu);
@@ -40,6 +47,14 @@ void UModioEnumSelector::ClearSelectedValues_Implementation()
 
 void UModioEnumSelector::SetSingleSelectionByIndex_Implementation(int32 Index, bool bEmitSelectionEvent)
 {
+	if (!MenuState.IsPopulated())
+	{
+		if (CachedValues.IsValidIndex(Index))
+		{
+			IModioUIObjectSelector::Execute_SetSingleSelectionByValue(this, CachedValues[Index], bEmitSelectionEvent);
+		}
+		return;
+	}
 	if (UWidget* SelectorMenu = ModioUI::GetInterfaceWidgetChecked(GetSelectorMenuWidget()))
 	{
 		IModioUIObjectSelector::Execute_SetSingleSelectionByIndex(SelectorMenu, Index, bEmitSelectionEvent);
@@ -48,6 +63,19 @@ void UModioEnumSelector::SetSingleSelectionByIndex_Implementation(int32 Index, b
 
 void UModioEnumSelector::SetSingleSelectionByValue_Implementation(UObject* Value, bool bEmitSelectionEvent)
 {
+	if (!MenuState.IsPopulated())
+	{
+		if (CachedValues.Contains(Value))
+		{
+			PendingSelection.Reset();
+			PendingSelection.Add(Value);
+			if (bEmitSelectionEvent)
+			{
+				NotifySelectionChanged(Value);
+			}
+		}
+		return;
+	}
 	if (UWidget* SelectorMenu = ModioUI::GetInterfaceWidgetChecked(GetSelectorMenuWidget()))
 	{
 		IModioUIObjectSelector::Execute_SetSingleSelectionByValue(SelectorMenu, Value, bEmitSelectionEvent);
@@ -74,6 +102,47 @@ TScriptInterface<IModioUIClickableWidget> UModioEnumSelector::GetMenuToggleClick
 	return nullptr;
 }
 
+TScriptInterface<IModioToggleableWidget> UModioEnumSelector::GetMenuAnchorWidget_Implementation() const
+{
+	return TScriptInterface<IModioToggleableWidget>(DefaultMenuAnchor.Get());
+}
+
+bool UModioEnumSelector::FillMenu()
+{
+	UWidget* SelectorMenu = ModioUI::GetInterfaceWidgetChecked(GetSelectorMenuWidget());
+	if (!SelectorMenu)
+	{
+		return false;
+	}
+
+	IModioUIObjectSelector::Execute_SetValues(SelectorMenu, CachedValues);
+	for (UObject* SelectedValue : PendingSelection)
+	{
+		IModioUIObjectSelector::Execute_SetSelectedStateForValue(SelectorMenu, SelectedValue, true, false);
+	}
+	PendingSelection.Reset();
+	return true;
+}
+
+void UModioEnumSelector::EmptyMenu()
+{
+	if (UWidget* SelectorMenu = ModioUI::GetInterfaceWidgetChecked(GetSelectorMenuWidget()))
+	{
+		PendingSelection = IModioUIObjectSelector::Execute_GetSelectedValues(SelectorMenu);
+		IModioUIObjectSelector::Execute_SetValues(SelectorMenu, {});
+	}
+}
+
+void UModioEnumSelector::OnMenuToggleClicked(UObject* ClickContext)
+{
+	MenuState.Populate();
+}
+
+void UModioEnumSelector::OnMenuToggleStateChanged(UObject* Context, bool bIsOpen)
+{
+	MenuState.OpenStateChanged(bIsOpen);
+}
+
 void UModioEnumSelector::InternalSelectionChangedHandler(UObject* SelectedObject)
 {
 	NotifySelectionChanged(SelectedObject);
@@ -86,6 +155,8 @@ void UModioEnumSelector::NotifySelectionChanged(UObject* SelectedObject)
 
 void UModioEnumSelector::NativePreConstruct()
 {
+	// Resolved before Blueprint PreConstruct runs, as it may ask for the anchor
+	DefaultMenuAnchor = ModioUI::FindMenuAnchorWidget(WidgetTree);
 	Super::NativePreConstruct();
 	// Bind a handler to the internal menu widget's selection changed event so we can rebroadcast it
 	if (UWidget* SelectorMenu = ModioUI::GetInterfaceWidgetChecked(GetSelectorMenuWidget()))
@@ -95,6 +166,35 @@ void UModioEnumSelector::NativePreConstruct()
 										GET_FUNCTION_NAME_CHECKED(UModioEnumSelector, InternalSelectionChangedHandler));
 		IModioUIObjectSelector::Execute_AddSelectionChangedHandler(SelectorMenu, SelectionDelegate);
 	}
+
+	// The menu is populated on first open, so watch for the user opening it
+	if (UWidget* MenuToggle = ModioUI::GetInterfaceWidgetChecked(GetMenuToggleClickableWidget()))
+	{
+		FModioClickableOnClicked ClickedDelegate;
+		ClickedDelegate.BindUFunction(this, GET_FUNCTION_NAME_CHECKED(UModioEnumSelector, OnMenuToggleClicked));
+		IModioUIClickableWidget::Execute_AddClickedHandler(MenuToggle, ClickedDelegate);
+	}
+	MenuState.Initialize(*this, GetMenuAnchorWidget().GetObject(), GetMenuToggleClickableWidget().GetObject(),
+						 [this]() { return FillMenu(); }, [this]() { EmptyMenu(); });
+	if (UObject* MenuOpenStateSource = MenuState.GetOpenStateSource())
+	{
+		FModioOnToggleStateChanged ToggleDelegate;
+		ToggleDelegate.BindUFunction(this, GET_FUNCTION_NAME_CHECKED(UModioEnumSelector, OnMenuToggleStateChanged));
+		IModioToggleableWidget::Execute_AddToggleStateChangedHandler(MenuOpenStateSource, ToggleDelegate);
+	}
+}
+
+void UModioEnumSelector::NativeOnAddedToFocusPath(const FFocusEvent& InFocusEvent)
+{
+	Super::NativeOnAddedToFocusPath(InFocusEvent);
+	// Focus reaching the selector is a strong hint the menu is about to be opened
+	MenuState.Populate();
+}
+
+void UModioEnumSelector::NativeOnMouseEnter(const FGeometry& InGeometry, const FPointerEvent& InMouseEvent)
+{
+	Super::NativeOnMouseEnter(InGeometry, InMouseEvent);
+	MenuState.Populate();
 }
 
 bool UModioEnumSelector::GetMultiSelectionAllowed_Implementation()
@@ -112,10 +212,18 @@ void UModioEnumSelector::SetMultiSelectionAllowed_Implementation(bool bMultiSele
 	{
 		IModioUIObjectSelector::Execute_SetMultiSelectionAllowed(SelectorMenu, bMultiSelectionAllowed);
 	}
+	if (!bMultiSelectionAllowed && PendingSelection.Num() > 1)
+	{
+		PendingSelection.SetNum(1);
+	}
 }
 
 TArray<UObject*> UModioEnumSelector::GetSelectedValues_Implementation()
 {
+	if (!MenuState.IsPopulated())
+	{
+		return TArray<UObject*>(PendingSelection);
+	}
 	if (UWidget* SelectorMenu = ModioUI::GetInterfaceWidgetChecked(GetSelectorMenuWidget()))
 	{
 		return IModioUIObjectSelector::Execute_GetSelectedValues(SelectorMenu);
@@ -126,6 +234,31 @@ TArray<UObject*> UModioEnumSelector::GetSelectedValues_Implementation()
 void UModioEnumSelector::SetSelectedStateForValue_Implementation(UObject* Value, bool bNewSelectionState,
 																 bool bEmitSelectionEvent)
 {
+	if (!MenuState.IsPopulated())
+	{
+		if (!CachedValues.Contains(Value))
+		{
+			return;
+		}
+		if (!bNewSelectionState)
+		{
+			PendingSelection.Remove(Value);
+		}
+		else if (IModioUIObjectSelector::Execute_GetMultiSelectionAllowed(this))
+		{
+			PendingSelection.AddUnique(Value);
+		}
+		else
+		{
+			PendingSelection.Reset();
+			PendingSelection.Add(Value);
+		}
+		if (bEmitSelectionEvent)
+		{
+			NotifySelectionChanged(Value);
+		}
+		return;
+	}
 	if (UWidget* SelectorMenu = ModioUI::GetInterfaceWidgetChecked(GetSelectorMenuWidget()))
 	{
 		IModioUIObjectSelector::Execute_SetSelectedStateForValue(SelectorMenu, Value, bNewSelectionState,
@@ -136,6 +269,15 @@ void UModioEnumSelector::SetSelectedStateForValue_Implementation(UObject* Value,
 void UModioEnumSelector::SetSelectedStateForIndex_Implementation(int32 Index, bool bNewSelectionState,
 																 bool bEmitSelectionEvent)
 {
+	if (!MenuState.IsPopulated())
+	{
+		if (CachedValues.IsValidIndex(Index))
+		{
+			IModioUIObjectSelector::Execute_SetSelectedStateForValue(this, CachedValues[Index], bNewSelectionState,
+																	 bEmitSelectionEvent);
+		}
+		return;
+	}
 	if (UWidget* SelectorMenu = ModioUI::GetInterfaceWidgetChecked(GetSelectorMenuWidget()))
 	{
 		IModioUIObjectSelector::Execute_SetSelectedStateForIndex(SelectorMenu, Index, bNewSelectionState,
@@ -10,6 +10,8 @@
 
 #include "UI/Components/ImageGallery/ModioDefaultImage.h"
 
+#include "ModioUIStats.h"
+
 #include UE_INLINE_GENERATED_CPP_BY_NAME(ModioDefaultImage)
 
 void UModioDefaultImage::NativeAddImageLoadEventHandler(const FModioImageDisplayOnLoadStateChanged& Handler)
@@ -24,11 +26,16 @@ void UModioDefaultImage::NativeRemoveImageLoadEventHandler(const FModioImageDisp
 
 void UModioDefaultImage::NativeBeginLoadImageFromFile(FModioImageWrapper Image)
 {
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_ImageLoad);
+	INC_DWORD_STAT(STAT_ModioUI_ImageLoadsInFlight);
 	Image.LoadAsync(FOnLoadImageDelegateFast::CreateUObject(this, &UModioDefaultImage::ImageLoadCompletedHandler));
 }
 
 void UModioDefaultImage::ImageLoadCompletedHandler(class UTexture2DDynamic* LoadedImage)
 {
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_ImageDecode);
+	DEC_DWORD_STAT(STAT_ModioUI_ImageLoadsInFlight);
+
 	if (LoadedImage)
 	{
 		SetBrushFromTextureDynamic(LoadedImage, bShouldMatchTextureSize);
@@ -45,6 +52,15 @@ void UModioDefaultImage::NativeSetBrush(const FSlateBrush& NewBrush)
 	SetBrush(NewBrush);
 }
 
+void UModioDefaultImage::NativeSetTexture(UTexture2DDynamic* Texture, FModioImageWrapper SourceImage)
+{
+	if (Texture)
+	{
+		SetBrushFromTextureDynamic(Texture, bShouldMatchTextureSize);
+	}
+	OnLoadStateChanged.Broadcast(this, Texture != nullptr);
+}
+
 void UModioDefaultImage::SetTooltipEnabledState_Implementation(bool bNewEnabledState)
 {
 	SetToolTipText(bNewEnabledState ? GetToolTipText() : FText::GetEmpty());
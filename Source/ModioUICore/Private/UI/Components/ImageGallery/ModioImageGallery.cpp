@@ -13,6 +13,8 @@
 #include "Components/ListView.h"
 
 #include "Core/ModioGalleryImageUI.h"
+#include "Core/ModioUIDataProvider.h"
+#include "ModioUICore.h"
 #include "ModioUISubsystem.h"
 #include "UI/Components/ImageGallery/ModioGalleryListEntry.h"
 #include "UI/Interfaces/IModioModInfoUIDetails.h"
@@ -27,6 +29,14 @@ void UModioImageGallery::NativePreConstruct()
 	IModioUIMediaDownloadCompletedReceiver::Register<UModioImageGallery>(
 		EModioUIMediaDownloadEventType::ModGalleryImages);
 	IModioUIMediaDownloadCompletedReceiver::Register<UModioImageGallery>(EModioUIMediaDownloadEventType::ModLogo);
+
+	if (UWidget* SelectorWidget = ModioUI::GetInterfaceWidgetChecked(GetImageSelectorWidget()))
+	{
+		FModioOnObjectSelectionChanged SelectionChangedDelegate;
+		SelectionChangedDelegate.BindUFunction(
+			this, GET_FUNCTION_NAME_CHECKED(UModioImageGallery, HandleImageSelectionChanged));
+		IModioUIObjectSelector::Execute_AddSelectionChangedHandler(SelectorWidget, SelectionChangedDelegate);
+	}
 }
 
 void UModioImageGallery::NativeSetDataSource(UObject* InDataSource)
@@ -48,15 +58,24 @@ void UModioImageGallery::NativeSetDataSource(UObject* InDataSource)
 
 void UModioImageGallery::Refresh()
 {
+	// Responses still in flight for the previous mod are told apart by their generation and ignored
+	++LoadGeneration;
+	QueuedPrefetches.Reset();
+	IssuedPrefetches.Reset();
+	NumPrefetchesInFlight = 0;
+	bShowingFullResolution = false;
+
 	if (UModioUISubsystem* UISubsystem = GEngine->GetEngineSubsystem<UModioUISubsystem>())
 	{
 		if (bUseLogoOnly)
 		{
+			RequestDisplayedImageThumbnail();
 			UISubsystem->RequestLogoDownloadForModID(BoundModInfo.ModId, EModioLogoSize::Thumb1280);
 			return;
 		}
 		if (BoundModInfo.NumGalleryImages == 1)
 		{
+			RequestDisplayedImageThumbnail();
 			UISubsystem->RequestGalleryImageDownloadForModID(BoundModInfo.ModId, 0, EModioGallerySize::Thumb1280);
 			return;
 		}
@@ -95,24 +114,186 @@ TScriptInterface<IModioUIClickableWidget> UModioImageGallery::GetIncrementSelect
 	return nullptr;
 }
 
+void UModioImageGallery::HandleImageSelectionChanged(UObject* SelectedValue)
+{
+	if (bUseLogoOnly)
+	{
+		return;
+	}
+	bShowingFullResolution = false;
+	RequestDisplayedImageThumbnail();
+	UpdatePrefetchQueue();
+}
+
+int32 UModioImageGallery::GetDisplayedImageIndex() const
+{
+	if (bUseLogoOnly)
+	{
+		return INDEX_NONE;
+	}
+	if (BoundModInfo.NumGalleryImages > 1)
+	{
+		if (UWidget* SelectorWidget = ModioUI::GetInterfaceWidgetChecked(GetImageSelectorWidget()))
+		{
+			return IModioUIObjectSelector::Execute_GetSingleSelectionIndex(SelectorWidget);
+		}
+	}
+	return 0;
+}
+
+void UModioImageGallery::RequestDisplayedImageThumbnail()
+{
+	if (!bShowThumbnailWhileLoading)
+	{
+		return;
+	}
+	UModioUISubsystem* UISubsystem = GEngine->GetEngineSubsystem<UModioUISubsystem>();
+	UModioUIDataProvider* DataProvider = UISubsystem ? UISubsystem->GetDataProvider() : nullptr;
+	if (!DataProvider)
+	{
+		return;
+	}
+
+	const int32 ImageIndex = GetDisplayedImageIndex();
+	if (bUseLogoOnly)
+	{
+		DataProvider->GetModLogoAsync(BoundModInfo.ModId, EModioLogoSize::Thumb320,
+									  FOnGetMediaDelegateFast::CreateUObject(this, &UModioImageGallery::OnThumbnailReceived,
+																			 LoadGeneration, ImageIndex));
+	}
+	else if (ImageIndex != INDEX_NONE)
+	{
+		DataProvider->GetModGalleryImageAsync(
+			BoundModInfo.ModId, EModioGallerySize::Thumb320, ImageIndex,
+			FOnGetMediaDelegateFast::CreateUObject(this, &UModioImageGallery::OnThumbnailReceived, LoadGeneration,
+												   ImageIndex));
+	}
+}
+
+void UModioImageGallery::OnThumbnailReceived(FModioErrorCode ErrorCode, TOptional<FModioImageWrapper> Image,
+											 int32 Generation, int32 ImageIndex)
+{
+	// The full resolution image may have won the race, in which case the thumbnail must not replace it
+	if (Generation != LoadGeneration || ImageIndex != GetDisplayedImageIndex() || bShowingFullResolution)
+	{
+		return;
+	}
+	if (ErrorCode || !Image.IsSet())
+	{
+		UE_LOG(ModioUICore, Verbose, TEXT("Could not load thumbnail for image %d: %s"), ImageIndex,
+			   *ErrorCode.GetErrorMessage());
+		return;
+	}
+	DisplayImage(Image.GetValue(), false);
+}
+
+void UModioImageGallery::DisplayImage(const FModioImageWrapper& Image, bool bFullResolution)
+{
+	bShowingFullResolution |= bFullResolution;
+	if (ModioUI::GetInterfaceWidgetChecked(GetImageWidget()))
+	{
+		IModioUIImageDisplayWidget::Execute_BeginLoadImageFromFile(GetImageWidget().GetObject(), Image);
+	}
+}
+
+void UModioImageGallery::UpdatePrefetchQueue()
+{
+	QueuedPrefetches.Reset();
+	const int32 DisplayedIndex = GetDisplayedImageIndex();
+	if (PrefetchRadius <= 0 || DisplayedIndex == INDEX_NONE || BoundModInfo.NumGalleryImages <= 1)
+	{
+		return;
+	}
+
+	// Thumbnails of every neighbour come before any full resolution image so that paging quickly shows something
+	for (const EModioGallerySize ImageSize : {EModioGallerySize::Thumb320, EModioGallerySize::Thumb1280})
+	{
+		if (ImageSize == EModioGallerySize::Thumb320 && !bShowThumbnailWhileLoading)
+		{
+			continue;
+		}
+		for (int32 Distance = 1; Distance <= PrefetchRadius; ++Distance)
+		{
+			for (const int32 ImageIndex : {DisplayedIndex + Distance, DisplayedIndex - Distance})
+			{
+				const FPrefetchRequest Request {ImageIndex, ImageSize};
+				if (ImageIndex >= 0 && ImageIndex < BoundModInfo.NumGalleryImages && !IssuedPrefetches.Contains(Request))
+				{
+					QueuedPrefetches.Add(Request);
+				}
+			}
+		}
+	}
+
+	// Prefetching waits for the displayed image so that it never competes with it for bandwidth
+	if (bShowingFullResolution)
+	{
+		IssuePrefetches();
+	}
+}
+
+void UModioImageGallery::IssuePrefetches()
+{
+	UModioUISubsystem* UISubsystem = GEngine->GetEngineSubsystem<UModioUISubsystem>();
+	UModioUIDataProvider* DataProvider = UISubsystem ? UISubsystem->GetDataProvider() : nullptr;
+	if (!DataProvider)
+	{
+		return;
+	}
+
+	int32 NumIssued = 0;
+	while (NumIssued < QueuedPrefetches.Num() && NumPrefetchesInFlight < MaxConcurrentPrefetches)
+	{
+		const FPrefetchRequest Request = QueuedPrefetches[NumIssued++];
+		IssuedPrefetches.Add(Request);
+		++NumPrefetchesInFlight;
+		DataProvider->GetModGalleryImageAsync(
+			BoundModInfo.ModId, Request.ImageSize, Request.ImageIndex,
+			FOnGetMediaDelegateFast::CreateUObject(this, &UModioImageGallery::OnPrefetchCompleted, LoadGeneration,
+												   Request.ImageIndex, Request.ImageSize));
+	}
+	QueuedPrefetches.RemoveAt(0, NumIssued);
+}
+
+void UModioImageGallery::OnPrefetchCompleted(FModioErrorCode ErrorCode, TOptional<FModioImageWrapper> Image,
+											 int32 Generation, int32 ImageIndex, EModioGallerySize ImageSize)
+{
+	if (Generation != LoadGeneration)
+	{
+		return;
+	}
+	--NumPrefetchesInFlight;
+	if (ErrorCode)
+	{
+		// Allow a later selection change to try again
+		IssuedPrefetches.Remove(FPrefetchRequest {ImageIndex, ImageSize});
+		UE_LOG(ModioUICore, Verbose, TEXT("Prefetch of gallery image %d failed: %s"), ImageIndex,
+			   *ErrorCode.GetErrorMessage());
+	}
+	IssuePrefetches();
+}
+
 void UModioImageGallery::NativeOnModGalleryImageDownloadCompleted(FModioModID ModID, FModioErrorCode ErrorCode,
 																  int32 ImageIndex, TOptional<FModioImageWrapper> Image)
 {
 	IModioUIMediaDownloadCompletedReceiver::NativeOnModGalleryImageDownloadCompleted(ModID, ErrorCode, ImageIndex,
 																					 Image);
-	if (ModID != BoundModInfo.ModId || bUseLogoOnly)
+	// Downloads of other images, for example requested by a quick succession of selection changes, must not replace
+	// the one that is selected now
+	if (ModID != BoundModInfo.ModId || bUseLogoOnly || ImageIndex != GetDisplayedImageIndex())
 	{
 		return;
 	}
 	if (ErrorCode || !Image.IsSet())
 	{
-		UE_LOG(LogTemp, Error, TEXT("Get bad response requesting image: %s"), *ErrorCode.GetErrorMessage());
+		UE_LOG(ModioUICore, Error, TEXT("Get bad response requesting image: %s"), *ErrorCode.GetErrorMessage());
+		// Nothing else will unblock prefetching for this image, so start it anyway
+		bShowingFullResolution = true;
+		IssuePrefetches();
 		return;
 	}
-	if (ModioUI::GetInterfaceWidgetChecked(GetImageWidget()))
-	{
-		IModioUIImageDisplayWidget::Execute_BeginLoadImageFromFile(GetImageWidget().GetObject(), Image.GetValue());
-	}
+	DisplayImage(Image.GetValue(), true);
+	IssuePrefetches();
 }
 
 void UModioImageGallery::NativeOnModLogoDownloadCompleted(FModioModID ModID, FModioErrorCode ErrorCode,
@@ -124,13 +305,15 @@ void UModioImageGallery::NativeOnModLogoDownloadCompleted(FModioModID ModID, FMo
 	{
 		return;
 	}
-	if (ErrorCode || !Image.IsSet())
+	// Other widgets request smaller logos for the same mod, which must not replace the full resolution one
+	if (bShowingFullResolution && LogoSize != EModioLogoSize::Thumb1280)
 	{
-		UE_LOG(LogTemp, Error, TEXT("Get bad response requesting image: %s"), *ErrorCode.GetErrorMessage());
 		return;
 	}
-	if (ModioUI::GetInterfaceWidgetChecked(GetImageWidget()))
+	if (ErrorCode || !Image.IsSet())
 	{
-		IModioUIImageDisplayWidget::Execute_BeginLoadImageFromFile(GetImageWidget().GetObject(), Image.GetValue());
+		UE_LOG(ModioUICore, Error, TEXT("Get bad response requesting image: %s"), *ErrorCode.GetErrorMessage());
+		return;
 	}
+	DisplayImage(Image.GetValue(), LogoSize == EModioLogoSize::Thumb1280);
 }
@@ -10,6 +10,7 @@
 
 #include "UI/Components/Misc/ModioDefaultModListView.h"
 
+#include "ModioUIStats.h"
 #include "UI/Components/Slate/SModioDataSourceAwareTableRow.h"
 #include "UI/Interfaces/IModioUIDataSourceWidget.h"
 #include "UI/Interfaces/IModioUISelectableWidget.h"
@@ -42,36 +43,53 @@ void UModioDefaultModListView::NativeSetListItems(const TArray<UObject*>& InList
 	ClearSelection();
 	if (bAddToExisting)
 	{
+		TGuardValue<bool> UpdatingListItems(bUpdatingListItems, true);
 		TArray<UObject*> ExistingItems = GetListItems();
+		const int32 FirstNewIndex = ExistingItems.Num();
 		ExistingItems.Append(InListItems);
 		SetListItems(ExistingItems);
+		ListItemIndex.Append(GetListItems(), FirstNewIndex);
 	}
 	else
 	{
+		TGuardValue<bool> UpdatingListItems(bUpdatingListItems, true);
 		SetListItems(InListItems);
+		ListItemIndex.Rebuild(GetListItems());
 	}
 }
 
 void UModioDefaultModListView::NativeSetModSelectionByID(FModioModID ModID)
 {
-	UObject* const* FirstItemMatchingModID = GetListItems().FindByPredicate([ModID](UObject* CurrentListItem) {
-		if (!CurrentListItem || !CurrentListItem->Implements<UModioModInfoUIDetails>())
-		{
-			return false;
-		}
-		return IModioModInfoUIDetails::Execute_GetModID(CurrentListItem) == ModID;
-	});
-	if (FirstItemMatchingModID)
+	const int32 Index = ListItemIndex.FindModID(ModID, GetListItems());
+	if (Index != INDEX_NONE)
+	{
+		SetSelectedItem(GetItemAt(Index));
+	}
+}
+
+void UModioDefaultModListView::OnItemsChanged(const TArray<UObject*>& AddedItems, const TArray<UObject*>& RemovedItems)
+{
+	Super::OnItemsChanged(AddedItems, RemovedItems);
+	if (!bUpdatingListItems)
 	{
-		SetSelectedItem(*FirstItemMatchingModID);
+		ListItemIndex.NotifyItemsChanged(GetListItems(), AddedItems, RemovedItems);
 	}
 }
 
+int32 UModioDefaultModListView::FindIndexForItem(const UObject* Item) const
+{
+	return ListItemIndex.FindItem(Item, GetListItems());
+}
+
 void UModioDefaultModListView::NativeSetObjects(const TArray<UObject*>& InObjects)
 {
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_ListRegeneration);
+
+	TGuardValue<bool> UpdatingListItems(bUpdatingListItems, true);
 	ClearListItems();
 	ClearSelection();
 	SetListItems(InObjects);
+	ListItemIndex.Rebuild(GetListItems());
 
 	// TODO: Ideally we only want to regenerate our entries if our in list is empty or not. In some places we do not
 	// guard against populating the view with the same data however so this is currently required to be called.
@@ -101,9 +119,13 @@ void UModioDefaultModListView::NativeRemoveObjectWidgetCreatedHandler(
 
 void UModioDefaultModListView::SetValues_Implementation(const TArray<UObject*>& InValues)
 {
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_ListRegeneration);
+
+	TGuardValue<bool> UpdatingListItems(bUpdatingListItems, true);
 	ClearListItems();
 	ClearSelection();
 	SetListItems(InValues);
+	ListItemIndex.Rebuild(GetListItems());
 	RegenerateAllEntries();
 }
 
@@ -119,7 +141,7 @@ UObject* UModioDefaultModListView::GetSingleSelectedValue_Implementation()
 
 int32 UModioDefaultModListView::GetSingleSelectionIndex_Implementation()
 {
-	return GetIndexForItem(GetSelectedItem());
+	return FindIndexForItem(GetSelectedItem());
 }
 
 void UModioDefaultModListView::ClearSelectedValues_Implementation()
@@ -212,7 +234,7 @@ void UModioDefaultModListView::SetListEntryWidgetClass_Implementation(TSubclassO
 
 int32 UModioDefaultModListView::GetIndexForValue_Implementation(UObject* Value) const
 {
-	return GetIndexForItem(Value);
+	return FindIndexForItem(Value);
 }
 
 UUserWidget* UModioDefaultModListView::GetWidgetForValue_Implementation(UObject* Value) const
@@ -277,5 +299,5 @@ void UModioDefaultModListView::NotifySelectionChanged(UObject* SelectedItem)
 		OnSelectedValueChanged.Broadcast(SelectedItem);
 	}
 
-	LastSelectedIndex = GetIndexForItem(SelectedItem);
+	LastSelectedIndex = FindIndexForItem(SelectedItem);
 }
\ No newline at end of file
@@ -10,6 +10,7 @@
 
 #include "UI/Components/Misc/ModioDefaultObjectSelector.h"
 
+#include "ModioUIStats.h"
 #include "TimerManager.h"
 #include "UI/Components/Slate/SModioDataSourceAwareTableRow.h"
 #include "UI/Interfaces/IModioModTagUIDetails.h"
@@ -81,6 +82,8 @@ int32 UModioDefaultObjectSelector::GetSingleSelectionIndex_Implementation()
 
 void UModioDefaultObjectSelector::SetValues_Implementation(const TArray<UObject*>& InValues)
 {
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_ListRegeneration);
+
 	ClearListItems();
 	ClearSelection();
 	if (IModioUIObjectSelector::Execute_GetMultiSelectionAllowed(this) && MultipleSelectionListItemClass)
@@ -243,6 +246,8 @@ void UModioDefaultObjectSelector::NotifySelectionChanged(UObject* SelectedItem)
 
 void UModioDefaultObjectSelector::NativeSetObjects(const TArray<UObject*>& InObjects)
 {
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_ListRegeneration);
+
 	SetListItems(InObjects);
 	RegenerateAllEntries();
 }
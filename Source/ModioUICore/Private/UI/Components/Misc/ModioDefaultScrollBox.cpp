@@ -11,6 +11,7 @@
 #include "UI/Components/Misc/ModioDefaultScrollBox.h"
 
 #include "Misc/EngineVersionComparison.h"
+#include "Widgets/Layout/SScrollBox.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(ModioDefaultScrollBox)
 
@@ -22,28 +23,35 @@ void UModioDefaultScrollBox::SynchronizeProperties()
 
 TSharedRef<SWidget> UModioDefaultScrollBox::RebuildWidget()
 {
+	// The new Slate widget has no navigation of its own yet
+	AppliedNavigationState = INDEX_NONE;
+	LastScrollOffsetOfEnd = -1.0f;
 	UpdateNavigationData(GetScrollOffset());
 	OnUserScrolled.RemoveDynamic(this, &UModioDefaultScrollBox::OnUserScrolledHandle);
 	OnUserScrolled.AddDynamic(this, &UModioDefaultScrollBox::OnUserScrolledHandle);
 
-	// TODO: This might be a bit hacky, but it's the only way I found to make sure that the scroll box GetScrollOffsetOfEnd() is correct (it is set up in SScrollBox sometime during the tick, not the first though). Revise this if you find a better way.
-	ON_SCOPE_EXIT
-	{
-		if (NavigationDataTickHandle.IsValid())
-		{
-			FTSTicker::GetCoreTicker().RemoveTicker(NavigationDataTickHandle);
-			NavigationDataTickHandle.Reset();
-		}
+	TSharedRef<SWidget> Widget = Super::RebuildWidget();
 
-		NavigationDataTickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateWeakLambda(this, [this](float Time) {
-			UpdateNavigationData(GetScrollOffset());
+	// GetScrollOffsetOfEnd() is only correct once SScrollBox has been laid out, and changes whenever the content or
+	// the scroll box is resized, so navigation is refreshed whenever it changes rather than on a timer
+	if (MyScrollBox.IsValid())
+	{
+		MyScrollBox->RegisterActiveTimer(
+			0.0f, FWidgetActiveTimerDelegate::CreateUObject(this, &UModioDefaultScrollBox::WatchScrollExtent));
+	}
 
-			// Run only once
-			return false;
-		}), 0.25f); // This amount of time is somewhat arbitrary, but it seems to work well enough 
-	};
+	return Widget;
+}
 
-	return Super::RebuildWidget();
+EActiveTimerReturnType UModioDefaultScrollBox::WatchScrollExtent(double InCurrentTime, float InDeltaTime)
+{
+	const float OffsetOfEnd = GetScrollOffsetOfEnd();
+	if (OffsetOfEnd != LastScrollOffsetOfEnd)
+	{
+		LastScrollOffsetOfEnd = OffsetOfEnd;
+		UpdateNavigationData(GetScrollOffset());
+	}
+	return EActiveTimerReturnType::Continue;
 }
 
 void UModioDefaultScrollBox::OnUserScrolledHandle_Implementation(float CurrentOffset)
@@ -58,6 +66,25 @@ void UModioDefaultScrollBox::UpdateNavigationData_Implementation(int32 PendingSc
 		return;
 	}
 
+	#if UE_VERSION_OLDER_THAN(5, 2, 0)
+	const EOrientation ScrollOrientation = Orientation;
+	#else
+	const EOrientation ScrollOrientation = GetOrientation();
+	#endif
+	const float OffsetOfEnd = GetScrollOffsetOfEnd();
+	const bool bAtStart = PendingScrollOffset != INDEX_NONE && PendingScrollOffset <= 0;
+	const bool bAtEnd = PendingScrollOffset != INDEX_NONE &&
+	                    (OffsetOfEnd == 0.0f || (OffsetOfEnd > 0.0f && float(PendingScrollOffset) >= OffsetOfEnd));
+
+	// The rules only differ at the boundaries, so scrolling between them leaves the navigation as it is
+	const int32 NavigationState = (bAtStart ? 1 : 0) | (bAtEnd ? 2 : 0) | (bScrollByNavigationInput ? 4 : 0) |
+	                              (static_cast<int32>(ScrollOrientation) << 3);
+	if (!IsDesignTime() && IsValid(UserDefinedNavigation) && NavigationState == AppliedNavigationState)
+	{
+		return;
+	}
+	AppliedNavigationState = NavigationState;
+
 	if (IsDesignTime() || !IsValid(UserDefinedNavigation))
 	{
 		UserDefinedNavigation = NewObject<UWidgetNavigation>(this);
@@ -70,39 +97,30 @@ void UModioDefaultScrollBox::UpdateNavigationData_Implementation(int32 PendingSc
 	FCustomWidgetNavigationDelegate NavigationDelegate;
 	NavigationDelegate.BindUFunction(this, "HandleCustomBoundaryNavigation");
 
-
-	#if UE_VERSION_OLDER_THAN(5, 2, 0)
-	if (Orientation == EOrientation::Orient_Vertical)
-		#else
-	if (GetOrientation() == EOrientation::Orient_Vertical)
-		#endif
+	if (ScrollOrientation == EOrientation::Orient_Vertical)
 	{
 		SetNavigationRuleCustomBoundary(EUINavigation::Down, NavigationDelegate);
 		SetNavigationRuleCustomBoundary(EUINavigation::Up, NavigationDelegate);
 	}
-	#if UE_VERSION_OLDER_THAN(5, 2, 0)
-	else if (Orientation == EOrientation::Orient_Horizontal)
-		#else
-	else if (GetOrientation() == EOrientation::Orient_Horizontal)
-		#endif
+	else if (ScrollOrientation == EOrientation::Orient_Horizontal)
 	{
 		SetNavigationRuleCustomBoundary(EUINavigation::Right, NavigationDelegate);
 		SetNavigationRuleCustomBoundary(EUINavigation::Left, NavigationDelegate);
 	}
-		
+
 	if (!bScrollByNavigationInput || IsDesignTime())
 	{
 		Navigation = UserDefinedNavigation;
 		BuildNavigation();
 	}
-	else if (PendingScrollOffset != INDEX_NONE && (PendingScrollOffset <= 0 || float(PendingScrollOffset) >= GetScrollOffsetOfEnd() || GetScrollOffsetOfEnd() == 0.0f))
+	else if (bAtStart || bAtEnd)
 	{
-		if (PendingScrollOffset <= 0)
+		if (bAtStart)
 		{
 			Navigation->Up = UserDefinedNavigation->Up;
 			Navigation->Left = UserDefinedNavigation->Left;
 		}
-		if (GetScrollOffsetOfEnd() == 0.0f || (GetScrollOffsetOfEnd() > 0.0f && float(PendingScrollOffset) >= GetScrollOffsetOfEnd()))
+		if (bAtEnd)
 		{
 			Navigation->Right = UserDefinedNavigation->Right;
 			Navigation->Down = UserDefinedNavigation->Down;
@@ -11,7 +11,6 @@
 #include "UI/Components/Misc/ModioModCollectionStatusWidget.h"
 
 #include "UI/Interfaces/IModioModCollectionInfoUIDetails.h"
-#include "ModioSubsystem.h"
 #include "ModioUISubsystem.h"
 
 FModioModCollectionInfo UModioModCollectionStatusWidget::GetModCollectionInfo()
@@ -37,31 +36,23 @@ void UModioModCollectionStatusWidget::NativeSetDataSource(UObject* InDataSource)
 	Super::NativeSetDataSource(InDataSource);
 	if (DataSource)
 	{
-		if (UModioSubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioSubsystem>())
+		if (UModioUISubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioUISubsystem>())
 		{
-			Subsystem->ListUserFollowedModCollectionsAsync(
-				{}, FOnListFollowedModCollectionsDelegateFast::CreateLambda(
-						[this](FModioErrorCode ec, TOptional<FModioModCollectionInfoList> FollowedCollections) {
-							if (ec)
-							{
-								UE_LOG(ModioUICore, Error, TEXT("Failed to Check followed collections: %s"), *ec.GetErrorMessage());
-							}
-							else
-							{
-								// This is a temporary solution until we include a syncronous method of querying follow state
-								bool bFoundCollection = false;
-								FModioModCollectionID ID = GetModCollectionInfo().Id;
-								for (const FModioModCollectionInfo& Info : FollowedCollections.GetValue().GetRawList())
-								{
-									if (Info.Id == ID)
-									{
-										bFoundCollection = true;
-										break;
-									}
-								}
-								SetModCollectionFollowState(bFoundCollection ? EModioModCollectionState::Followed : EModioModCollectionState::NotFollowed);
-							}
-						}));
+			// Answered immediately from the subsystem's followed collections once they have been fetched
+			Subsystem->QueryIsUserFollowingModCollection(
+				GetModCollectionInfo().Id,
+				FOnQueryFollowedModCollectionCompletedFast::CreateWeakLambda(this, [this](FModioErrorCode ec,
+				                                                                          bool bIsFollowed) {
+					if (ec)
+					{
+						UE_LOG(ModioUICore, Error, TEXT("Failed to Check followed collections: %s"), *ec.GetErrorMessage());
+					}
+					else
+					{
+						SetModCollectionFollowState(bIsFollowed ? EModioModCollectionState::Followed
+						                                        : EModioModCollectionState::NotFollowed);
+					}
+				}));
 		}
 	}
 }
@@ -12,6 +12,8 @@
 
 #include "Engine/GameInstance.h"
 #include "ModioSubsystem.h"
+#include "ModioUIStats.h"
+#include "ModioUISubsystem.h"
 #include "Input/CommonUIActionRouterBase.h"
 #include "UI/Interfaces/IModioModCollectionInfoUIDetails.h"
 #include "UI/Interfaces/IModioUICommandMenu.h"
@@ -47,6 +49,21 @@ void UModioDefaultModCollectionTile::NotifyHoverStateChanged(bool bNewHoveredSta
 	{
 		OnHoverStateChanged.Broadcast(this, bNewHoveredState);
 	}
+	if (bNewHoveredState)
+	{
+		PrepareDetailsDialog();
+	}
+}
+
+void UModioDefaultModCollectionTile::PrepareDetailsDialog()
+{
+	if (DataSource)
+	{
+		if (UModioUISubsystem* UISubsystem = GEngine->GetEngineSubsystem<UModioUISubsystem>())
+		{
+			UISubsystem->PrepareDialog(EModioUIDialogType::ModCollectionDetails, DataSource);
+		}
+	}
 }
 
 void UModioDefaultModCollectionTile::NativeOnItemSelectionChanged(bool bIsSelected)
@@ -59,6 +76,10 @@ void UModioDefaultModCollectionTile::NativeOnItemSelectionChanged(bool bIsSelect
 		bSelected = bIsSelected;
 		// Emits our external selection event
 		OnSelected.Broadcast(this, bIsSelected);
+		if (bIsSelected)
+		{
+			PrepareDetailsDialog();
+		}
 
 		// During the selection change, some Common UI-specific actions may need to be updated
 		// This doesn't lead to performance issues, as it's only called when the selection state changes
@@ -208,6 +229,8 @@ void UModioDefaultModCollectionTile::NativePreConstruct()
 
 void UModioDefaultModCollectionTile::NativeSetDataSource(UObject* InDataSource)
 {
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_TileSetDataSource);
+
 	Super::NativeSetDataSource(InDataSource);
 	DataSource = InDataSource;
 
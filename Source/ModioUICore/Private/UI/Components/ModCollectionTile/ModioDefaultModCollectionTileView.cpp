@@ -9,6 +9,7 @@
  */
 
 #include "UI/Components/ModCollectionTile/ModioDefaultModCollectionTileView.h"
+#include "ModioUIStats.h"
 #include "UI/Components/Slate/SModioDataSourceAwareTableRow.h"
 
 #if WITH_EDITOR
@@ -38,6 +39,8 @@ void UModioDefaultModCollectionTileView::ValidateCompiledDefaults(IWidgetCompile
 
 void UModioDefaultModCollectionTileView::NativeSetListItems(const TArray<UObject*>& InListItems, bool bAddToExisting)
 {
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_ListRegeneration);
+
 	ClearSelection();
 	if (bAddToExisting)
 	{
@@ -73,6 +76,8 @@ void UModioDefaultModCollectionTileView::NativeSetModCollectionSelectionByID(FMo
 
 void UModioDefaultModCollectionTileView::NativeSetObjects(const TArray<UObject*>& InObjects)
 {
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_ListRegeneration);
+
 	ClearListItems();
 	ClearSelection();
 	SetListItems(InObjects);
@@ -106,6 +111,8 @@ void UModioDefaultModCollectionTileView::NativeRemoveObjectWidgetCreatedHandler(
 
 void UModioDefaultModCollectionTileView::SetValues_Implementation(const TArray<UObject*>& InValues)
 {
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_ListRegeneration);
+
 	ClearListItems();
 	ClearSelection();
 	SetListItems(InValues);
@@ -10,6 +10,7 @@
 
 #include "UI/Components/ModTagSelector/ModioModTagSelector.h"
 
+#include "Core/ModioTagOptionsUI.h"
 #include "UI/ModioUICommonFunctionLibrary.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(ModioModTagSelector)
@@ -25,11 +26,7 @@ void UModioModTagSelector::SetAvailableTagsFromBoundModTagOptions_Implementation
 {
 	// Keep a pointer to the bound tags so that we can inspect the selection state directly rather than asking the menu
 	CachedTagOptions = InOptions;
-	if (GetSelectorMenuWidget().GetObject())
-	{
-		IModioUIModTagSelector::Execute_SetAvailableTagsFromBoundModTagOptions(GetSelectorMenuWidget().GetObject(),
-																			   CachedTagOptions);
-	}
+	MenuState.ContentChanged();
 }
 
 TArray<FString> UModioModTagSelector::GetSelectedTags_Implementation()
@@ -42,30 +39,128 @@ TArray<FString> UModioModTagSelector::GetSelectedTags_Implementation()
 	return {};
 }
 
+int32 UModioModTagSelector::NativeGetNumSelectedTags()
+{
+	if (UModioModTagOptionsUI* Options = NativeGetTagOptionsObject())
+	{
+		return Options->GetNumSelectedTags();
+	}
+	return IModioUIModTagSelector::NativeGetNumSelectedTags();
+}
+
+UModioModTagOptionsUI* UModioModTagSelector::NativeGetTagOptionsObject()
+{
+	return Cast<UModioModTagOptionsUI>(CachedTagOptions.GetObject());
+}
+
 void UModioModTagSelector::ClearSelectedTags_Implementation()
 {
-	if (GetSelectorMenuWidget().GetObject())
+	if (MenuState.IsPopulated())
+	{
+		if (GetSelectorMenuWidget().GetObject())
+		{
+			IModioUIModTagSelector::Execute_ClearSelectedTags(GetSelectorMenuWidget().GetObject());
+		}
+		return;
+	}
+
+	// With no category widgets to update, clearing the tag options themselves is all there is to do
+	if (CachedTagOptions.GetObject() && NativeGetNumSelectedTags() > 0)
 	{
-		IModioUIModTagSelector::Execute_ClearSelectedTags(GetSelectorMenuWidget().GetObject());
+		IModioModTagOptionsUIDetails::Execute_ClearSelectedTags(CachedTagOptions.GetObject());
+		OnTagSelectionChanged.Broadcast();
 	}
 }
 
 void UModioModTagSelector::AddTagSelectionChangedHandler_Implementation(const FModioOnTagSelectionChanged& Handler)
 {
-	if (GetSelectorMenuWidget().GetObject())
+	OnTagSelectionChanged.AddUnique(Handler);
+}
+
+void UModioModTagSelector::RemoveTagSelectionChangedHandler_Implementation(const FModioOnTagSelectionChanged& Handler)
+{
+	OnTagSelectionChanged.Remove(Handler);
+}
+
+void UModioModTagSelector::InternalTagSelectionChangedHandler()
+{
+	OnTagSelectionChanged.Broadcast();
+}
+
+bool UModioModTagSelector::FillMenu()
+{
+	UObject* SelectorMenu = GetSelectorMenuWidget().GetObject();
+	if (!SelectorMenu || !CachedTagOptions.GetObject())
 	{
-		IModioUIModTagSelector::Execute_AddTagSelectionChangedHandler(GetSelectorMenuWidget().GetObject(), Handler);
+		return false;
 	}
+	IModioUIModTagSelector::Execute_SetAvailableTagsFromBoundModTagOptions(SelectorMenu, CachedTagOptions);
+	return true;
 }
 
-void UModioModTagSelector::RemoveTagSelectionChangedHandler_Implementation(const FModioOnTagSelectionChanged& Handler)
+void UModioModTagSelector::EmptyMenu()
 {
-	if (GetSelectorMenuWidget().GetObject())
+	if (UObject* SelectorMenu = GetSelectorMenuWidget().GetObject())
 	{
-		IModioUIModTagSelector::Execute_RemoveTagSelectionChangedHandler(GetSelectorMenuWidget().GetObject(), Handler);
+		IModioUIModTagSelector::Execute_SetAvailableTagsFromBoundModTagOptions(
+			SelectorMenu, TScriptInterface<UModioModTagOptionsUIDetails>());
 	}
 }
 
+void UModioModTagSelector::OnMenuToggleClicked(UObject* ClickContext)
+{
+	MenuState.Populate();
+}
+
+void UModioModTagSelector::OnMenuToggleStateChanged(UObject* Context, bool bIsOpen)
+{
+	MenuState.OpenStateChanged(bIsOpen);
+}
+
+void UModioModTagSelector::NativePreConstruct()
+{
+	// Resolved before Blueprint PreConstruct runs, as it may ask for the anchor
+	DefaultMenuAnchor = ModioUI::FindMenuAnchorWidget(WidgetTree);
+	Super::NativePreConstruct();
+	// Rebroadcast selection changes from the menu, so handlers survive the menu being emptied and repopulated
+	if (UObject* SelectorMenu = GetSelectorMenuWidget().GetObject())
+	{
+		FModioOnTagSelectionChanged SelectionDelegate;
+		SelectionDelegate.BindUFunction(
+			this, GET_FUNCTION_NAME_CHECKED(UModioModTagSelector, InternalTagSelectionChangedHandler));
+		IModioUIModTagSelector::Execute_AddTagSelectionChangedHandler(SelectorMenu, SelectionDelegate);
+	}
+
+	// The menu is populated on first open, so watch for the user opening it
+	if (UObject* MenuToggle = GetMenuToggleClickableWidget().GetObject())
+	{
+		FModioClickableOnClicked ClickedDelegate;
+		ClickedDelegate.BindUFunction(this, GET_FUNCTION_NAME_CHECKED(UModioModTagSelector, OnMenuToggleClicked));
+		IModioUIClickableWidget::Execute_AddClickedHandler(MenuToggle, ClickedDelegate);
+	}
+	MenuState.Initialize(*this, GetMenuAnchorWidget().GetObject(), GetMenuToggleClickableWidget().GetObject(),
+						 [this]() { return FillMenu(); }, [this]() { EmptyMenu(); });
+	if (UObject* MenuOpenStateSource = MenuState.GetOpenStateSource())
+	{
+		FModioOnToggleStateChanged ToggleDelegate;
+		ToggleDelegate.BindUFunction(this, GET_FUNCTION_NAME_CHECKED(UModioModTagSelector, OnMenuToggleStateChanged));
+		IModioToggleableWidget::Execute_AddToggleStateChangedHandler(MenuOpenStateSource, ToggleDelegate);
+	}
+}
+
+void UModioModTagSelector::NativeOnAddedToFocusPath(const FFocusEvent& InFocusEvent)
+{
+	Super::NativeOnAddedToFocusPath(InFocusEvent);
+	// Focus reaching the selector is a strong hint the menu is about to be opened
+	MenuState.Populate();
+}
+
+void UModioModTagSelector::NativeOnMouseEnter(const FGeometry& InGeometry, const FPointerEvent& InMouseEvent)
+{
+	Super::NativeOnMouseEnter(InGeometry, InMouseEvent);
+	MenuState.Populate();
+}
+
 TScriptInterface<UModioUIModTagSelector> UModioModTagSelector::GetSelectorMenuWidget_Implementation() const
 {
 	return nullptr;
@@ -75,3 +170,8 @@ TScriptInterface<UModioUIClickableWidget> UModioModTagSelector::GetMenuToggleCli
 {
 	return nullptr;
 }
+
+TScriptInterface<UModioToggleableWidget> UModioModTagSelector::GetMenuAnchorWidget_Implementation() const
+{
+	return TScriptInterface<UModioToggleableWidget>(DefaultMenuAnchor.Get());
+}
@@ -10,7 +10,11 @@
 
 #include "UI/Components/ModTagSelector/ModioModTagSelectorMenu.h"
 
+#include "Core/ModioTagOptionsUI.h"
+#include "Engine/Engine.h"
+#include "ModioUISubsystem.h"
 #include "UI/Interfaces/IModioUIObjectSelector.h"
+#include "UI/Interfaces/IModioUISelectableWidget.h"
 #include "UI/ModioUICommonFunctionLibrary.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(ModioModTagSelectorMenu)
@@ -48,22 +52,87 @@ TArray<FString> UModioModTagSelectorMenu::GetSelectedTags_Implementation()
 	return {};
 }
 
+int32 UModioModTagSelectorMenu::NativeGetNumSelectedTags()
+{
+	if (UModioModTagOptionsUI* Options = NativeGetTagOptionsObject())
+	{
+		return Options->GetNumSelectedTags();
+	}
+	return IModioUIModTagSelector::NativeGetNumSelectedTags();
+}
+
+UModioModTagOptionsUI* UModioModTagSelectorMenu::NativeGetTagOptionsObject()
+{
+	return Cast<UModioModTagOptionsUI>(CachedTagOptions.GetObject());
+}
+
 void UModioModTagSelectorMenu::ClearSelectedTags_Implementation()
 {
 	if (UWidget* CategoryContainerWidget = ModioUI::GetInterfaceWidgetChecked(GetCategoryContainerWidget()))
 	{
+		UModioModTagOptionsUI* Options = Cast<UModioModTagOptionsUI>(CachedTagOptions.GetObject());
+		if (Options && Options->GetNumSelectedTags() == 0)
+		{
+			return;
+		}
+		const TArray<UModioModTagUI*> PreviouslySelectedTags =
+			Options ? Options->GetSelectedTagObjects() : TArray<UModioModTagUI*>();
+
 		// Clear the selected tags on our data source
 		IModioModTagOptionsUIDetails::Execute_ClearSelectedTags(CachedTagOptions.GetObject());
 
-		// Redraw the categories (and in turn their tags) by re-setting the data source containing categories to display
-		// on the internal widget
-		IModioUIObjectListWidget::Execute_SetObjects(
-			CategoryContainerWidget,
-			UModioUICommonFunctionLibrary::NativeConvertInterfaceToObjectArray(GetAllowedTags()));
+		// Only the entries for previously selected tags need to change, so update those in place where we can find them
+		// and fall back to redrawing every category otherwise
+		if (!Options || !DeselectTagEntries(*CategoryContainerWidget, *Options, PreviouslySelectedTags))
+		{
+			// Redraw the categories (and in turn their tags) by re-setting the data source containing categories to
+			// display on the internal widget
+			IModioUIObjectListWidget::Execute_SetObjects(
+				CategoryContainerWidget,
+				UModioUICommonFunctionLibrary::NativeConvertInterfaceToObjectArray(GetAllowedTags()));
+		}
 		NotifySelectionChanged();
 	}
 }
 
+bool UModioModTagSelectorMenu::DeselectTagEntries(UWidget& CategoryContainerWidget, UModioModTagOptionsUI& Options,
+												  const TArray<UModioModTagUI*>& Tags)
+{
+	if (!CategoryContainerWidget.Implements<UModioUIObjectSelector>())
+	{
+		return false;
+	}
+
+	for (UModioModTagUI* Tag : Tags)
+	{
+		UModioModTagInfoUI* Category = Tag && Tag->OwningOptions == &Options ? Tag->OwningCategory.Get() : nullptr;
+		if (!Category)
+		{
+			return false;
+		}
+
+		UUserWidget* CategoryWidget =
+			IModioUIObjectSelector::Execute_GetWidgetForValue(&CategoryContainerWidget, Category);
+		if (!CategoryWidget || !CategoryWidget->Implements<UModioUIObjectSelector>())
+		{
+			return false;
+		}
+
+		UUserWidget* EntryWidget = IModioUIObjectSelector::Execute_GetWidgetForValue(CategoryWidget, Tag);
+		if (!EntryWidget || !EntryWidget->Implements<UModioUISelectableWidget>())
+		{
+			// Entries that are scrolled out of view are regenerated from the tag's state, so there is nothing to update
+			if (!EntryWidget)
+			{
+				continue;
+			}
+			return false;
+		}
+		IModioUISelectableWidget::Execute_SetSelectedState(EntryWidget, false);
+	}
+	return true;
+}
+
 TArray<TScriptInterface<UModioModTagCategoryUIDetails>> UModioModTagSelectorMenu::GetAllowedTags_Implementation()
 {
 	if (CachedTagOptions.GetObject() &&
@@ -143,6 +212,36 @@ void UModioModTagSelectorMenu::OnCategoryEntrySelectionChanged_Implementation(UO
 	NotifySelectionChanged();
 }
 
+void UModioModTagSelectorMenu::NativeOnInitialized()
+{
+	Super::NativeOnInitialized();
+
+	// A menu owned by another tag selector (such as a dropdown or filter panel) shows whatever that selector binds to
+	// it, and populating it here as well would build a second, unselected set of tags
+	const UUserWidget* OwningWidget = GetTypedOuter<UUserWidget>();
+	const bool bOwnedByTagSelector =
+		OwningWidget && OwningWidget->GetClass()->ImplementsInterface(UModioUIModTagSelector::StaticClass());
+
+	if (bPopulateFromSharedTagOptions && !bOwnedByTagSelector && !CachedTagOptions.GetObject())
+	{
+		if (UModioUISubsystem* UISubsystem = GEngine->GetEngineSubsystem<UModioUISubsystem>())
+		{
+			UISubsystem->GetTagOptionsListAsync(FOnGetModTagOptionsDelegateFast::CreateUObject(
+				this, &UModioModTagSelectorMenu::OnSharedTagOptionsReceived));
+		}
+	}
+}
+
+void UModioModTagSelectorMenu::OnSharedTagOptionsReceived(FModioErrorCode ErrorCode,
+                                                          TOptional<FModioModTagOptions> Options)
+{
+	// The owner may have populated the menu explicitly while the request was in flight
+	if (!ErrorCode && Options.IsSet() && !CachedTagOptions.GetObject())
+	{
+		IModioUIModTagSelector::Execute_SetAvailableTagsFromModTagOptions(this, Options.GetValue());
+	}
+}
+
 void UModioModTagSelectorMenu::NativePreConstruct()
 {
 	Super::NativePreConstruct();
@@ -13,6 +13,8 @@
 #include "Engine/GameInstance.h"
 #include "Input/CommonUIActionRouterBase.h"
 #include "ModioSubsystem.h"
+#include "ModioUIStats.h"
+#include "ModioUISubsystem.h"
 #include "UI/Interfaces/IModioModInfoUIDetails.h"
 #include "UI/Interfaces/IModioUICommandMenu.h"
 #include "UI/Templates/Default/Commands/ModioUIDisplayFilteredModsCommand.h"
@@ -38,6 +40,21 @@ void UModioDefaultModTile::NotifyHoverStateChanged(bool bNewHoveredState)
 	{
 		OnHoverStateChanged.Broadcast(this, bNewHoveredState);
 	}
+	if (bNewHoveredState)
+	{
+		PrepareDetailsDialog();
+	}
+}
+
+void UModioDefaultModTile::PrepareDetailsDialog()
+{
+	if (DataSource)
+	{
+		if (UModioUISubsystem* UISubsystem = GEngine->GetEngineSubsystem<UModioUISubsystem>())
+		{
+			UISubsystem->PrepareDialog(EModioUIDialogType::ModDetails, DataSource);
+		}
+	}
 }
 
 bool UModioDefaultModTile::GetSelectedStateEx()
@@ -66,6 +83,10 @@ void UModioDefaultModTile::NativeOnItemSelectionChanged(bool bIsSelected)
 		bSelected = bIsSelected;
 		// Emits our external selection event
 		OnSelected.Broadcast(this, bIsSelected);
+		if (bIsSelected)
+		{
+			PrepareDetailsDialog();
+		}
 
 		// During the selection change, some Common UI-specific actions may need to be updated
 		// This doesn't lead to performance issues, as it's only called when the selection state changes
@@ -200,6 +221,8 @@ void UModioDefaultModTile::NativePreConstruct()
 
 void UModioDefaultModTile::NativeSetDataSource(UObject* InDataSource)
 {
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_TileSetDataSource);
+
 	Super::NativeSetDataSource(InDataSource);
 	DataSource = InDataSource;
 
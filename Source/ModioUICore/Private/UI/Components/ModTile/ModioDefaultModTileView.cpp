@@ -10,6 +10,7 @@
 
 #include "UI/Components/ModTile/ModioDefaultModTileView.h"
 
+#include "ModioUIStats.h"
 #include "UI/Components/Slate/SModioDataSourceAwareTableRow.h"
 #include "UI/Interfaces/IModioModInfoUIDetails.h"
 #include "UI/Interfaces/IModioUIDataSourceWidget.h"
@@ -20,18 +21,50 @@
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(ModioDefaultModTileView)
 
+void UModioDefaultModTileView::SynchronizeProperties()
+{
+	Super::SynchronizeProperties();
+
+	if (!EntryBindingScheduler)
+	{
+		EntryBindingScheduler = MakeShared<FModioEntryBindingScheduler>(*this);
+	}
+	// The designer preview should always show fully bound entries
+	EntryBindingScheduler->SetFrameBudget(IsDesignTime() ? 0.0f : EntryBindingBudgetMilliseconds);
+}
+
+void UModioDefaultModTileView::ReleaseSlateResources(bool bReleaseChildren)
+{
+	// Rows are destroyed along with the Slate widget, so anything still queued has nothing left to bind
+	EntryBindingScheduler.Reset();
+
+	Super::ReleaseSlateResources(bReleaseChildren);
+}
+
+TSharedPtr<FModioEntryBindingScheduler> UModioDefaultModTileView::GetEntryBindingScheduler() const
+{
+	return EntryBindingScheduler;
+}
+
 void UModioDefaultModTileView::NativeSetListItems(const TArray<UObject*>& InListItems, bool bAddToExisting)
 {
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_ListRegeneration);
+
 	ClearSelection();
 	if (bAddToExisting)
 	{
+		TGuardValue<bool> UpdatingListItems(bUpdatingListItems, true);
 		TArray<UObject*> ExistingItems = GetListItems();
+		const int32 FirstNewIndex = ExistingItems.Num();
 		ExistingItems.Append(InListItems);
 		SetListItems(ExistingItems);
+		ListItemIndex.Append(GetListItems(), FirstNewIndex);
 	}
 	else
 	{
+		TGuardValue<bool> UpdatingListItems(bUpdatingListItems, true);
 		SetListItems(InListItems);
+		ListItemIndex.Rebuild(GetListItems());
 	}
 
 	// TODO: Ideally we only want to regenerate our entries if our in list is empty or not. In some places we do not
@@ -41,24 +74,36 @@ void UModioDefaultModTileView::NativeSetListItems(const TArray<UObject*>& InList
 
 void UModioDefaultModTileView::NativeSetModSelectionByID(FModioModID ModID)
 {
-	UObject* const* FirstItemMatchingModID = GetListItems().FindByPredicate([ModID](UObject* CurrentListItem) {
-		if (!CurrentListItem || !CurrentListItem->Implements<UModioModInfoUIDetails>())
-		{
-			return false;
-		}
-		return IModioModInfoUIDetails::Execute_GetModID(CurrentListItem) == ModID;
-	});
-	if (FirstItemMatchingModID)
+	const int32 Index = ListItemIndex.FindModID(ModID, GetListItems());
+	if (Index != INDEX_NONE)
 	{
-		SetSelectedItem(*FirstItemMatchingModID);
+		SetSelectedItem(GetItemAt(Index));
 	}
 }
 
+void UModioDefaultModTileView::OnItemsChanged(const TArray<UObject*>& AddedItems, const TArray<UObject*>& RemovedItems)
+{
+	Super::OnItemsChanged(AddedItems, RemovedItems);
+	if (!bUpdatingListItems)
+	{
+		ListItemIndex.NotifyItemsChanged(GetListItems(), AddedItems, RemovedItems);
+	}
+}
+
+int32 UModioDefaultModTileView::FindIndexForItem(const UObject* Item) const
+{
+	return ListItemIndex.FindItem(Item, GetListItems());
+}
+
 void UModioDefaultModTileView::NativeSetObjects(const TArray<UObject*>& InObjects)
 {
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_ListRegeneration);
+
+	TGuardValue<bool> UpdatingListItems(bUpdatingListItems, true);
 	ClearListItems();
 	ClearSelection();
 	SetListItems(InObjects);
+	ListItemIndex.Rebuild(GetListItems());
 
 	// TODO: Ideally we only want to regenerate our entries if our in list is empty or not. In some places we do not
 	// guard against populating the view with the same data however so this is currently required to be called.
@@ -88,9 +133,13 @@ void UModioDefaultModTileView::NativeRemoveObjectWidgetCreatedHandler(
 
 void UModioDefaultModTileView::SetValues_Implementation(const TArray<UObject*>& InValues)
 {
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_ListRegeneration);
+
+	TGuardValue<bool> UpdatingListItems(bUpdatingListItems, true);
 	ClearListItems();
 	ClearSelection();
 	SetListItems(InValues);
+	ListItemIndex.Rebuild(GetListItems());
 	RegenerateAllEntries();
 }
 
@@ -106,7 +155,7 @@ UObject* UModioDefaultModTileView::GetSingleSelectedValue_Implementation()
 
 int32 UModioDefaultModTileView::GetSingleSelectionIndex_Implementation()
 {
-	int32 Index = GetIndexForItem(GetSelectedItem());
+	int32 Index = FindIndexForItem(GetSelectedItem());
 	if (Index == INDEX_NONE)
 	{
 		Index = LastSelectedIndex;
@@ -204,7 +253,7 @@ void UModioDefaultModTileView::SetListEntryWidgetClass_Implementation(TSubclassO
 
 int32 UModioDefaultModTileView::GetIndexForValue_Implementation(UObject* Value) const
 {
-	return GetIndexForItem(Value);
+	return FindIndexForItem(Value);
 }
 
 UUserWidget* UModioDefaultModTileView::GetWidgetForValue_Implementation(UObject* Value) const
@@ -255,7 +304,7 @@ void UModioDefaultModTileView::OnSelectionChangedInternal(NullableItemType First
 	TArray<UObject*> SelectedItems;
 	if (FirstSelectedItem && GetSelectedItems(SelectedItems) > 0 && SelectedItems.Contains(FirstSelectedItem))
 	{
-		LastSelectedIndex = GetIndexForItem(FirstSelectedItem);
+		LastSelectedIndex = FindIndexForItem(FirstSelectedItem);
 	}
 }
 
@@ -128,9 +128,16 @@ TArray<TScriptInterface<IModioModFilterUIDetails>> UModioPresetFilterSelector::G
 void UModioPresetFilterSelector::NativePreConstruct()
 {
 	Super::NativePreConstruct();
+	// The presets come from the plugin settings, so the list only needs them once rather than on every rebuild of this
+	// widget, which would also recreate its entries and lose the selection
+	if (bPresetsApplied && !IsDesignTime())
+	{
+		return;
+	}
 	// Query for available filter presets and pass them as bindable objects to the internal selector widget
 	IModioUIObjectSelector::Execute_SetValues(
 		this, UModioUICommonFunctionLibrary::NativeConvertInterfaceToObjectArray(GetFilterPresets()));
+	bPresetsApplied = GetPresetListWidget().GetObject() != nullptr;
 }
 
 bool UModioPresetFilterSelector::GetMultiSelectionAllowed_Implementation()
@@ -0,0 +1,212 @@
+/*
+ *  Copyright (C) 2025 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io UE Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue/blob/main/LICENSE>)
+ *
+ */
+
+#include "UI/Components/Slate/ModioEntryBindingScheduler.h"
+
+#include "Blueprint/IUserListEntry.h"
+#include "Blueprint/UserWidget.h"
+#include "Components/ListViewBase.h"
+#include "HAL/PlatformTime.h"
+#include "ModioUIStats.h"
+#include "UI/Interfaces/IModioEntryBindingSchedulerOwner.h"
+
+FModioEntryBindingScheduler::FModioEntryBindingScheduler(UListViewBase& InOwningListView)
+	: OwningListView(&InOwningListView)
+{
+}
+
+FModioEntryBindingScheduler::~FModioEntryBindingScheduler()
+{
+	if (TickHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+	}
+	// Entry widgets are pooled and may outlive us, so do not leave them hidden
+	for (const TPair<TObjectKey<UUserWidget>, FPendingBinding>& Binding : PendingBindings)
+	{
+		RestoreEntry(Binding.Value);
+	}
+	DEC_DWORD_STAT_BY(STAT_ModioUI_EntriesAwaitingBinding, PendingBindings.Num());
+}
+
+TSharedPtr<FModioEntryBindingScheduler> FModioEntryBindingScheduler::FindForListView(const UListViewBase* ListView)
+{
+	if (const IModioEntryBindingSchedulerOwner* Owner = Cast<IModioEntryBindingSchedulerOwner>(ListView))
+	{
+		return Owner->GetEntryBindingScheduler();
+	}
+	return nullptr;
+}
+
+void FModioEntryBindingScheduler::SetFrameBudget(float InBudgetMilliseconds)
+{
+	BudgetSeconds = FMath::Max(InBudgetMilliseconds, 0.0f) / 1000.0;
+	if (!IsEnabled())
+	{
+		Flush();
+	}
+}
+
+bool FModioEntryBindingScheduler::IsEnabled() const
+{
+	return BudgetSeconds > 0.0;
+}
+
+void FModioEntryBindingScheduler::Enqueue(UUserWidget& EntryWidget, TFunction<void()> Bind)
+{
+	if (FPendingBinding* Existing = PendingBindings.Find(&EntryWidget))
+	{
+		Existing->Bind = MoveTemp(Bind);
+		return;
+	}
+
+	FPendingBinding& Binding = PendingBindings.Add(&EntryWidget);
+	Binding.EntryWidget = &EntryWidget;
+	Binding.Bind = MoveTemp(Bind);
+	Binding.OriginalVisibility = EntryWidget.GetVisibility();
+
+	// A recycled entry still displays its previous item until it is bound, so hide it while keeping its slot
+	if (EntryWidget.IsVisible())
+	{
+		EntryWidget.SetVisibility(ESlateVisibility::Hidden);
+	}
+	INC_DWORD_STAT(STAT_ModioUI_EntriesAwaitingBinding);
+
+	if (!TickHandle.IsValid())
+	{
+		TickHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateSP(this, &FModioEntryBindingScheduler::Tick));
+	}
+}
+
+void FModioEntryBindingScheduler::Cancel(UUserWidget& EntryWidget)
+{
+	FPendingBinding Binding;
+	if (PendingBindings.RemoveAndCopyValue(&EntryWidget, Binding))
+	{
+		RestoreEntry(Binding);
+		DEC_DWORD_STAT(STAT_ModioUI_EntriesAwaitingBinding);
+	}
+}
+
+void FModioEntryBindingScheduler::Flush()
+{
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_DeferredEntryBinding);
+
+	// Bindings may queue or cancel other bindings, so always take them out of the map before running them
+	while (PendingBindings.Num() > 0)
+	{
+		TMap<TObjectKey<UUserWidget>, FPendingBinding>::TIterator It = PendingBindings.CreateIterator();
+		FPendingBinding Binding = MoveTemp(It.Value());
+		It.RemoveCurrent();
+		DEC_DWORD_STAT(STAT_ModioUI_EntriesAwaitingBinding);
+		RunBinding(Binding);
+	}
+}
+
+bool FModioEntryBindingScheduler::Tick(float DeltaTime)
+{
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_DeferredEntryBinding);
+
+	const double Deadline = FPlatformTime::Seconds() + BudgetSeconds;
+
+	FVector2D ListCenter = FVector2D::ZeroVector;
+	if (UListViewBase* ListView = OwningListView.Get())
+	{
+		ListCenter = ListView->GetCachedGeometry().GetAbsolutePositionAtCoordinates(FVector2D(0.5f, 0.5f));
+	}
+
+	// Drop bindings for entries that no longer exist, and rank the rest
+	TArray<TPair<float, TObjectKey<UUserWidget>>> Order;
+	Order.Reserve(PendingBindings.Num());
+	for (TMap<TObjectKey<UUserWidget>, FPendingBinding>::TIterator It = PendingBindings.CreateIterator(); It; ++It)
+	{
+		if (UUserWidget* EntryWidget = It.Value().EntryWidget.Get())
+		{
+			Order.Emplace(GetBindingPriority(*EntryWidget, ListCenter), It.Key());
+		}
+		else
+		{
+			It.RemoveCurrent();
+			DEC_DWORD_STAT(STAT_ModioUI_EntriesAwaitingBinding);
+		}
+	}
+	Order.Sort([](const TPair<float, TObjectKey<UUserWidget>>& A, const TPair<float, TObjectKey<UUserWidget>>& B) {
+		return A.Key < B.Key;
+	});
+
+	// Always bind at least one entry per frame so that the queue drains even when a single binding exceeds the budget.
+	// Earlier bindings may have queued or cancelled later ones, so each is looked up again before it runs
+	for (const TPair<float, TObjectKey<UUserWidget>>& Entry : Order)
+	{
+		FPendingBinding Binding;
+		if (!PendingBindings.RemoveAndCopyValue(Entry.Value, Binding))
+		{
+			continue;
+		}
+		DEC_DWORD_STAT(STAT_ModioUI_EntriesAwaitingBinding);
+		RunBinding(Binding);
+
+		if (FPlatformTime::Seconds() >= Deadline)
+		{
+			break;
+		}
+	}
+
+	if (PendingBindings.Num() == 0)
+	{
+		TickHandle.Reset();
+		return false;
+	}
+	return true;
+}
+
+void FModioEntryBindingScheduler::RunBinding(FPendingBinding& Binding)
+{
+	if (Binding.EntryWidget.IsValid())
+	{
+		// Bind before showing the entry, so that its previous item is never displayed
+		if (Binding.Bind)
+		{
+			Binding.Bind();
+		}
+		RestoreEntry(Binding);
+	}
+}
+
+void FModioEntryBindingScheduler::RestoreEntry(const FPendingBinding& Binding)
+{
+	UUserWidget* EntryWidget = Binding.EntryWidget.Get();
+	if (EntryWidget && EntryWidget->GetVisibility() == ESlateVisibility::Hidden)
+	{
+		EntryWidget->SetVisibility(Binding.OriginalVisibility);
+	}
+}
+
+float FModioEntryBindingScheduler::GetBindingPriority(UUserWidget& EntryWidget, const FVector2D& ListCenter) const
+{
+	if (EntryWidget.HasAnyUserFocus() || EntryWidget.HasFocusedDescendants())
+	{
+		return -2.0f;
+	}
+	if (EntryWidget.Implements<UUserListEntry>() && UUserListEntryLibrary::IsListItemSelected(&EntryWidget))
+	{
+		return -1.0f;
+	}
+
+	const FGeometry& EntryGeometry = EntryWidget.GetCachedGeometry();
+	if (EntryGeometry.GetLocalSize().IsNearlyZero())
+	{
+		// Not arranged yet, so most likely outside the visible area
+		return TNumericLimits<float>::Max();
+	}
+	return static_cast<float>(
+		FVector2D::DistSquared(EntryGeometry.GetAbsolutePositionAtCoordinates(FVector2D(0.5f, 0.5f)), ListCenter));
+}
@@ -11,6 +11,8 @@
 #include "UI/Components/TagDisplay/ModioModTagDisplay.h"
 
 #include "Core/ModioTagOptionsUI.h"
+#include "Engine/Engine.h"
+#include "ModioUISubsystem.h"
 #include "UI/Interfaces/IModioModInfoUIDetails.h"
 #include "UI/Interfaces/IModioModCollectionInfoUIDetails.h"
 #include "UI/Interfaces/IModioUIObjectListWidget.h"
@@ -31,9 +33,20 @@ void UModioModTagDisplay::NativeSetDataSource(UObject* InDataSource)
 		FModioModInfo UnderlyingMod = IModioModInfoUIDetails::Execute_GetFullModInfo(InDataSource);
 		TArray<UObject*> BoundTags;
 
-		for (UModioModTagUI* BoundTag : UModioUICommonFunctionLibrary::CreateBindableModTagArray(UnderlyingMod.Tags))
+		// The tags are only displayed, so every display showing a tag can share the same object
+		if (UModioUISubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioUISubsystem>())
 		{
-			BoundTags.Add(BoundTag);
+			for (const FModioModTag& Tag : UnderlyingMod.Tags)
+			{
+				BoundTags.Add(Subsystem->GetSharedModTag(Tag.Tag, Tag.TagLocalized));
+			}
+		}
+		else
+		{
+			for (UModioModTagUI* BoundTag : UModioUICommonFunctionLibrary::CreateBindableModTagArray(UnderlyingMod.Tags))
+			{
+				BoundTags.Add(BoundTag);
+			}
 		}
 
 		if (GetTagContainerWidget().GetObject())
@@ -46,10 +59,20 @@ void UModioModTagDisplay::NativeSetDataSource(UObject* InDataSource)
 		FModioModCollectionInfo UnderlyingModCollection = IModioModCollectionInfoUIDetails::Execute_GetFullModCollectionInfo(InDataSource);
 		TArray<UObject*> BoundTags;
 
-		for (UModioModTagUI* BoundTag :
-			 UModioUICommonFunctionLibrary::CreateBindableModTagArrayFromStringArray(UnderlyingModCollection.Tags))
+		if (UModioUISubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioUISubsystem>())
+		{
+			for (const FString& Tag : UnderlyingModCollection.Tags)
+			{
+				BoundTags.Add(Subsystem->GetSharedModTag(Tag));
+			}
+		}
+		else
 		{
-			BoundTags.Add(BoundTag);
+			for (UModioModTagUI* BoundTag :
+				 UModioUICommonFunctionLibrary::CreateBindableModTagArrayFromStringArray(UnderlyingModCollection.Tags))
+			{
+				BoundTags.Add(BoundTag);
+			}
 		}
 
 		if (GetTagContainerWidget().GetObject())
@@ -10,9 +10,11 @@
 
 #include "UI/Components/Text/ModioDefaultCodeInputTextBox.h"
 #include "Core/ModioAssetPaths.h"
+#include "Core/ModioUIAssetLoading.h"
 
 #include "Brushes/SlateBorderBrush.h"
 #include "Framework/Application/SlateApplication.h"
+#include "Layout/WidgetPath.h"
 #include "ModioUICore.h"
 #include "UI/Interfaces/IModioUIHasTextWidget.h"
 #include "Widgets/Images/SImage.h"
@@ -34,8 +36,8 @@ FModioDefaultCodeInputTextBoxStyle::FModioDefaultCodeInputTextBoxStyle()
 	SetShadowColorAndOpacity(FLinearColor::Transparent);
 	TransformPolicy = ETextTransformPolicy::None;
 
-	UObject* UnderlineMaterial = ModioUI::AssetPaths::GetUnderlineMaterialPath().TryLoad();
-	UObject* FakeCaretMaterial = ModioUI::AssetPaths::GetFakeCaretMaterialPath().TryLoad();
+	UObject* UnderlineMaterial = ModioUI::LoadUIAsset(ModioUI::AssetPaths::GetUnderlineMaterialPath());
+	UObject* FakeCaretMaterial = ModioUI::LoadUIAsset(ModioUI::AssetPaths::GetFakeCaretMaterialPath());
 
 	if (UnderlineMaterial)
 	{
@@ -63,8 +65,7 @@ TSharedRef<SWidget> SModioDefaultCodeInputTextBox::CreateCharacterWidget(int32 W
 										.TextStyle(&CodeInputStyle)
 										.MinDesiredWidth(CodeInputStyle.MinimumCharacterWidth)
 										.Margin(CodeInputStyle.CharacterPadding)
-										.Text(TAttribute<FText>::Create(TAttribute<FText>::FGetter::CreateSP(
-											this, &SModioDefaultCodeInputTextBox::GetCharacterAtIndex, WidgetIndex)));
+										.Text(GetCharacterAtIndex(WidgetIndex));
 	CharacterWidgets.Add(Widget);
 	return Widget;
 }
@@ -82,6 +83,8 @@ FReply SModioDefaultCodeInputTextBox::OnKeyDownHandler(const FGeometry& MyGeomet
 void SModioDefaultCodeInputTextBox::RebuildChildren(uint32 NumChildren)
 {
 	CharacterWidgets.Empty();
+	CharacterBorders.Empty();
+	CaretImages.Empty();
 	MyCharacterGrid->ClearChildren();
 
 	// Display widgets need to be looking at the reverse index when we are in a culture which is RTL
@@ -93,21 +96,70 @@ void SModioDefaultCodeInputTextBox::RebuildChildren(uint32 NumChildren)
 		SUniformGridPanel::FSlot& CurrentSlot = *MyCharacterGrid->AddSlot(ColumnIndex, 0).GetSlot();
 		CurrentSlot.SetHorizontalAlignment(HAlign_Center);
 		CurrentSlot.SetVerticalAlignment(VAlign_Center);
+
+		TSharedPtr<SBorder> Border;
+		TSharedPtr<SImage> Caret;
 		CurrentSlot.AttachWidget(
-			SNew(SBorder).BorderImage(this, &SModioDefaultCodeInputTextBox::GetCharacterBorder)
+			SAssignNew(Border, SBorder).BorderImage(GetCharacterBorder())
 				[SNew(SOverlay) +
-				 SOverlay::Slot()[SNew(SImage)
+				 SOverlay::Slot()[SAssignNew(Caret, SImage)
 									  .Image(&CodeInputStyle.FakeCaretBrush)
-									  .Visibility(this, &SModioDefaultCodeInputTextBox::GetCaretVisibility,
-												  static_cast<uint32>(ChildIndex))]
+									  .Visibility(GetCaretVisibility(ChildIndex))]
 					 .HAlign(CodeInputStyle.FakeCaretHorizontalAlignment)
 					 .VAlign(CodeInputStyle.FakeCaretVerticalAlignment) +
 				 SOverlay::Slot()[CreateCharacterWidget(int32(ChildIndex))]]);
+		CharacterBorders.Add(Border);
+		CaretImages.Add(Caret);
 	}
 
+	// The displayed text may no longer fit the new number of characters
+	RefreshCharacterState(true);
 	Invalidate(EInvalidateWidgetReason::Layout);
 }
 
+void SModioDefaultCodeInputTextBox::RefreshCharacterState(bool bForceRefresh)
+{
+	const FString PreviousText = DisplayedText;
+	const bool bPreviousFocus = bHasFocusDisplayed;
+	DisplayedText = HiddenInputField.IsValid() ? HiddenInputField->GetText().ToString() : FString();
+	bHasFocusDisplayed = bHasFocus;
+
+	for (int32 Index = 0; Index < CharacterWidgets.Num(); Index++)
+	{
+		const TCHAR PreviousCharacter = Index < PreviousText.Len() ? PreviousText[Index] : TEXT('\0');
+		const TCHAR NewCharacter = Index < DisplayedText.Len() ? DisplayedText[Index] : TEXT('\0');
+		if (bForceRefresh || PreviousCharacter != NewCharacter)
+		{
+			CharacterWidgets[Index]->SetText(GetCharacterAtIndex(Index));
+		}
+	}
+
+	const bool bFocusChanged = bPreviousFocus != bHasFocus;
+	if (bForceRefresh || bFocusChanged || PreviousText.Len() != DisplayedText.Len())
+	{
+		for (int32 Index = 0; Index < CaretImages.Num(); Index++)
+		{
+			CaretImages[Index]->SetVisibility(GetCaretVisibility(static_cast<uint32>(Index)));
+		}
+	}
+
+	if (bForceRefresh || bFocusChanged)
+	{
+		for (const TSharedPtr<SBorder>& Border : CharacterBorders)
+		{
+			Border->SetBorderImage(GetCharacterBorder());
+		}
+	}
+}
+
+void SModioDefaultCodeInputTextBox::UpdateCharacterBorderBrushes()
+{
+	CharacterBorderBrush = CodeInputStyle.CharacterBorderBrushBase;
+	CharacterBorderBrush.Margin = CodeInputStyle.CharacterBorderPadding;
+	FocusedCharacterBorderBrush = CodeInputStyle.CharacterBorderBrushFocused;
+	FocusedCharacterBorderBrush.Margin = CodeInputStyle.CharacterBorderPadding;
+}
+
 FReply SModioDefaultCodeInputTextBox::OnFocusReceived(const FGeometry& MyGeometry, const FFocusEvent& InFocusEvent)
 {
 	FSlateApplication::Get().SetAllUserFocus(HiddenInputField);
@@ -119,6 +171,20 @@ bool SModioDefaultCodeInputTextBox::SupportsKeyboardFocus() const
 	return true;
 }
 
+void SModioDefaultCodeInputTextBox::OnFocusChanging(const FWeakWidgetPath& PreviousFocusPath,
+                                                    const FWidgetPath& NewWidgetPath, const FFocusEvent& InFocusEvent)
+{
+	SCompoundWidget::OnFocusChanging(PreviousFocusPath, NewWidgetPath, InFocusEvent);
+
+	// Keyboard focus is always forwarded to the hidden input field, so it alone decides the focused look
+	const bool bNewFocus = HiddenInputField.IsValid() && NewWidgetPath.ContainsWidget(HiddenInputField.Get());
+	if (bNewFocus != bHasFocus)
+	{
+		bHasFocus = bNewFocus;
+		RefreshCharacterState();
+	}
+}
+
 void SModioDefaultCodeInputTextBox::OnInputTextChanged(const FText& NewText)
 {
 	if (!HiddenInputField.IsValid())
@@ -140,59 +206,29 @@ void SModioDefaultCodeInputTextBox::OnInputTextChanged(const FText& NewText)
 		HiddenInputField->SetText(FText::FromString(TruncatedText));
 	}
 
+	RefreshCharacterState();
 	OnTextChanged.ExecuteIfBound(NewText);
 }
 
 FText SModioDefaultCodeInputTextBox::GetCharacterAtIndex(int32 Index) const
 {
-	if (!HiddenInputField.IsValid())
-	{
-		UE_LOG(
-			ModioUICore, Error,
-			TEXT("Unable to get character at index %d in SModioDefaultCodeInputTextBox: HiddenInputField is not valid"),
-			Index);
-		return FText::GetEmpty();
-	}
-
-	const FString CurrentText = HiddenInputField->GetText().ToString();
-	if (Index < CurrentText.Len())
+	if (Index < DisplayedText.Len())
 	{
-		return FText::FromString(CurrentText.Mid(Index, 1));
+		return FText::FromString(DisplayedText.Mid(Index, 1));
 	}
 	return FText::GetEmpty();
 }
 
 const FSlateBrush* SModioDefaultCodeInputTextBox::GetCharacterBorder() const
 {
-	if (FSlateApplication::Get().HasFocusedDescendants(AsShared()))
-	{
-		CachedCharacterBrush = CodeInputStyle.CharacterBorderBrushFocused;
-	}
-	else
-	{
-		CachedCharacterBrush = CodeInputStyle.CharacterBorderBrushBase;
-	}
-	CachedCharacterBrush.Margin = CodeInputStyle.CharacterBorderPadding;
-	return &CachedCharacterBrush;
+	return bHasFocus ? &FocusedCharacterBorderBrush : &CharacterBorderBrush;
 }
 
 EVisibility SModioDefaultCodeInputTextBox::GetCaretVisibility(uint32 Index) const
 {
-	if (!HiddenInputField.IsValid())
+	if (bHasFocus && Index == static_cast<uint32>(DisplayedText.Len()))
 	{
-		UE_LOG(ModioUICore, Error,
-			   TEXT("Unable to get caret visibility at index %d in SModioDefaultCodeInputTextBox: HiddenInputField is "
-					"not valid"),
-			   Index);
-		return EVisibility::Hidden;
-	}
-
-	if (Index == HiddenInputField->GetText().ToString().Len())
-	{
-		if (FSlateApplication::Get().HasFocusedDescendants(AsShared()))
-		{
-			return EVisibility::Visible;
-		}
+		return EVisibility::Visible;
 	}
 	return EVisibility::Hidden;
 }
@@ -247,6 +283,7 @@ void SModioDefaultCodeInputTextBox::Construct(const FArguments& InArgs)
 	// clang-format on
 
 	CodeInputStyle = InArgs._Style;
+	UpdateCharacterBorderBrushes();
 	MyCharacterGrid->SetSlotPadding(CodeInputStyle.CharacterSpacing);
 	OnCodeSubmit = InArgs._OnCodeSubmit;
 	OnTextChanged = InArgs._OnTextChanged;
@@ -259,6 +296,7 @@ void SModioDefaultCodeInputTextBox::Construct(const FArguments& InArgs)
 void SModioDefaultCodeInputTextBox::SetStyle(const FModioDefaultCodeInputTextBoxStyle& NewStyle)
 {
 	CodeInputStyle = NewStyle;
+	UpdateCharacterBorderBrushes();
 	if (MyCharacterGrid)
 	{
 		MyCharacterGrid->SetSlotPadding(CodeInputStyle.CharacterSpacing);
@@ -269,6 +307,7 @@ void SModioDefaultCodeInputTextBox::SetStyle(const FModioDefaultCodeInputTextBox
 				Child->SetTextStyle(&CodeInputStyle);
 			}
 		}
+		RefreshCharacterState(true);
 	}
 	Invalidate(EInvalidateWidgetReason::Layout | EInvalidateWidgetReason::Paint);
 }
@@ -9,14 +9,58 @@
  */
 
 #include "UI/Components/Text/ModioDefaultTextBlock.h"
+#include "ModioUIStats.h"
 #include "UI/Components/ComponentHelpers.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(ModioDefaultTextBlock)
 
+namespace ModioDefaultTextBlock
+{
+	static uint64 NumUpdatesApplied = 0;
+	static uint64 NumUpdatesSkipped = 0;
+
+	static void RecordUpdate(bool bApplied)
+	{
+		if (bApplied)
+		{
+			NumUpdatesApplied++;
+			INC_DWORD_STAT(STAT_ModioUI_TextUpdatesApplied);
+		}
+		else
+		{
+			NumUpdatesSkipped++;
+			INC_DWORD_STAT(STAT_ModioUI_TextUpdatesSkipped);
+		}
+	}
+} // namespace ModioDefaultTextBlock
+
+uint64 UModioDefaultTextBlock::GetNumUpdatesApplied()
+{
+	return ModioDefaultTextBlock::NumUpdatesApplied;
+}
+
+uint64 UModioDefaultTextBlock::GetNumUpdatesSkipped()
+{
+	return ModioDefaultTextBlock::NumUpdatesSkipped;
+}
+
+void UModioDefaultTextBlock::ResetUpdateCounters()
+{
+	ModioDefaultTextBlock::NumUpdatesApplied = 0;
+	ModioDefaultTextBlock::NumUpdatesSkipped = 0;
+}
+
 void UModioDefaultTextBlock::NativeSetText(const FText& DisplayText)
 {
-	SetText(DisplayText);
-	SynchronizeProperties();
+	// Trackers and tiles rebind the same text every tick or bind. SetText only invalidates layout, so there is no need
+	// to resynchronize every property, and an identical text needs nothing at all
+	const bool bChanged = !GetText().IdenticalTo(
+		DisplayText, ETextIdenticalModeFlags::DeepCompare | ETextIdenticalModeFlags::LexicalCompareInvariants);
+	if (bChanged)
+	{
+		SetText(DisplayText);
+	}
+	ModioDefaultTextBlock::RecordUpdate(bChanged);
 }
 
 FText UModioDefaultTextBlock::NativeGetText()
@@ -26,8 +70,12 @@ FText UModioDefaultTextBlock::NativeGetText()
 
 void UModioDefaultTextBlock::NativeSetTextFont(FSlateFontInfo FontInfo)
 {
-	SetFont(FontInfo);
-	SynchronizeProperties();
+	const bool bChanged = !(GetFont() == FontInfo);
+	if (bChanged)
+	{
+		SetFont(FontInfo);
+	}
+	ModioDefaultTextBlock::RecordUpdate(bChanged);
 }
 
 FSlateFontInfo UModioDefaultTextBlock::NativeGetTextFont()
@@ -47,7 +95,14 @@ void UModioDefaultTextBlock::ApplyColorOverrideImpl()
 	FLinearColor ResolvedColor = ULinearColorRefLibrary::ResolveOverride(TextColorOverride, bTextColorOverrideSet);
 	if (bTextColorOverrideSet)
 	{
-		SetColorAndOpacity(ResolvedColor);
+		// Color only needs a repaint, and none at all when the resolved color is the one already applied
+		const FSlateColor CurrentColor = GetColorAndOpacity();
+		const bool bChanged = !CurrentColor.IsColorSpecified() || CurrentColor.GetSpecifiedColor() != ResolvedColor;
+		if (bChanged)
+		{
+			SetColorAndOpacity(ResolvedColor);
+		}
+		ModioDefaultTextBlock::RecordUpdate(bChanged);
 	}
 }
 
@@ -10,6 +10,7 @@
 
 #include "UI/Components/TokenPackTile/ModioDefaultTokenPackTileView.h"
 
+#include "ModioUIStats.h"
 #include "UI/Components/Slate/SModioDataSourceAwareTableRow.h"
 #include "UI/Interfaces/IModioUIDataSourceWidget.h"
 #include "UI/Interfaces/IModioUISelectableWidget.h"
@@ -40,6 +41,8 @@ void UModioDefaultTokenPackTileView::ValidateCompiledDefaults(IWidgetCompilerLog
 
 void UModioDefaultTokenPackTileView::NativeSetListItems(const TArray<UObject*>& InListItems, bool bAddToExisting)
 {
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_ListRegeneration);
+
 	ClearSelection();
 	if (bAddToExisting)
 	{
@@ -74,6 +77,8 @@ void UModioDefaultTokenPackTileView::NativeSetTokenPackSelectionByID(FModioToken
 
 void UModioDefaultTokenPackTileView::NativeSetObjects(const TArray<UObject*>& InObjects)
 {
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_ListRegeneration);
+
 	ClearListItems();
 	ClearSelection();
 	SetListItems(InObjects);
@@ -107,6 +112,8 @@ void UModioDefaultTokenPackTileView::NativeRemoveObjectWidgetCreatedHandler(
 
 void UModioDefaultTokenPackTileView::SetValues_Implementation(const TArray<UObject*>& InValues)
 {
+	MODIO_UI_SCOPE_CYCLE_COUNTER(STAT_ModioUI_ListRegeneration);
+
 	ClearListItems();
 	ClearSelection();
 	SetListItems(InValues);
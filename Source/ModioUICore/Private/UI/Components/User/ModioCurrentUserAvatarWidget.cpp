@@ -50,20 +50,23 @@ void UModioCurrentUserAvatarWidget::TransitionToLoadState(EModioUILoadState NewS
 void UModioCurrentUserAvatarWidget::NativeOnUserAvatarDownloadCompleted(FModioErrorCode ErrorCode,
 																		TOptional<FModioImageWrapper> Image)
 {
+	// The decoded avatar is delivered by UModioUISubsystem::GetCurrentUserAvatarAsync, so there is nothing to load here
 	IModioUIUserAvatarDownloadCompletedReceiver::NativeOnUserAvatarDownloadCompleted(ErrorCode, Image);
-	if (ErrorCode)
+}
+
+void UModioCurrentUserAvatarWidget::OnUserAvatarReady(FModioErrorCode ErrorCode, UTexture2DDynamic* Texture)
+{
+	if (ErrorCode || !Texture)
 	{
 		IModioUIHasLoadStateWidget::Execute_SetLoadState(this, EModioUILoadState::Errored);
 	}
-	else
+	else if (UWidget* ImageWidget = ModioUI::GetInterfaceWidgetChecked(GetAvatarImageWidget()))
 	{
-		if (UWidget* ImageWidget = ModioUI::GetInterfaceWidgetChecked(GetAvatarImageWidget()))
-		{
-			IModioUIHasLoadStateWidget::Execute_SetLoadState(this, EModioUILoadState::Loading);
-
-			IModioUIImageDisplayWidget::Execute_BeginLoadImageFromFile(ImageWidget,
-																	   Image.GetValue());
-		}
+		// The image widget's load event moves this widget to the Loaded state
+		UModioUISubsystem* UISubsystem = GEngine->GetEngineSubsystem<UModioUISubsystem>();
+		const TOptional<FModioImageWrapper> SourceImage =
+			UISubsystem ? UISubsystem->GetCachedUserAvatarImage() : TOptional<FModioImageWrapper>();
+		IModioUIImageDisplayWidget::DisplayTexture(ImageWidget, Texture, SourceImage.Get(FModioImageWrapper()));
 	}
 }
 
@@ -78,7 +81,13 @@ void UModioCurrentUserAvatarWidget::NativeUserChanged(TOptional<FModioUser> NewU
 	{
 		if (UModioUISubsystem* UISubsystem = GEngine->GetEngineSubsystem<UModioUISubsystem>())
 		{
-			UISubsystem->RequestUserAvatar();
+			// Served straight from the shared texture when another avatar widget has already loaded it
+			if (!UISubsystem->GetCachedUserAvatar())
+			{
+				IModioUIHasLoadStateWidget::Execute_SetLoadState(this, EModioUILoadState::Loading);
+			}
+			UISubsystem->GetCurrentUserAvatarAsync(FOnUserAvatarTextureReadyFast::CreateUObject(
+				this, &UModioCurrentUserAvatarWidget::OnUserAvatarReady));
 		}
 	}
 }
@@ -86,14 +95,15 @@ void UModioCurrentUserAvatarWidget::NativeUserChanged(TOptional<FModioUser> NewU
 void UModioCurrentUserAvatarWidget::NativePreConstruct()
 {
 	Super::NativePreConstruct();
-	IModioUIUserChangedReceiver::Register<UModioCurrentUserAvatarWidget>();
-	IModioUIUserAvatarDownloadCompletedReceiver::Register<UModioCurrentUserAvatarWidget>();
+	// Bound before registering for user changes, as registration delivers the current user's cached avatar immediately
 	if (UWidget* ImageWidget = ModioUI::GetInterfaceWidgetChecked(GetAvatarImageWidget()))
 	{
 		FModioImageDisplayOnLoadStateChanged OnImageLoaded;
 		OnImageLoaded.BindUFunction(this, FName("OnImageLoadCompleted"));
 		IModioUIImageDisplayWidget::Execute_AddImageLoadEventHandler(ImageWidget, OnImageLoaded);
 	}
+	IModioUIUserChangedReceiver::Register<UModioCurrentUserAvatarWidget>();
+	IModioUIUserAvatarDownloadCompletedReceiver::Register<UModioCurrentUserAvatarWidget>();
 }
 
 void UModioCurrentUserAvatarWidget::NativeSetLoadState(EModioUILoadState NewState)
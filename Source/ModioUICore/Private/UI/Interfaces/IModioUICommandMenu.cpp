@@ -10,6 +10,7 @@
 
 #include "UI/Interfaces/IModioUICommandMenu.h"
 #include "Core/ModioAssetPaths.h"
+#include "Core/ModioUIAssetLoading.h"
 
 #include "Brushes/SlateNoResource.h"
 #include "Engine/DataTable.h"
@@ -21,7 +22,7 @@ const FModioUICommandAssetEntry& UModioUICommandLibrary::GetCommandAssetEntry(co
 	static const FModioUICommandAssetEntry DefaultEntry {};
 	bResolved = false;
 	FSoftObjectPath DefaultCommandTablePath = ModioUI::AssetPaths::GetUiCommandsTablePath();
-	UDataTable* DefaultCommandTable = Cast<UDataTable>(DefaultCommandTablePath.TryLoad());
+	UDataTable* DefaultCommandTable = Cast<UDataTable>(ModioUI::LoadUIAsset(DefaultCommandTablePath));
 	if (DefaultCommandTable)
 	{
 		const UScriptStruct* CommandTableEntryStruct = DefaultCommandTable->GetRowStruct();
@@ -0,0 +1,32 @@
+/*
+ *  Copyright (C) 2025 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io UE Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue/blob/main/LICENSE>)
+ *
+ */
+
+#include "UI/Interfaces/IModioUIImageDisplayWidget.h"
+
+void IModioUIImageDisplayWidget::DisplayTexture(UObject* ImageWidget, UTexture2DDynamic* Texture,
+												const FModioImageWrapper& SourceImage)
+{
+	if (!ImageWidget)
+	{
+		return;
+	}
+
+	// Blueprint implementations predating SetTextureDirectly only know how to load from file, and an unimplemented
+	// Blueprint event does nothing at all, so they are given the source image instead
+	const bool bImplementedNatively =
+		ImageWidget->GetNativeInterfaceAddress(UModioUIImageDisplayWidget::StaticClass()) != nullptr;
+	if (!bImplementedNatively && !ImageWidget->GetClass()->IsFunctionImplementedInScript(
+									 GET_FUNCTION_NAME_CHECKED(IModioUIImageDisplayWidget, SetTextureDirectly)))
+	{
+		Execute_BeginLoadImageFromFile(ImageWidget, SourceImage);
+		return;
+	}
+	Execute_SetTextureDirectly(ImageWidget, Texture, SourceImage);
+}
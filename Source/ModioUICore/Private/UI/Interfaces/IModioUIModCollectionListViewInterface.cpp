@@ -12,6 +12,7 @@
 
 #include "Algo/Transform.h"
 #include "Core/ModioModCollectionInfoUI.h"
+#include "ModioUIStats.h"
 #include "Types/ModioModCollection.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(IModioUIModCollectionListViewInterface)
@@ -26,6 +27,7 @@ void IModioUIModCollectionListViewInterface::SetModCollectionFromModCollectionIn
 		WrappedCollection->Underlying = In;
 		return WrappedCollection;
 	});
+	MODIO_UI_COUNT_WRAPPERS_CREATED(WrappedCollectionList.Num());
 	NativeSetListItems(WrappedCollectionList, bAddToExisting);
 }
 
@@ -38,6 +40,7 @@ void IModioUIModCollectionListViewInterface::SetModCollectionFromModCollectionIn
 		WrappedCollection->Underlying = In;
 		return WrappedCollection;
 	});
+	MODIO_UI_COUNT_WRAPPERS_CREATED(WrappedCollectionList.Num());
 	NativeSetListItems(WrappedCollectionList, bAddToExisting);
 }
 
@@ -15,6 +15,7 @@
 #include "Core/ModioModInfoUI.h"
 #include "Engine/Engine.h"
 #include "ModioSubsystem.h"
+#include "ModioUIStats.h"
 #include "Core/ModioModDependencyUI.h"
 #include "Types/ModioModInfoList.h"
 
@@ -34,6 +35,7 @@ void IModioUIModListViewInterface::SetModsFromModInfoList_Implementation(const F
 		WrappedMod->Underlying = In;
 		return WrappedMod;
 	});
+	MODIO_UI_COUNT_WRAPPERS_CREATED(WrappedModList.Num());
 	NativeSetListItems(WrappedModList, bAddToExisting);
 }
 
@@ -46,6 +48,7 @@ void IModioUIModListViewInterface::SetModsFromModInfoArray_Implementation(const
 		WrappedMod->Underlying = In;
 		return WrappedMod;
 	});
+	MODIO_UI_COUNT_WRAPPERS_CREATED(WrappedModList.Num());
 	NativeSetListItems(WrappedModList, bAddToExisting);
 }
 
@@ -67,5 +70,6 @@ void IModioUIModListViewInterface::SetModsFromModCollectionEntryArray_Implementa
 		WrappedModCollectionEntry->bCachedSubscriptionStatus = UserSubscriptions.Contains(In.GetID());
 		return WrappedModCollectionEntry;
 	});
+	MODIO_UI_COUNT_WRAPPERS_CREATED(CachedCollection.Num());
 	NativeSetListItems(CachedCollection, bAddToExisting);
 }
\ No newline at end of file
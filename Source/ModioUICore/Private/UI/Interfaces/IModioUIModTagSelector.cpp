@@ -10,3 +10,13 @@
 
 
 #include "UI/Interfaces/IModioUIModTagSelector.h"
+
+int32 IModioUIModTagSelector::NativeGetNumSelectedTags()
+{
+	return Execute_GetSelectedTags(Cast<UObject>(this)).Num();
+}
+
+UModioModTagOptionsUI* IModioUIModTagSelector::NativeGetTagOptionsObject()
+{
+	return nullptr;
+}
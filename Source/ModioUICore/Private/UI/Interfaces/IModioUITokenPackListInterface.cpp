@@ -11,6 +11,7 @@
 #include "UI/Interfaces/IModioUITokenPackListInterface.h"
 
 #include "Core/ModioTokenPackUI.h"
+#include "ModioUIStats.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(IModioUITokenPackListInterface)
 
@@ -23,6 +24,7 @@ void IModioUITokenPackListInterface::SetTokenPacksFromTokenPackList_Implementati
 		WrappedMod->Underlying = In;
 		return WrappedMod;
 	});
+	MODIO_UI_COUNT_WRAPPERS_CREATED(WrappedTokenPackList.Num());
 	NativeSetListItems(WrappedTokenPackList, bAddToExisting);
 }
 
@@ -35,6 +37,7 @@ void IModioUITokenPackListInterface::SetTokenPacksFromTokenPackArray_Implementat
 		WrappedMod->Underlying = In;
 		return WrappedMod;
 	});
+	MODIO_UI_COUNT_WRAPPERS_CREATED(WrappedModList.Num());
 	NativeSetListItems(WrappedModList, bAddToExisting);
 }
 
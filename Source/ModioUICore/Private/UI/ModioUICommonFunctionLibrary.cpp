@@ -154,6 +154,7 @@ UModioModTagOptionsUI* UModioUICommonFunctionLibrary::CreateBindableModTagOption
 		BoundTagCategories.Add(CreateBindableModTagInfo(CurrentTagCategory));
 	}
 	BindableOptions->BindableTagCategories = BoundTagCategories;
+	BindableOptions->IndexTags();
 	return BindableOptions;
 }
 
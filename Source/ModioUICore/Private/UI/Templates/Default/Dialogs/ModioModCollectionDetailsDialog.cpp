@@ -10,7 +10,11 @@
 
 #include "UI/Templates/Default/Dialogs/ModioModCollectionDetailsDialog.h"
 
+#include "Core/ModioModInfoUI.h"
+#include "ModioUIStats.h"
+#include "ModioUISubsystem.h"
 #include "UI/Interfaces/IModioModCollectionInfoUIDetails.h"
+#include "UI/Interfaces/IModioUIObjectListWidget.h"
 #include "UI/Templates/Default/Commands/ModioUIDisplayFilteredModCollectionsCommand.h"
 #include "UI/Templates/Default/Commands/ModioUIToggleModCollectionFollowedCommand.h"
 #include "UI/Templates/Default/Commands/ModioUIViewModCollectionContributorsCommand.h"
@@ -162,6 +166,12 @@ GetCollectionModsListViewWidget_Implementation() const
 
 void UModioModCollectionDetailsDialog::NativeSetDataSource(UObject* InDataSource)
 {
+	if (!WarmDialogState.BeginSetDataSource(InDataSource, DataSource))
+	{
+		ApplyDeferredLogoDataSource();
+		return;
+	}
+
 	Super::NativeSetDataSource(InDataSource);
 
 	if (DataSource && DataSource->GetClass()->ImplementsInterface(UModioModCollectionInfoUIDetails::StaticClass()))
@@ -174,11 +184,10 @@ void UModioModCollectionDetailsDialog::NativeSetDataSource(UObject* InDataSource
 		BoundModCollectionInfo = {};
 		bHasFullDescription = false;
 	}
-	if (UWidget* GalleryWidget =
-		ModioUI::GetInterfaceWidgetAsDataSourceWidget(GetModCollectionLogoWidget()))
-	{
-		Execute_SetDataSource(GalleryWidget, InDataSource);
-	}
+
+	// The logo widget starts a media download, which waits until the dialog is actually shown
+	WarmDialogState.DeferMedia();
+	ApplyDeferredLogoDataSource();
 
 	if (ModioUI::GetInterfaceWidgetAsDataSourceWidget(GetMoreOptionsMenuWidget()))
 	{
@@ -190,6 +199,18 @@ void UModioModCollectionDetailsDialog::NativeSetDataSource(UObject* InDataSource
 	}
 }
 
+void UModioModCollectionDetailsDialog::ApplyDeferredLogoDataSource()
+{
+	if (!WarmDialogState.ConsumeDeferredMedia())
+	{
+		return;
+	}
+	if (UWidget* GalleryWidget = ModioUI::GetInterfaceWidgetAsDataSourceWidget(GetModCollectionLogoWidget()))
+	{
+		Execute_SetDataSource(GalleryWidget, DataSource);
+	}
+}
+
 void UModioModCollectionDetailsDialog::NativePreConstruct()
 {
 	Super::NativePreConstruct();
@@ -236,7 +257,43 @@ void UModioModCollectionDetailsDialog::NativeOnModCollectionModsRequestCompleted
 	if (!ErrorCode && Mods.IsSet() &&
 	    GetCollectionModsListViewWidget())
 	{
-		IModioUIModListViewInterface::Execute_SetModsFromModInfoList(
-			ModioUI::GetInterfaceWidgetChecked(GetCollectionModsListViewWidget()), Mods.GetValue(), false);
+		UWidget* ListWidget = ModioUI::GetInterfaceWidgetChecked(GetCollectionModsListViewWidget());
+		if (!ListWidget)
+		{
+			return;
+		}
+		if (!ListWidget->Implements<UModioUIObjectListWidget>())
+		{
+			IModioUIModListViewInterface::Execute_SetModsFromModInfoList(ListWidget, Mods.GetValue(), false);
+			return;
+		}
+
+		// Reopening or revalidating a collection lists mods that are mostly already wrapped, so their wrappers are
+		// reused with the latest info rather than allocating a new one per mod
+		TMap<FModioModID, UModioModInfoUI*> ExistingWrappers;
+		for (UObject* Existing : IModioUIObjectListWidget::Execute_GetObjects(ListWidget))
+		{
+			if (UModioModInfoUI* ExistingMod = Cast<UModioModInfoUI>(Existing))
+			{
+				ExistingWrappers.Add(ExistingMod->Underlying.ModId, ExistingMod);
+			}
+		}
+
+		TArray<UObject*> WrappedMods;
+		WrappedMods.Reserve(Mods->GetRawList().Num());
+		int32 NumWrappersCreated = 0;
+		for (const FModioModInfo& Info : Mods->GetRawList())
+		{
+			UModioModInfoUI* WrappedMod = ExistingWrappers.FindRef(Info.ModId);
+			if (!WrappedMod)
+			{
+				WrappedMod = NewObject<UModioModInfoUI>();
+				NumWrappersCreated++;
+			}
+			WrappedMod->Underlying = Info;
+			WrappedMods.Add(WrappedMod);
+		}
+		MODIO_UI_COUNT_WRAPPERS_CREATED(NumWrappersCreated);
+		IModioUIObjectListWidget::Execute_SetObjects(ListWidget, WrappedMods);
 	}
 }
\ No newline at end of file
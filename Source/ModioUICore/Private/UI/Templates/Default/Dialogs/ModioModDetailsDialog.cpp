@@ -10,6 +10,7 @@
 
 #include "UI/Templates/Default/Dialogs/ModioModDetailsDialog.h"
 
+#include "ModioUISubsystem.h"
 #include "UI/Interfaces/IModioModInfoUIDetails.h"
 #include "UI/Templates/Default/Commands/ModioUIDisplayFilteredModsCommand.h"
 #include "UI/Templates/Default/Commands/ModioUIReportModCommand.h"
@@ -103,6 +104,12 @@ void UModioModDetailsDialog::PopulateExtraOptionsCommands_Implementation(TArray<
 
 void UModioModDetailsDialog::NativeSetDataSource(UObject* InDataSource)
 {
+	if (!WarmDialogState.BeginSetDataSource(InDataSource, DataSource))
+	{
+		ApplyDeferredGalleryDataSource();
+		return;
+	}
+
 	Super::NativeSetDataSource(InDataSource);
 
 	if (DataSource && DataSource->GetClass()->ImplementsInterface(UModioModInfoUIDetails::StaticClass()))
@@ -115,10 +122,10 @@ void UModioModDetailsDialog::NativeSetDataSource(UObject* InDataSource)
 		BoundModInfo = {};
 		bHasFullDescription = false;
 	}
-	if (UWidget* GalleryWidget = ModioUI::GetInterfaceWidgetAsDataSourceWidget(GetModImageGalleryWidget()))
-	{
-		IModioUIDataSourceWidget::Execute_SetDataSource(GalleryWidget, InDataSource);
-	}
+
+	// The gallery starts media downloads, which wait until the dialog is actually shown
+	WarmDialogState.DeferMedia();
+	ApplyDeferredGalleryDataSource();
 
 	if (ModioUI::GetInterfaceWidgetAsDataSourceWidget(GetMoreOptionsMenuWidget()))
 	{
@@ -130,6 +137,18 @@ void UModioModDetailsDialog::NativeSetDataSource(UObject* InDataSource)
 	}
 }
 
+void UModioModDetailsDialog::ApplyDeferredGalleryDataSource()
+{
+	if (!WarmDialogState.ConsumeDeferredMedia())
+	{
+		return;
+	}
+	if (UWidget* GalleryWidget = ModioUI::GetInterfaceWidgetAsDataSourceWidget(GetModImageGalleryWidget()))
+	{
+		IModioUIDataSourceWidget::Execute_SetDataSource(GalleryWidget, DataSource);
+	}
+}
+
 void UModioModDetailsDialog::NativePreConstruct()
 {
 	Super::NativePreConstruct();
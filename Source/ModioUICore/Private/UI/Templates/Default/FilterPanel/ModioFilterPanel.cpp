@@ -11,7 +11,7 @@
 #include "UI/Templates/Default/FilterPanel/ModioFilterPanel.h"
 #include "Engine.h"
 
-#include "ModioSubsystem.h"
+#include "ModioUISubsystem.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(ModioFilterPanel)
 
@@ -19,11 +19,11 @@ void UModioFilterPanel::NativeOnInitialized()
 {
 	Super::NativeOnInitialized();
 
-	if (UModioSubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioSubsystem>())
+	if (UModioUISubsystem* UISubsystem = GEngine->GetEngineSubsystem<UModioUISubsystem>())
 	{
 		FOnGetModTagOptionsDelegateFast GetModTagOptionsCallback;
 		GetModTagOptionsCallback.BindUObject(this, &UModioFilterPanel::SetModTagOptions);
-		Subsystem->GetModTagOptionsAsync(GetModTagOptionsCallback);
+		UISubsystem->GetTagOptionsListAsync(GetModTagOptionsCallback);
 	}
 }
 
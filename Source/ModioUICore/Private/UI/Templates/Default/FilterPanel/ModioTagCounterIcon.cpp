@@ -10,6 +10,8 @@
 
 #include "UI/Templates/Default/FilterPanel/ModioTagCounterIcon.h"
 
+#include "Core/ModioTagOptionsUI.h"
+
 #include UE_INLINE_GENERATED_CPP_BY_NAME(ModioTagCounterIcon)
 
 TScriptInterface<IModioUIHasTextWidget> UModioTagCounterIcon::GetCounterLabelWidget_Implementation()
@@ -23,12 +25,60 @@ void UModioTagCounterIcon::NativeSetDataSource(UObject* InDataSource)
 	SynchronizeCounter();
 }
 
+void UModioTagCounterIcon::NativeDestruct()
+{
+	UnbindFromTagOptions();
+	Super::NativeDestruct();
+}
+
+void UModioTagCounterIcon::BindToTagOptions()
+{
+	IModioUIModTagSelector* NativeSelector = Cast<IModioUIModTagSelector>(DataSource);
+	UModioModTagOptionsUI* Options = NativeSelector ? NativeSelector->NativeGetTagOptionsObject() : nullptr;
+	if (Options == BoundTagOptions.Get() && (!Options || TagSelectionToggledHandle.IsValid()))
+	{
+		return;
+	}
+
+	UnbindFromTagOptions();
+	if (Options)
+	{
+		BoundTagOptions = Options;
+		TagSelectionToggledHandle =
+			Options->OnTagSelectionToggled.AddUObject(this, &UModioTagCounterIcon::OnTagSelectionToggled);
+	}
+}
+
+void UModioTagCounterIcon::UnbindFromTagOptions()
+{
+	if (UModioModTagOptionsUI* Options = BoundTagOptions.Get())
+	{
+		Options->OnTagSelectionToggled.Remove(TagSelectionToggledHandle);
+	}
+	BoundTagOptions.Reset();
+	TagSelectionToggledHandle.Reset();
+}
+
+void UModioTagCounterIcon::OnTagSelectionToggled(UModioModTagUI* Tag, bool bSelected)
+{
+	SynchronizeCounter();
+}
+
 int32 UModioTagCounterIcon::SynchronizeCounter()
 {
 	int32 TagCount = 0;
+	BindToTagOptions();
 	if (DataSource && (DataSource->GetClass()->ImplementsInterface(UModioUIModTagSelector::StaticClass())))
 	{
-		TagCount = IModioUIModTagSelector::Execute_GetSelectedTags(DataSource).Num();
+		// Native selectors can report the count without building the list of selected tag strings
+		if (IModioUIModTagSelector* NativeSelector = Cast<IModioUIModTagSelector>(DataSource))
+		{
+			TagCount = NativeSelector->NativeGetNumSelectedTags();
+		}
+		else
+		{
+			TagCount = IModioUIModTagSelector::Execute_GetSelectedTags(DataSource).Num();
+		}
 
 		if (ModioUI::GetInterfaceWidgetChecked(GetCounterLabelWidget()))
 		{
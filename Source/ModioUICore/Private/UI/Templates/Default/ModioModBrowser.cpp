@@ -168,94 +168,48 @@ TArray<FModioModInfo> UModioModBrowser::SearchLibraryWithStoredParams() const
 			return SearchSubscriptionsAndInstallsWithStoredParams();
 		}
 	}
-	TArray<FModioModInfo> SearchResults;
-	if (UModioSubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioSubsystem>())
-	{
-		// Library View includes user subscriptions, system installations, and user purchases
-		TMap<FModioModID, FModioModInfo> LibraryMods;
-		TMap<FModioModID, FModioModCollectionEntry> SubscriptionsAndInstalls = Subsystem->QueryUserSubscriptions();
-		SubscriptionsAndInstalls.Append(Subsystem->QuerySystemInstallations());
-		for (auto& Entry : SubscriptionsAndInstalls)
-		{
-			LibraryMods.Add(Entry.Key, Entry.Value.GetModProfile());
-		}
-		LibraryMods.Append(Subsystem->QueryUserPurchasedMods());
-		// Filter by stored search string and selected tags (if applicable)
-		for (auto& Mod : LibraryMods)
-		{
-			if (!StoredSearchString.IsEmpty())
-			{
-				if (Mod.Value.ProfileName.Contains(StoredSearchString))
-				{
-					SearchResults.Add(Mod.Value);
-				}
-			}
-			else
-			{
-				SearchResults.Add(Mod.Value);
-			}
-		}
-		return FilterModArrayByTags(SearchResults, StoredLibraryTagData);
-	}
-	return SearchResults;
+	// Library View includes user subscriptions, system installations, and user purchases
+	return SearchLibraryModsWithStoredParams(true, true);
 }
 
 TArray<FModioModInfo> UModioModBrowser::SearchSubscriptionsAndInstallsWithStoredParams() const
 {
-	TArray<FModioModInfo> SearchResults;
-	if (UModioSubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioSubsystem>())
-	{
-		TMap<FModioModID, FModioModCollectionEntry> SubscriptionsAndInstalls = Subsystem->QueryUserSubscriptions();
-		SubscriptionsAndInstalls.Append(Subsystem->QuerySystemInstallations());
-
-		for (auto& Mod : SubscriptionsAndInstalls)
-		{
-			if (!StoredSearchString.IsEmpty())
-			{
-				if (Mod.Value.GetModProfile().ProfileName.Contains(StoredSearchString))
-				{
-					SearchResults.Add(Mod.Value.GetModProfile());
-				}
-			}
-			else
-			{
-				SearchResults.Add(Mod.Value.GetModProfile());
-			}
-		}
-		return FilterModArrayByTags(SearchResults, StoredLibraryTagData);
-	}
-	return SearchResults;
+	return SearchLibraryModsWithStoredParams(true, false);
 }
 
 TArray<FModioModInfo> UModioModBrowser::SearchPurchasesWithStoredParams() const
 {
-	TArray<FModioModInfo> SearchResults;
 	if (UModioUISubsystem* UISubsystem = GEngine->GetEngineSubsystem<UModioUISubsystem>())
 	{
 		if (!UISubsystem->IsUGCFeatureEnabled(EModioUIFeatureFlags::Monetization))
 		{
-			return SearchResults;
+			return {};
 		}
 	}
-	if (UModioSubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioSubsystem>())
+	return SearchLibraryModsWithStoredParams(false, true);
+}
+
+TArray<FModioModInfo> UModioModBrowser::SearchLibraryModsWithStoredParams(bool bSubscriptionsAndInstallations,
+                                                                          bool bPurchases) const
+{
+	TArray<FModioModInfo> SearchResults;
+	UModioUISubsystem* UISubsystem = GEngine->GetEngineSubsystem<UModioUISubsystem>();
+	UModioUIDataProvider* DataProvider = UISubsystem ? UISubsystem->GetDataProvider() : nullptr;
+	if (!DataProvider)
 	{
-		for (auto& Mod : Subsystem->QueryUserPurchasedMods())
+		return SearchResults;
+	}
+
+	// Filter by stored search string and selected tags (if applicable)
+	for (TPair<FModioModID, FModioModInfo>& Mod :
+	     DataProvider->QueryLibraryMods(bSubscriptionsAndInstallations, bPurchases))
+	{
+		if (StoredSearchString.IsEmpty() || Mod.Value.ProfileName.Contains(StoredSearchString))
 		{
-			if (!StoredSearchString.IsEmpty())
-			{
-				if (Mod.Value.ProfileName.Contains(StoredSearchString))
-				{
-					SearchResults.Add(Mod.Value);
-				}
-			}
-			else
-			{
-				SearchResults.Add(Mod.Value);
-			}
+			SearchResults.Add(MoveTemp(Mod.Value));
 		}
-		return FilterModArrayByTags(SearchResults, StoredLibraryTagData);
 	}
-	return SearchResults;
+	return FilterModArrayByTags(SearchResults, StoredLibraryTagData);
 }
 
 TArray<FModioModInfo> UModioModBrowser::FilterModArrayByTags(const TArray<FModioModInfo>& ModArray,
@@ -30,7 +30,7 @@ namespace ModioUI::AssetPaths
 
 	static FSoftObjectPath GetUiColorsTablePath()
 	{
-		if (GetSettings()->ColorsTable.IsValid())
+		if (!GetSettings()->ColorsTable.IsNull())
 			return GetSettings()->ColorsTable.ToSoftObjectPath();
 		else
 			return FSoftObjectPath("/ModioComponentUI/UI/Data/DT_UIColors.DT_UIColors");
@@ -38,7 +38,7 @@ namespace ModioUI::AssetPaths
 
 	static FSoftObjectPath GetUiCommandsTablePath()
 	{
-		if (GetSettings()->CommandsTable.IsValid())
+		if (!GetSettings()->CommandsTable.IsNull())
 			return GetSettings()->CommandsTable.ToSoftObjectPath();
 		else
 			return FSoftObjectPath("/ModioComponentUI/UI/Data/DT_UICommands.DT_UICommands");
@@ -46,7 +46,7 @@ namespace ModioUI::AssetPaths
 
 	static FSoftObjectPath GetUnderlineMaterialPath()
 	{
-		if (GetSettings()->UnderlineMaterial.IsValid())
+		if (!GetSettings()->UnderlineMaterial.IsNull())
 			return GetSettings()->UnderlineMaterial.ToSoftObjectPath();
 		else
 			return FSoftObjectPath("/ModioComponentUI/UI/Materials/M_UI_Underline.M_UI_Underline");
@@ -54,7 +54,7 @@ namespace ModioUI::AssetPaths
 
 	static FSoftObjectPath GetFakeCaretMaterialPath()
 	{
-		if (GetSettings()->FakeCaretMaterial.IsValid())
+		if (!GetSettings()->FakeCaretMaterial.IsNull())
 			return GetSettings()->FakeCaretMaterial.ToSoftObjectPath();
 		else
 			return FSoftObjectPath("/ModioComponentUI/UI/Materials/M_UI_FakeCaret.M_UI_FakeCaret");
@@ -0,0 +1,70 @@
+/*
+ *  Copyright (C) 2025 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io UE Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Types/ModioCommonTypes.h"
+
+/**
+ * @brief Hash index from list items, and from the mod IDs of items implementing IModioModInfoUIDetails, to their
+ * position in a list view's item array. Owning views update it whenever they set or append items, and forward every
+ * other change to their items (UListView::OnItemsChanged) to NotifyItemsChanged. Items added to or removed from the
+ * end are indexed incrementally; any other change invalidates the index, which is rebuilt by the next lookup. Hits
+ * are also checked against the item array, so a change the index was not told about costs a rebuild rather than a
+ * wrong answer.
+ */
+struct MODIOUICORE_API FModioModListItemIndex
+{
+	/**
+	 * @brief Replaces the indexed items with Items
+	 */
+	void Rebuild(const TArray<UObject*>& Items);
+
+	/**
+	 * @brief Indexes items that were appended to the end of Items
+	 * @param FirstNewIndex Position in Items of the first appended item
+	 */
+	void Append(const TArray<UObject*>& Items, int32 FirstNewIndex);
+
+	/**
+	 * @brief Updates the index after AddedItems were added to and RemovedItems removed from Items
+	 * @param Items The item array after the change
+	 */
+	void NotifyItemsChanged(const TArray<UObject*>& Items, const TArray<UObject*>& AddedItems,
+							const TArray<UObject*>& RemovedItems);
+
+	/**
+	 * @brief Marks the index out of date, so that the next lookup rebuilds it
+	 */
+	void Invalidate();
+
+	void Reset();
+
+	/**
+	 * @brief Returns the position of the first occurrence of Item in Items, or INDEX_NONE
+	 */
+	int32 FindItem(const UObject* Item, const TArray<UObject*>& Items);
+
+	/**
+	 * @brief Returns the position of the first item in Items whose mod ID is ModID, or INDEX_NONE
+	 */
+	int32 FindModID(FModioModID ModID, const TArray<UObject*>& Items);
+
+private:
+	void IndexItem(UObject* Item, int32 Index);
+	bool RemoveTailItems(const TArray<UObject*>& Items, const TArray<UObject*>& RemovedItems);
+	void RebuildIfOutOfDate(const TArray<UObject*>& Items);
+
+	TMap<const UObject*, int32> ItemToIndex;
+	TMap<FModioModID, int32> ModIDToIndex;
+	int32 NumIndexedItems = 0;
+	bool bOutOfDate = false;
+};
@@ -18,6 +18,9 @@
 
 #include "ModioTagOptionsUI.generated.h"
 
+class UModioModTagInfoUI;
+class UModioModTagOptionsUI;
+
 /// Unlike most of the wrappers in the mod.io plugin, these types contain some additional fields
 /// Because tags and tag categories are free-form and specified by developers, they are not localized by the mod.io
 /// backend. As a result these wrappers provide fields for storing the localized text provided by your game's
@@ -36,22 +39,47 @@ class MODIOUICORE_API UModioModTagUI : public UObject, public IModioModTagUIDeta
 
 public:
 	/**
-	 * @brief Raw tag string used in the mod.io API
+	 * @brief Raw tag string used in the mod.io API. Blueprint writes are ignored on shared instances
 	 */
-	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "mod.io|UI|ModioTagUI")
+	UPROPERTY(BlueprintReadWrite, BlueprintSetter = SetUnderlying, EditAnywhere, Category = "mod.io|UI|ModioTagUI")
 	FString Underlying;
 
 	/**
-	 * @brief Localized tag string
+	 * @brief Localized tag string. Blueprint writes are ignored on shared instances
 	 */
-	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "mod.io|UI|ModioTagUI")
+	UPROPERTY(BlueprintReadWrite, BlueprintSetter = SetLocalizedText, EditAnywhere, Category = "mod.io|UI|ModioTagUI")
 	FText LocalizedText;
 
 	/**
-	 * @brief Transient field storing selection state
+	 * @brief Transient field storing selection state. Read-only so that every change goes through SetSelectionState,
+	 * which keeps the owning tag options object's selected set up to date
+	 */
+	UPROPERTY(Transient, BlueprintReadOnly, VisibleAnywhere, Category = "mod.io|UI|ModioTagUI")
+	bool bSelectionState = false;
+
+	/**
+	 * @brief Position of this tag in the owning tag options object's selected set, or INDEX_NONE if not owned
+	 */
+	int32 TagIndex = INDEX_NONE;
+
+	TWeakObjectPtr<UModioModTagOptionsUI> OwningOptions;
+
+	/**
+	 * @brief Category this tag was indexed under by the owning tag options object, if any
+	 */
+	TWeakObjectPtr<UModioModTagInfoUI> OwningCategory;
+
+	/**
+	 * @brief Whether this is a shared instance handed out by UModioUISubsystem::GetSharedModTag. Shared instances are
+	 * displayed by many widgets at once, so their selection state and text cannot be changed from Blueprint
 	 */
-	UPROPERTY(Transient, BlueprintReadWrite, EditAnywhere, Category = "mod.io|UI|ModioTagUI")
-	bool bSelectionState;
+	bool bShared = false;
+
+	UFUNCTION(BlueprintSetter)
+	void SetUnderlying(const FString& NewUnderlying);
+
+	UFUNCTION(BlueprintSetter)
+	void SetLocalizedText(const FText& NewLocalizedText);
 
 protected:
 	//~ Begin IModioModTagUIDetails Interface
@@ -63,10 +91,7 @@ protected:
 	{
 		return LocalizedText;
 	}
-	virtual void SetSelectionState_Implementation(bool bNewSelectionState) override
-	{
-		bSelectionState = bNewSelectionState;
-	}
+	virtual void SetSelectionState_Implementation(bool bNewSelectionState) override;
 	virtual bool GetSelectionState_Implementation() override
 	{
 		return bSelectionState;
@@ -136,7 +161,9 @@ public:
 };
 
 /**
- * @brief Wrapper around a FModioModTagOptions because UMG widgets expect UObjects for data sources or list items
+ * @brief Wrapper around a FModioModTagOptions because UMG widgets expect UObjects for data sources or list items.
+ * Tracks the selection state of its tags incrementally, so counting, listing and clearing the selected tags costs
+ * time proportional to the number of selected tags rather than the size of the taxonomy
  */
 UCLASS(BlueprintType)
 class MODIOUICORE_API UModioModTagOptionsUI : public UObject, public IModioModTagOptionsUIDetails
@@ -154,19 +181,54 @@ protected:
 		}
 		return CategoryInterfaces;
 	}
-	virtual TArray<FString> GetSelectedTags_Implementation() override
-	{
-		TArray<FString> SelectedTags;
-		for (UModioModTagInfoUI* CurrentCategory : BindableTagCategories)
-		{
-			SelectedTags.Insert(IModioModTagCategoryUIDetails::Execute_GetSelectedTags(CurrentCategory),
-								SelectedTags.Num());
-		}
-		return SelectedTags;
-	}
+	virtual TArray<FString> GetSelectedTags_Implementation() override;
+	virtual void ClearSelectedTags_Implementation() override;
 	//~ End IModioModTagOptionsUIDetails Interface
 
+	void IndexTagsIfRequired();
+
+	/**
+	 * @brief Every tag across all categories, in category order. A tag's position here is its TagIndex
+	 */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UModioModTagUI>> IndexedTags;
+
+	/**
+	 * @brief Selection state of IndexedTags, one bit per tag
+	 */
+	TBitArray<> SelectedTagBits;
+
+	int32 NumSelectedTags = 0;
+
 public:
+	DECLARE_MULTICAST_DELEGATE_TwoParams(FOnTagSelectionToggled, UModioModTagUI* /* Tag */, bool /* bSelected */);
+
+	/**
+	 * @brief Broadcast whenever a single tag's selection state changes
+	 */
+	FOnTagSelectionToggled OnTagSelectionToggled;
+
+	/**
+	 * @brief Assigns every tag in BindableTagCategories a position in the selected set, seeded from each tag's current
+	 * state. Done lazily on first use; call it again after replacing BindableTagCategories
+	 */
+	void IndexTags();
+
+	/**
+	 * @brief Returns the number of selected tags without building the list of their values
+	 */
+	int32 GetNumSelectedTags();
+
+	/**
+	 * @brief Returns the tag objects that are currently selected, in category order
+	 */
+	TArray<UModioModTagUI*> GetSelectedTagObjects();
+
+	/**
+	 * @brief Updates the selected set when one of this object's tags changes state. Called by UModioModTagUI
+	 */
+	void NotifyTagSelectionChanged(UModioModTagUI& Tag, bool bNewSelectionState);
+
 	/**
 	 * @brief Underlying tag options
 	 */
@@ -0,0 +1,36 @@
+/*
+ *  Copyright (C) 2025 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io UE Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/SoftObjectPath.h"
+
+namespace ModioUI
+{
+	/**
+	 * @brief Returns the UI asset at Path, loading it synchronously if it is not already in memory. Synchronous loads
+	 * are recorded so that the assets responsible for hitches can be added to the preload manifest (see
+	 * UModioUISubsystem::PreloadUIAssets)
+	 */
+	MODIOUICORE_API UObject* LoadUIAsset(const FSoftObjectPath& Path);
+
+	/**
+	 * @brief Class counterpart of LoadUIAsset
+	 */
+	MODIOUICORE_API UClass* LoadUIClass(const FSoftClassPath& Path);
+
+	/**
+	 * @brief Returns every UI asset LoadUIAsset or LoadUIClass had to load synchronously since the last reset
+	 */
+	MODIOUICORE_API TArray<FSoftObjectPath> GetSynchronousUILoads();
+
+	MODIOUICORE_API void ResetSynchronousUILoads();
+} // namespace ModioUI
@@ -0,0 +1,75 @@
+/*
+ *  Copyright (C) 2025 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io UE Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ModioSubsystem.h"
+#include "Types/ModioTokenPackList.h"
+#include "UObject/Object.h"
+
+#include "ModioUIDataProvider.generated.h"
+
+DECLARE_DELEGATE_TwoParams(FOnListAllTokenPacksDelegateFast, FModioErrorCode, TOptional<FModioTokenPackList>);
+
+/**
+ * @brief Source of the mod.io data consumed by UModioUISubsystem. The default implementation forwards every call to
+ * UModioSubsystem; subclasses can substitute their own data (for example UModioUIFakeDataProvider for offline load
+ * testing) without any changes to the UI components, which only ever see the resulting subsystem events.
+ * Callbacks follow the same contract as the UModioSubsystem functions of the same name.
+ */
+UCLASS(Blueprintable)
+class MODIOUICORE_API UModioUIDataProvider : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	virtual void ListAllModsAsync(const FModioFilterParams& Filter, FOnListAllModsDelegateFast Callback);
+
+	virtual void ListModCollectionsAsync(const FModioFilterParams& Filter, FOnListModCollectionsDelegateFast Callback);
+
+	virtual void GetModCollectionModsAsync(FModioModCollectionID CollectionID,
+	                                       FOnGetModCollectionModsDelegateFast Callback);
+
+	virtual void GetModTagOptionsAsync(FOnGetModTagOptionsDelegateFast Callback);
+
+	virtual void ListUserFollowedModCollectionsAsync(const FModioFilterParams& Filter,
+	                                                 FOnListFollowedModCollectionsDelegateFast Callback);
+
+	virtual void GetModLogoAsync(FModioModID ModID, EModioLogoSize LogoSize, FOnGetMediaDelegateFast Callback);
+
+	virtual void GetModGalleryImageAsync(FModioModID ModID, EModioGallerySize ImageSize, int32 Index,
+	                                     FOnGetMediaDelegateFast Callback);
+
+	virtual void GetModCollectionLogoAsync(FModioModCollectionID CollectionID, EModioLogoSize LogoSize,
+	                                       FOnGetMediaDelegateFast Callback);
+
+	virtual void GetUserAvatarAsync(EModioAvatarSize AvatarSize, FOnGetMediaDelegateFast Callback);
+
+	/**
+	 * @brief Lists the token packs offered by the platform store. The default implementation queries the store
+	 * interface of the platform online subsystem, and fails with a system error if it is unavailable
+	 */
+	virtual void ListAllTokenPacksAsync(FOnListAllTokenPacksDelegateFast Callback);
+
+	virtual void GetUserWalletBalanceAsync(FOnGetUserWalletBalanceDelegateFast Callback);
+
+	virtual FModioErrorCode EnableModManagement(FOnModManagementDelegateFast Callback);
+
+	virtual void DisableModManagement();
+
+	/**
+	 * @brief Returns the mods in the user's library. Unlike the other calls this is answered synchronously, as the
+	 * UModioSubsystem queries it wraps only read local state
+	 * @param bSubscriptionsAndInstallations Include the user's subscriptions and the mods installed on the system
+	 * @param bPurchases Include the mods the user has purchased
+	 */
+	virtual TMap<FModioModID, FModioModInfo> QueryLibraryMods(bool bSubscriptionsAndInstallations, bool bPurchases);
+};
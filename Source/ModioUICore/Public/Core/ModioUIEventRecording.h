@@ -0,0 +1,144 @@
+/*
+ *  Copyright (C) 2025 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io UE Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "Containers/Ticker.h"
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "Misc/Optional.h"
+#include "Templates/SharedPointer.h"
+#include "Templates/UniquePtr.h"
+#include "Types/ModioCommonTypes.h"
+#include "Types/ModioErrorCode.h"
+#include "Types/ModioImageWrapper.h"
+#include "Types/ModioModInfoList.h"
+#include "Types/ModioModManagementEvent.h"
+
+class FArchive;
+class UModioUISubsystem;
+
+/**
+ * @brief A single UModioUISubsystem completion captured by FModioUIEventRecorder
+ */
+struct MODIOUICORE_API FModioUIRecordedEvent
+{
+	/** Seconds since recording started */
+	double Time = 0.0;
+
+	/** Which subsystem handler produced the event, e.g. ModManagement or ListAllMods */
+	FString Type;
+
+	/** Handler arguments. Error codes are reduced to success or failure, so replayed failures are generic */
+	TSharedPtr<FJsonObject> Payload;
+};
+
+/**
+ * @brief Streams the completions UModioUISubsystem broadcasts (mod management events, subscription changes, mod list
+ * results and media downloads) to a JSON Lines file, one timestamped event per line, so that a session's traffic can
+ * be replayed later by FModioUIEventReplayer.
+ *
+ * Started and stopped with UModioUISubsystem::StartEventRecording or the Modio.RecordUIEvents console command.
+ */
+class MODIOUICORE_API FModioUIEventRecorder
+{
+public:
+	/**
+	 * @brief Opens Path for writing, replacing any existing file
+	 * @return The recorder, or nullptr if the file could not be opened
+	 */
+	static TUniquePtr<FModioUIEventRecorder> Create(const FString& Path);
+
+	~FModioUIEventRecorder();
+
+	const FString& GetPath() const
+	{
+		return Path;
+	}
+
+	int32 GetNumEvents() const
+	{
+		return NumEvents;
+	}
+
+	void RecordModManagementEvent(const FModioModManagementEvent& Event);
+	void RecordSubscriptionChange(FModioErrorCode ErrorCode, FModioModID ID, bool bSubscribed);
+	void RecordListAllMods(FModioErrorCode ErrorCode, const TOptional<FModioModInfoList>& ModInfos,
+						   const FString& RequestIdentifier);
+
+	/**
+	 * @brief Records a media download completion
+	 * @param Type Which media handler completed (ModLogo, GalleryImage, UserAvatar, ...)
+	 * @param ID Raw ID of the mod or collection the media belongs to, if any
+	 * @param Detail Logo size or gallery index, depending on Type
+	 */
+	void RecordMediaCompleted(const TCHAR* Type, FModioErrorCode ErrorCode, const TOptional<FModioImageWrapper>& Image,
+							  const FString& ID = FString(), int32 Detail = 0);
+
+private:
+	FModioUIEventRecorder(const FString& InPath, TUniquePtr<FArchive> InWriter);
+
+	void WriteEvent(const TCHAR* Type, const TSharedRef<FJsonObject>& Payload);
+
+	FString Path;
+	TUniquePtr<FArchive> Writer;
+	double StartTime = 0.0;
+	int32 NumEvents = 0;
+};
+
+/**
+ * @brief Feeds a file written by FModioUIEventRecorder back into UModioUISubsystem, through the same handlers that
+ * produced the recorded broadcasts. Used by the Modio.ReplayUIEvents console command and, headlessly, by the
+ * ModioUIReplayEvents commandlet to turn captured sessions into deterministic performance tests.
+ */
+class MODIOUICORE_API FModioUIEventReplayer : public TSharedFromThis<FModioUIEventReplayer>
+{
+public:
+	/**
+	 * @brief Reads a recording. Lines that cannot be parsed are skipped with a warning
+	 * @return The replayer, or nullptr if the file could not be read
+	 */
+	static TSharedPtr<FModioUIEventReplayer> Load(const FString& Path);
+
+	~FModioUIEventReplayer();
+
+	const TArray<FModioUIRecordedEvent>& GetEvents() const
+	{
+		return Events;
+	}
+
+	/**
+	 * @brief Replays the recording from the core ticker
+	 * @param Speed Playback rate relative to the recording. Zero or less dispatches every event on the next tick
+	 */
+	void Play(float Speed = 1.0f);
+
+	void Stop();
+
+	bool IsPlaying() const
+	{
+		return TickHandle.IsValid();
+	}
+
+	/**
+	 * @brief Invokes the subsystem handler that originally produced Event
+	 * @return false if the event type is unknown or its payload is malformed
+	 */
+	static bool DispatchEvent(UModioUISubsystem& Subsystem, const FModioUIRecordedEvent& Event);
+
+private:
+	bool Tick(float DeltaTime);
+
+	TArray<FModioUIRecordedEvent> Events;
+	FTSTicker::FDelegateHandle TickHandle;
+	float PlaybackSpeed = 1.0f;
+	double PlaybackTime = 0.0;
+	int32 NextEventIndex = 0;
+};
@@ -0,0 +1,225 @@
+/*
+ *  Copyright (C) 2025 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io UE Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "Containers/Ticker.h"
+#include "Core/ModioUIDataProvider.h"
+#include "CoreMinimal.h"
+#include "Math/RandomStream.h"
+
+#include "ModioUIFakeDataProvider.generated.h"
+
+/**
+ * @brief Local stand-in for the mod.io backend. Generates deterministic synthetic mods, collections, tag options,
+ * images and mod management events without a network connection or an authenticated session, so that the whole
+ * component stack can be load tested repeatably. Responses are delivered on the game thread after a configurable
+ * latency, and a configurable fraction of requests fail with a system error.
+ *
+ * Enable it through UModioUISettings::DataProviderClass, UModioUISubsystem::SetDataProvider, or at runtime with the
+ * `Modio.FakeBackend` console command. Defaults can be set in the [/Script/ModioUICore.ModioUIFakeDataProvider]
+ * section of DefaultGame.ini.
+ */
+UCLASS(Config = Game)
+class MODIOUICORE_API UModioUIFakeDataProvider : public UModioUIDataProvider
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * @brief Seed for all generated content and for the latency/failure randomness
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "mod.io|UI|Fake Data Provider")
+	int32 Seed = 1337;
+
+	/**
+	 * @brief Number of mods in the fake catalogue
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "mod.io|UI|Fake Data Provider", meta = (ClampMin = "0"))
+	int32 NumMods = 50000;
+
+	/**
+	 * @brief Number of mod collections in the fake catalogue
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "mod.io|UI|Fake Data Provider", meta = (ClampMin = "0"))
+	int32 NumModCollections = 500;
+
+	/**
+	 * @brief Number of mods returned for each mod collection
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "mod.io|UI|Fake Data Provider", meta = (ClampMin = "0"))
+	int32 ModsPerCollection = 20;
+
+	/**
+	 * @brief Number of mod collections, taken from the start of the fake catalogue, that the user follows
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "mod.io|UI|Fake Data Provider", meta = (ClampMin = "0"))
+	int32 NumFollowedModCollections = 10;
+
+	/**
+	 * @brief Number of mods, taken from the start of the fake catalogue, in the user's subscriptions and installations
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "mod.io|UI|Fake Data Provider", meta = (ClampMin = "0"))
+	int32 NumSubscribedMods = 100;
+
+	/**
+	 * @brief Number of mods the user has purchased, taken from the fake catalogue after the subscribed mods
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "mod.io|UI|Fake Data Provider", meta = (ClampMin = "0"))
+	int32 NumPurchasedMods = 10;
+
+	/**
+	 * @brief Number of token packs offered by the fake store
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "mod.io|UI|Fake Data Provider", meta = (ClampMin = "0"))
+	int32 NumTokenPacks = 6;
+
+	/**
+	 * @brief Balance reported for the user's wallet
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "mod.io|UI|Fake Data Provider", meta = (ClampMin = "0"))
+	int64 WalletBalance = 1000;
+
+	/**
+	 * @brief Maximum number of results returned per list request, regardless of the count requested by the filter
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "mod.io|UI|Fake Data Provider", meta = (ClampMin = "1"))
+	int32 PageSize = 100;
+
+	/**
+	 * @brief Number of tag categories returned by the tag options request
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "mod.io|UI|Fake Data Provider", meta = (ClampMin = "0"))
+	int32 NumTagCategories = 8;
+
+	/**
+	 * @brief Number of tags in each tag category
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "mod.io|UI|Fake Data Provider", meta = (ClampMin = "1"))
+	int32 TagsPerCategory = 12;
+
+	/**
+	 * @brief Mean delay in seconds before a response is delivered
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "mod.io|UI|Fake Data Provider", meta = (ClampMin = "0"))
+	float LatencySeconds = 0.1f;
+
+	/**
+	 * @brief Maximum random deviation in seconds applied to LatencySeconds for each response
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "mod.io|UI|Fake Data Provider", meta = (ClampMin = "0"))
+	float JitterSeconds = 0.05f;
+
+	/**
+	 * @brief Fraction of requests, from 0 to 1, that complete with an error instead of data
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "mod.io|UI|Fake Data Provider",
+	          meta = (ClampMin = "0", ClampMax = "1"))
+	float FailureRate = 0.0f;
+
+	/**
+	 * @brief Interval in seconds between synthetic mod management events while mod management is enabled. Zero
+	 * disables event generation
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "mod.io|UI|Fake Data Provider", meta = (ClampMin = "0"))
+	float ManagementEventIntervalSeconds = 2.0f;
+
+	/**
+	 * @brief Applies Key=Value overrides (matching the property names above) from a console command or command line
+	 * @param Params String of space-separated Key=Value pairs
+	 */
+	void ApplyOverrides(const TCHAR* Params);
+
+	/**
+	 * @brief Generates the mod at the given index of the fake catalogue
+	 */
+	FModioModInfo MakeMod(int64 ModIndex) const;
+
+	/**
+	 * @brief Generates the mod collection at the given index of the fake catalogue
+	 */
+	FModioModCollectionInfo MakeModCollection(int64 CollectionIndex) const;
+
+	/**
+	 * @brief Returns how many requests of the given kind have reached the provider, for checking request coalescing
+	 * @param RequestName ListAllMods, ListModCollections, GetModCollectionMods, GetModTagOptions,
+	 * ListUserFollowedModCollections, ListAllTokenPacks, GetUserWalletBalance, QueryLibraryMods or GetMedia
+	 */
+	int32 GetRequestCount(FName RequestName) const;
+
+	void ResetRequestCounts();
+
+	/**
+	 * @brief Writes the count of every kind of request received so far to OutputDevice
+	 */
+	void DumpRequestCounts(FOutputDevice& OutputDevice) const;
+
+	//~ Begin UObject Interface
+	virtual void PostInitProperties() override;
+	virtual void BeginDestroy() override;
+	//~ End UObject Interface
+
+	//~ Begin UModioUIDataProvider Interface
+	virtual void ListAllModsAsync(const FModioFilterParams& Filter, FOnListAllModsDelegateFast Callback) override;
+	virtual void ListModCollectionsAsync(const FModioFilterParams& Filter,
+	                                     FOnListModCollectionsDelegateFast Callback) override;
+	virtual void GetModCollectionModsAsync(FModioModCollectionID CollectionID,
+	                                       FOnGetModCollectionModsDelegateFast Callback) override;
+	virtual void GetModTagOptionsAsync(FOnGetModTagOptionsDelegateFast Callback) override;
+	virtual void ListUserFollowedModCollectionsAsync(const FModioFilterParams& Filter,
+	                                                 FOnListFollowedModCollectionsDelegateFast Callback) override;
+	virtual void GetModLogoAsync(FModioModID ModID, EModioLogoSize LogoSize, FOnGetMediaDelegateFast Callback) override;
+	virtual void GetModGalleryImageAsync(FModioModID ModID, EModioGallerySize ImageSize, int32 Index,
+	                                     FOnGetMediaDelegateFast Callback) override;
+	virtual void GetModCollectionLogoAsync(FModioModCollectionID CollectionID, EModioLogoSize LogoSize,
+	                                       FOnGetMediaDelegateFast Callback) override;
+	virtual void GetUserAvatarAsync(EModioAvatarSize AvatarSize, FOnGetMediaDelegateFast Callback) override;
+	virtual void ListAllTokenPacksAsync(FOnListAllTokenPacksDelegateFast Callback) override;
+	virtual void GetUserWalletBalanceAsync(FOnGetUserWalletBalanceDelegateFast Callback) override;
+	virtual FModioErrorCode EnableModManagement(FOnModManagementDelegateFast Callback) override;
+	virtual void DisableModManagement() override;
+	virtual TMap<FModioModID, FModioModInfo> QueryLibraryMods(bool bSubscriptionsAndInstallations,
+	                                                          bool bPurchases) override;
+	//~ End UModioUIDataProvider Interface
+
+protected:
+	void RecordRequest(FName RequestName);
+
+	/**
+	 * @brief Rolls the configured failure rate for a single request
+	 */
+	bool ShouldFail();
+
+	/**
+	 * @brief Invokes Completion on the game thread after the configured latency and jitter
+	 */
+	void ScheduleCompletion(TFunction<void()> Completion);
+
+	/**
+	 * @brief Returns the path of a generated placeholder image, writing it to disk the first time it is requested
+	 * @param Key Any value identifying the media item; images are tinted by it so neighbours are distinguishable
+	 */
+	FString GetPlaceholderImagePath(uint32 Key, int32 Width, int32 Height);
+
+	void ScheduleMediaCompletion(uint32 Key, int32 Width, int32 Height, FOnGetMediaDelegateFast Callback);
+
+	bool TickManagementEvents(float DeltaTime);
+
+	FRandomStream Stream;
+
+	TSet<FString> WrittenImagePaths;
+
+	TMap<FName, int32> RequestCounts;
+
+	FOnModManagementDelegateFast ManagementCallback;
+	FTSTicker::FDelegateHandle ManagementTickHandle;
+	int32 NextManagementEvent = 0;
+	int64 ManagementEventModIndex = 0;
+};
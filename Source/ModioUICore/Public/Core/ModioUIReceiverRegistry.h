@@ -0,0 +1,230 @@
+/*
+ *  Copyright (C) 2025 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io UE Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "Containers/SparseArray.h"
+#include "CoreMinimal.h"
+#include "Delegates/Delegate.h"
+#include "ModioUIStats.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+/**
+ * @brief Stable handle to a receiver registered with a TModioUIReceiverRegistry. Remains valid until that receiver is
+ * removed, and never refers to a receiver registered later in the same slot
+ */
+struct FModioUIReceiverHandle
+{
+	int32 Index = INDEX_NONE;
+	uint32 Serial = 0;
+
+	bool IsValid() const
+	{
+		return Index != INDEX_NONE;
+	}
+
+	void Reset()
+	{
+		*this = FModioUIReceiverHandle();
+	}
+};
+
+template<typename MulticastDelegateType>
+class TModioUIReceiverRegistry;
+
+/**
+ * @brief Receiver list for a UModioUISubsystem event, used in place of a multicast delegate so that registering and
+ * deregistering a receiver takes constant time regardless of how many other receivers are bound. Bindings are keyed by
+ * receiver object and binding owner (the receiver interface or Blueprint helper that made the binding), so an object
+ * implementing two receiver interfaces for the same event keeps both handlers. Registering again with the same owner
+ * replaces the existing binding. Bindings whose receiver has been destroyed are pruned when a broadcast comes across
+ * them.
+ *
+ * Like the multicast delegates this replaces, a broadcast runs the most recently registered bindings first, although
+ * a binding that reuses a slot freed by an earlier deregistration runs in that slot's place. Receivers may register or
+ * deregister from inside a broadcast. Receivers removed during a broadcast are not invoked for the rest of it;
+ * receivers added during a broadcast may or may not be.
+ */
+template<typename... ParamTypes>
+class TModioUIReceiverRegistry<TMulticastDelegate<void(ParamTypes...)>>
+{
+public:
+	using FDelegate = TDelegate<void(ParamTypes...)>;
+
+	TModioUIReceiverRegistry() = default;
+	TModioUIReceiverRegistry(const TModioUIReceiverRegistry&) = delete;
+	TModioUIReceiverRegistry& operator=(const TModioUIReceiverRegistry&) = delete;
+
+	~TModioUIReceiverRegistry()
+	{
+		DEC_DWORD_STAT_BY(STAT_ModioUI_LiveReceivers, IndexByReceiver.Num());
+	}
+
+	/**
+	 * @brief Binds Handler for Receiver, replacing any binding Receiver already has from the same owner
+	 * @param Owner Identifies what made the binding, such as the receiver interface's UClass or the Blueprint
+	 * registration helper. Bindings from different owners are tracked separately
+	 */
+	FModioUIReceiverHandle Add(const UObject* Receiver, FDelegate Handler, const void* Owner)
+	{
+		if (!Receiver)
+		{
+			return {};
+		}
+
+		const FRegistrationKey Key {FObjectKey(Receiver), Owner};
+		if (const int32* ExistingIndex = IndexByReceiver.Find(Key))
+		{
+			if (BroadcastDepth == 0)
+			{
+				FEntry& Existing = Entries[*ExistingIndex];
+				Existing.Handler = MoveTemp(Handler);
+				return {*ExistingIndex, Existing.Serial};
+			}
+			// The existing binding may be the one executing, so retire it rather than overwrite it
+			RemoveEntry(*ExistingIndex);
+			IndexByReceiver.Remove(Key);
+		}
+
+		FEntry NewEntry;
+		NewEntry.Key = Key;
+		NewEntry.Receiver = Receiver;
+		NewEntry.Handler = MoveTemp(Handler);
+		NewEntry.Serial = ++LastSerial;
+		const int32 Index = Entries.Add(MoveTemp(NewEntry));
+		IndexByReceiver.Add(Key, Index);
+		INC_DWORD_STAT(STAT_ModioUI_LiveReceivers);
+		return {Index, LastSerial};
+	}
+
+	/**
+	 * @brief Removes Receiver's binding from the given owner, if it has one
+	 * @return True if a binding was removed
+	 */
+	bool Remove(const UObject* Receiver, const void* Owner)
+	{
+		int32 Index = INDEX_NONE;
+		if (IndexByReceiver.RemoveAndCopyValue(FRegistrationKey {FObjectKey(Receiver), Owner}, Index))
+		{
+			RemoveEntry(Index);
+			return true;
+		}
+		return false;
+	}
+
+	/**
+	 * @brief Removes the binding identified by Handle, if it is still registered
+	 * @return True if a binding was removed
+	 */
+	bool Remove(FModioUIReceiverHandle Handle)
+	{
+		if (!Entries.IsValidIndex(Handle.Index) || Entries[Handle.Index].Serial != Handle.Serial ||
+			Entries[Handle.Index].bPendingRemoval)
+		{
+			return false;
+		}
+		IndexByReceiver.Remove(Entries[Handle.Index].Key);
+		RemoveEntry(Handle.Index);
+		return true;
+	}
+
+	bool Contains(const UObject* Receiver, const void* Owner) const
+	{
+		return IndexByReceiver.Contains(FRegistrationKey {FObjectKey(Receiver), Owner});
+	}
+
+	/**
+	 * @brief Returns the number of registered bindings, including any whose receiver has been destroyed but not pruned
+	 * yet
+	 */
+	int32 Num() const
+	{
+		return IndexByReceiver.Num();
+	}
+
+	void Broadcast(typename TCallTraits<ParamTypes>::ParamType... Params)
+	{
+		++BroadcastDepth;
+		// Walked from the top down so later registrations run first. Bindings added by receivers during the broadcast
+		// either land past the slots that existed when it started or reuse a free slot that may already have been passed
+		for (int32 Index = Entries.GetMaxIndex() - 1; Index >= 0; --Index)
+		{
+			if (!Entries.IsAllocated(Index) || Entries[Index].bPendingRemoval)
+			{
+				continue;
+			}
+			if (!Entries[Index].Receiver.IsValid())
+			{
+				IndexByReceiver.Remove(Entries[Index].Key);
+				RemoveEntry(Index);
+				continue;
+			}
+			Entries[Index].Handler.ExecuteIfBound(Params...);
+		}
+		--BroadcastDepth;
+
+		if (BroadcastDepth == 0 && PendingRemovals.Num() > 0)
+		{
+			for (const int32 Index : PendingRemovals)
+			{
+				Entries.RemoveAt(Index);
+			}
+			PendingRemovals.Reset();
+		}
+	}
+
+private:
+	struct FRegistrationKey
+	{
+		FObjectKey Receiver;
+		const void* Owner = nullptr;
+
+		bool operator==(const FRegistrationKey& Other) const
+		{
+			return Receiver == Other.Receiver && Owner == Other.Owner;
+		}
+
+		friend uint32 GetTypeHash(const FRegistrationKey& Key)
+		{
+			return HashCombine(GetTypeHash(Key.Receiver), PointerHash(Key.Owner));
+		}
+	};
+
+	struct FEntry
+	{
+		FRegistrationKey Key;
+		TWeakObjectPtr<const UObject> Receiver;
+		FDelegate Handler;
+		uint32 Serial = 0;
+		bool bPendingRemoval = false;
+	};
+
+	void RemoveEntry(int32 Index)
+	{
+		DEC_DWORD_STAT(STAT_ModioUI_LiveReceivers);
+		if (BroadcastDepth > 0)
+		{
+			// Freeing the slot now could let a new binding take it and be invoked by the broadcast in progress
+			Entries[Index].bPendingRemoval = true;
+			PendingRemovals.Add(Index);
+		}
+		else
+		{
+			Entries.RemoveAt(Index);
+		}
+	}
+
+	TSparseArray<FEntry> Entries;
+	TMap<FRegistrationKey, int32> IndexByReceiver;
+	TArray<int32> PendingRemovals;
+	uint32 LastSerial = 0;
+	int32 BroadcastDepth = 0;
+};
@@ -0,0 +1,53 @@
+/*
+ *  Copyright (C) 2025 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io UE Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * @brief Tracks how a dialog's data source was bound through UModioUISubsystem's warm dialog path. A warm dialog is
+ * prepared ahead of display, and the receiver showing it then passes the same data source again; that second call can
+ * skip the rebuild. Media that would start downloads is deferred while the dialog is only being prepared.
+ *
+ * Dialogs call BeginSetDataSource at the top of NativeSetDataSource, DeferMedia once they have rebuilt, and
+ * ConsumeDeferredMedia wherever they hand their data source to media widgets.
+ */
+struct MODIOUICORE_API FModioWarmDialogState
+{
+	/**
+	 * @brief Records whether this call comes through the warm dialog path
+	 * @param InDataSource Data source being set on the dialog
+	 * @param CurrentDataSource Data source the dialog currently holds
+	 * @return false if the dialog already holds InDataSource from the warm path and can skip its rebuild
+	 */
+	bool BeginSetDataSource(const UObject* InDataSource, const UObject* CurrentDataSource);
+
+	/**
+	 * @brief Marks the dialog's media as waiting for the data source, to be handed over by ConsumeDeferredMedia
+	 */
+	void DeferMedia();
+
+	/**
+	 * @brief Returns true, once, if deferred media should be handed the data source now, i.e. unless the dialog is only
+	 * being prepared
+	 */
+	bool ConsumeDeferredMedia();
+
+private:
+	/** Whether the current data source was bound through the warm dialog path */
+	bool bDataSourceFromWarmDialog = false;
+
+	/** Whether the current BeginSetDataSource call is only preparing the dialog ahead of display */
+	bool bPreparing = false;
+
+	/** Whether the dialog's media is still waiting for the data source */
+	bool bMediaDeferred = false;
+};
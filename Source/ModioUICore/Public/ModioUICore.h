@@ -18,6 +18,8 @@ class FModioUICore : public IModuleInterface
 {
 	public:
 	TArray<struct IConsoleCommand*> ConsoleCommands;
+	/** Replay started by Modio.ReplayUIEvents, kept alive until it is stopped or replaced */
+	TSharedPtr<class FModioUIEventReplayer> ActiveReplay;
 	/* Called when the module is loaded */
 	virtual void StartupModule() override;
 
@@ -26,4 +28,8 @@ class FModioUICore : public IModuleInterface
 	void RequestEmailAuthCodeForTesting(const TArray<FString>& Args, UWorld* Unused, FOutputDevice& OutputDevice);
 	void SubmitEmailAuthCodeForTesting(const TArray<FString>& Args, UWorld*, FOutputDevice& OutputDevice);
 	void SimulateConnectivityChange(const TArray<FString>& Args, UWorld*, FOutputDevice& OutputDevice);
+	void SetFakeBackend(const TArray<FString>& Args, UWorld*, FOutputDevice& OutputDevice);
+	void RecordUIEvents(const TArray<FString>& Args, UWorld*, FOutputDevice& OutputDevice);
+	void ReplayUIEvents(const TArray<FString>& Args, UWorld*, FOutputDevice& OutputDevice);
+	void ReportUIPreload(const TArray<FString>& Args, UWorld*, FOutputDevice& OutputDevice);
 };
@@ -48,6 +48,125 @@ public:
 	UPROPERTY(EditDefaultsOnly, config, Category = "UI Configuration")
 	FModioPresetFilterParams DefaultCollectionsFilter;
 
+	/**
+	 * Class of the data provider the UI subsystem fetches mod.io data from. Leave unset to use the mod.io SDK, or set
+	 * to ModioUIFakeDataProvider to drive the UI with local synthetic data for load testing
+	 */
+	UPROPERTY(EditDefaultsOnly, config, Category = "UI Configuration", AdvancedDisplay)
+	TSoftClassPtr<class UModioUIDataProvider> DataProviderClass;
+
+	/**
+	 * Seconds for which cached mod tag options are served as-is before the UI subsystem revalidates them in the
+	 * background
+	 */
+	UPROPERTY(EditDefaultsOnly, config, Category = "UI Configuration", AdvancedDisplay, meta = (ClampMin = "0"))
+	float TagOptionsMaxAgeSeconds = 3600.0f;
+
+	/**
+	 * Whether mod tag options are saved to disk so that filters can be populated immediately on the next launch
+	 */
+	UPROPERTY(EditDefaultsOnly, config, Category = "UI Configuration", AdvancedDisplay)
+	bool bPersistTagOptions = true;
+
+	/**
+	 * Seconds over which mod info requests from different widgets are merged into shared queries. Zero merges the
+	 * requests made within the same frame
+	 */
+	UPROPERTY(EditDefaultsOnly, config, Category = "UI Configuration", AdvancedDisplay, meta = (ClampMin = "0"))
+	float ModInfoBatchWindowSeconds = 0.0f;
+
+	/**
+	 * Maximum number of mod IDs sent in a single mod info query. Larger batches are split into several queries; this
+	 * should not exceed the server's page size
+	 */
+	UPROPERTY(EditDefaultsOnly, config, Category = "UI Configuration", AdvancedDisplay,
+			  meta = (ClampMin = "1", ClampMax = "100"))
+	int32 ModInfoBatchMaxIDs = 100;
+
+	/**
+	 * Seconds for which fetched mod info is reused to answer repeated requests for the same mods instead of querying
+	 * again. Zero always queries
+	 */
+	UPROPERTY(EditDefaultsOnly, config, Category = "UI Configuration", AdvancedDisplay, meta = (ClampMin = "0"))
+	float ModInfoReuseSeconds = 5.0f;
+
+	/**
+	 * Seconds a mod or collection rating must stay unchanged before it is submitted, so that a user toggling between
+	 * ratings sends only the final one. Changes still settling when the UI subsystem shuts down are not sent
+	 */
+	UPROPERTY(EditDefaultsOnly, config, Category = "UI Configuration", AdvancedDisplay, meta = (ClampMin = "0"))
+	float RatingSubmissionSettleSeconds = 1.0f;
+
+	/**
+	 * Whether the current user's mod and collection ratings are saved to disk, so that rating displays show them on
+	 * the next launch
+	 */
+	UPROPERTY(EditDefaultsOnly, config, Category = "UI Configuration", AdvancedDisplay)
+	bool bPersistRatings = true;
+
+	/**
+	 * Seconds for which the token packs listed by the platform store are reused to answer further token pack requests
+	 * instead of querying the store again. Zero always queries
+	 */
+	UPROPERTY(EditDefaultsOnly, config, Category = "UI Configuration", AdvancedDisplay, meta = (ClampMin = "0"))
+	float TokenPackCatalogueMaxAgeSeconds = 300.0f;
+
+	/**
+	 * Seconds for which a fetched wallet balance answers further balance refresh requests instead of querying again,
+	 * so that changes made outside this client are picked up. Zero always queries
+	 */
+	UPROPERTY(EditDefaultsOnly, config, Category = "UI Configuration", AdvancedDisplay, meta = (ClampMin = "0"))
+	float WalletBalanceMaxAgeSeconds = 30.0f;
+
+	/**
+	 * Number of mod collections whose mod lists are kept in memory, so that reopening a recently viewed collection
+	 * shows its mods without another request. Zero disables the cache
+	 */
+	UPROPERTY(EditDefaultsOnly, config, Category = "UI Configuration", AdvancedDisplay, meta = (ClampMin = "0"))
+	int32 CollectionModsCacheSize = 16;
+
+	/**
+	 * Seconds after which a cached collection mod list is still shown immediately, but refetched in the background
+	 */
+	UPROPERTY(EditDefaultsOnly, config, Category = "UI Configuration", AdvancedDisplay, meta = (ClampMin = "0"))
+	float CollectionModsMaxAgeSeconds = 300.0f;
+
+	/**
+	 * Seconds a tile must stay hovered or focused before a warm dialog is prepared with its content, so that sweeping
+	 * across a grid does not rebuild the dialog for every tile passed over
+	 */
+	UPROPERTY(EditDefaultsOnly, config, Category = "UI Configuration", AdvancedDisplay, meta = (ClampMin = "0"))
+	float DialogPreparationDelaySeconds = 0.15f;
+
+	/**
+	 * Number of closed selector and dropdown menus whose entry widgets are kept alive so they reopen instantly. The
+	 * entries of menus closed longer ago are released and rebuilt from their stored values the next time they open
+	 */
+	UPROPERTY(EditDefaultsOnly, config, Category = "UI Configuration", AdvancedDisplay, meta = (ClampMin = "0"))
+	int32 MaxIdleSelectorMenus = 4;
+
+	/**
+	 * Whether the UI subsystem streams in the preload manifest in the background at startup. The manifest holds the
+	 * colors and commands tables, the text input materials and the assets below, which would otherwise each be loaded
+	 * synchronously the first time they are used
+	 */
+	UPROPERTY(EditDefaultsOnly, config, Category = "UI Configuration|Preloading")
+	bool bPreloadUIAssetsOnStartup = true;
+
+	/**
+	 * Widget classes streamed in with the preload manifest, such as the mod browser template and the dialogs it opens.
+	 * Soft references held by their defaults and widget trees, such as class path overrides, are preloaded as well. The
+	 * preload goes no further than that, so list a referenced widget class here too if its own references are needed
+	 */
+	UPROPERTY(EditDefaultsOnly, config, Category = "UI Configuration|Preloading")
+	TArray<TSoftClassPtr<class UUserWidget>> PreloadWidgetClasses;
+
+	/**
+	 * Any other assets to stream in with the preload manifest
+	 */
+	UPROPERTY(EditDefaultsOnly, config, Category = "UI Configuration|Preloading")
+	TArray<FSoftObjectPath> PreloadAssets;
+
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "UI Configuration")
 	static FModioPresetFilterParams GetDefaultCollectionsFilter();
 };
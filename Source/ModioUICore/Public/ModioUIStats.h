@@ -0,0 +1,78 @@
+/*
+ *  Copyright (C) 2025 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io UE Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+
+// Instrumentation for the mod.io UI hot paths. Use `stat ModioUI` in-game, enable the `ModioUI` trace channel in
+// Unreal Insights (-trace=cpu,ModioUI), or capture with `csvprofile start` to attribute UI frame time to the plugin.
+
+#define MODIO_UI_WITH_STATS (STATS || CSV_PROFILER)
+
+UE_TRACE_CHANNEL_EXTERN(ModioUIChannel, MODIOUICORE_API);
+
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(MODIOUICORE_API, ModioUI);
+
+DECLARE_STATS_GROUP(TEXT("ModioUI"), STATGROUP_ModioUI, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Subsystem Request Issue"), STAT_ModioUI_RequestIssue, STATGROUP_ModioUI,
+                          MODIOUICORE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Subsystem Request Completion"), STAT_ModioUI_RequestCompletion, STATGROUP_ModioUI,
+                          MODIOUICORE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Tile SetDataSource"), STAT_ModioUI_TileSetDataSource, STATGROUP_ModioUI,
+                          MODIOUICORE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Image Load"), STAT_ModioUI_ImageLoad, STATGROUP_ModioUI, MODIOUICORE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Image Decode Completion"), STAT_ModioUI_ImageDecode, STATGROUP_ModioUI,
+                          MODIOUICORE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("List Regeneration"), STAT_ModioUI_ListRegeneration, STATGROUP_ModioUI,
+                          MODIOUICORE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Command List Rebuild"), STAT_ModioUI_CommandListRebuild, STATGROUP_ModioUI,
+                          MODIOUICORE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Deferred Entry Binding"), STAT_ModioUI_DeferredEntryBinding, STATGROUP_ModioUI,
+                          MODIOUICORE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Warm Dialog Preparation"), STAT_ModioUI_DialogPrepare, STATGROUP_ModioUI,
+                          MODIOUICORE_API);
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Live Event Receivers"), STAT_ModioUI_LiveReceivers, STATGROUP_ModioUI,
+                                      MODIOUICORE_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Image Loads In Flight"), STAT_ModioUI_ImageLoadsInFlight,
+                                      STATGROUP_ModioUI, MODIOUICORE_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Entries Awaiting Binding"), STAT_ModioUI_EntriesAwaitingBinding,
+                                      STATGROUP_ModioUI, MODIOUICORE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Broadcast Fan-out"), STAT_ModioUI_BroadcastFanOut, STATGROUP_ModioUI,
+                                  MODIOUICORE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Wrapper Objects Created"), STAT_ModioUI_WrappersCreated, STATGROUP_ModioUI,
+                                  MODIOUICORE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Mod Info Queries Issued"), STAT_ModioUI_ModInfoQueriesIssued, STATGROUP_ModioUI,
+                                  MODIOUICORE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Text Block Updates Applied"), STAT_ModioUI_TextUpdatesApplied, STATGROUP_ModioUI,
+                                  MODIOUICORE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Text Block Updates Skipped"), STAT_ModioUI_TextUpdatesSkipped, STATGROUP_ModioUI,
+                                  MODIOUICORE_API);
+
+/**
+ * @brief Times the enclosing scope against both the ModioUI stat group and the ModioUI trace channel
+ */
+#define MODIO_UI_SCOPE_CYCLE_COUNTER(Stat)                                 \
+	SCOPE_CYCLE_COUNTER(Stat);                                             \
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(Stat, ModioUIChannel);        \
+	CSV_SCOPED_TIMING_STAT(ModioUI, Stat)
+
+/**
+ * @brief Records the creation of Count UObject wrappers (UModioModInfoUI and friends) for the current frame
+ */
+#define MODIO_UI_COUNT_WRAPPERS_CREATED(Count)                             \
+	INC_DWORD_STAT_BY(STAT_ModioUI_WrappersCreated, Count);                \
+	CSV_CUSTOM_STAT(ModioUI, WrappersCreated, static_cast<int32>(Count), ECsvCustomStatOp::Accumulate)
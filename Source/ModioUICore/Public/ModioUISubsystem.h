@@ -10,12 +10,18 @@
 
 #pragma once
 
+#include "Containers/Ticker.h"
 #include "CoreMinimal.h"
+#include "Core/ModioUIDataProvider.h"
+#include "Core/ModioUIEventRecording.h"
+#include "Core/ModioUIReceiverRegistry.h"
 #include "Delegates/Delegate.h"
 #include "Engine/Engine.h"
+#include "Engine/StreamableManager.h"
 #include "Misc/EngineVersionComparison.h"
 #include "ModioSubsystem.h"
 #include "ModioUICore.h"
+#include "ModioUIStats.h"
 #include "Subsystems/EngineSubsystem.h"
 #include "Types/ModioCommonTypes.h"
 #include "Types/ModioErrorCode.h"
@@ -41,6 +47,7 @@ DECLARE_DYNAMIC_DELEGATE_TwoParams(FOnQueryFollowedModCollectionCompleted, FModi
                                    bIsCollectionFollowed);
 
 DECLARE_DELEGATE_TwoParams(FOnQueryFollowedModCollectionCompletedFast, FModioErrorCode, bool);
+DECLARE_DELEGATE_TwoParams(FOnUserAvatarTextureReadyFast, FModioErrorCode, class UTexture2DDynamic*);
 
 DECLARE_MULTICAST_DELEGATE_FourParams(FOnModLogoDownloadCompleted, FModioModID, FModioErrorCode,
                                       TOptional<FModioImageWrapper>, EModioLogoSize);
@@ -106,7 +113,6 @@ DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnTokenPackRequestCompleted, FModioToken
 DECLARE_MULTICAST_DELEGATE_TwoParams(FOnListAllTokenPacksRequestCompleted, FModioErrorCode,
                                      TOptional<FModioTokenPackList>);
 
-DECLARE_DELEGATE_TwoParams(FOnListAllTokenPacksDelegateFast, FModioErrorCode, TOptional<FModioTokenPackList>);
 DECLARE_DELEGATE_TwoParams(FOnGetTokenPackDelegateFast, FModioErrorCode, TOptional<FModioTokenPack>);
 
 DECLARE_MULTICAST_DELEGATE(FOnEntitlementRefreshRequest);
@@ -172,12 +178,21 @@ protected:
 
 	friend class SModioUIInstallationStatusTestWidget;
 
+	// The benchmark commandlet drives the completion handlers directly with synthetic data
+	friend class UModioUIBenchmarkCommandlet;
+
 	#endif
 
-	FOnModEnabledChanged OnModEnabledStateChanged;
+	// The replayer feeds recorded completions back through the private handlers
+	friend class FModioUIEventReplayer;
+
+	/** Active event recording, if any. Every completion routed through the handlers below is written to it */
+	TUniquePtr<FModioUIEventRecorder> EventRecorder;
 
-	FOnDisplayDialogRequest OnDialogDisplayEvent;
-	FOnEntitlementRefreshRequest OnEntitlementRefreshEvent;
+	TModioUIReceiverRegistry<FOnModEnabledChanged> OnModEnabledStateChanged;
+
+	TModioUIReceiverRegistry<FOnDisplayDialogRequest> OnDialogDisplayEvent;
+	TModioUIReceiverRegistry<FOnEntitlementRefreshRequest> OnEntitlementRefreshEvent;
 
 	UPROPERTY(Transient)
 	TObjectPtr<UObject> ModEnabledStateDataProvider;
@@ -188,16 +203,21 @@ protected:
 	UPROPERTY(Transient)
 	TObjectPtr<UObject> ModCollectionRatingStateProvider;
 
+	UPROPERTY(Transient)
+	TObjectPtr<class UModioUIDataProvider> DataProvider;
+
+	bool bModManagementEnabled = false;
+
 	UFUNCTION()
 	void OnModEnabledChanged(int64 RawModID, bool bNewEnabledState);
 
 	// Perhaps this should also carry the error code and a TOptional<bool> for the newly changed state?
-	FOnModSubscriptionStatusChanged OnSubscriptionStatusChanged;
+	TModioUIReceiverRegistry<FOnModSubscriptionStatusChanged> OnSubscriptionStatusChanged;
 
 	// Delegate for the subscription success or fail
 	FOnSubscriptionCompleted OnSubscriptionRequestCompleted;
 
-	FOnModCollectionFollowStateChanged OnModCollectionFollowStateChanged;
+	TModioUIReceiverRegistry<FOnModCollectionFollowStateChanged> OnModCollectionFollowStateChanged;
 	FOnModCollectionFollowCompleted OnModCollectionFollowRequestComplete;
 
 	FOnModCollectionFollowCompleted OnModCollectionSubscribeRequestComplete;
@@ -221,33 +241,33 @@ protected:
 	UFUNCTION()
 	void UninstallHandler(FModioErrorCode ErrorCode, FModioModID ID);
 
-	FOnModLogoDownloadCompleted OnModLogoDownloadCompleted;
+	TModioUIReceiverRegistry<FOnModLogoDownloadCompleted> OnModLogoDownloadCompleted;
 	void LogoDownloadHandler(FModioErrorCode ErrorCode, TOptional<FModioImageWrapper> Image, FModioModID ID,
 	                         EModioLogoSize LogoSize);
 
-	FOnUserAvatarDownloadCompleted OnUserAvatarDownloadCompleted;
+	TModioUIReceiverRegistry<FOnUserAvatarDownloadCompleted> OnUserAvatarDownloadCompleted;
 	void UserAvatarDownloadHandler(FModioErrorCode ErrorCode, TOptional<FModioImageWrapper> Image);
 
-	FOnModGalleryImageDownloadCompleted OnModGalleryImageDownloadCompleted;
+	TModioUIReceiverRegistry<FOnModGalleryImageDownloadCompleted> OnModGalleryImageDownloadCompleted;
 	void GalleryImageDownloadHandler(FModioErrorCode ErrorCode, TOptional<FModioImageWrapper> Image, FModioModID ID,
 	                                 int32 Index);
 
-	FOnModCreatorAvatarDownloadCompleted OnModCreatorAvatarDownloadCompleted;
+	TModioUIReceiverRegistry<FOnModCreatorAvatarDownloadCompleted> OnModCreatorAvatarDownloadCompleted;
 	void CreatorAvatarDownloadHandler(FModioErrorCode ErrorCode, TOptional<FModioImageWrapper> Image, FModioModID ID);
 
-	FOnModCollectionLogoDownloadCompleted OnModCollectionLogoDownloadCompleted;
+	TModioUIReceiverRegistry<FOnModCollectionLogoDownloadCompleted> OnModCollectionLogoDownloadCompleted;
 	void ModCollectionLogoDownloadHandler(FModioErrorCode ErrorCode, TOptional<FModioImageWrapper> Image,
 	                                      FModioModCollectionID ID, EModioLogoSize LogoSize);
 
-	FOnModCollectionCuratorAvatarDownloadCompleted OnModCollectionCuratorAvatarDownloadCompleted;
+	TModioUIReceiverRegistry<FOnModCollectionCuratorAvatarDownloadCompleted> OnModCollectionCuratorAvatarDownloadCompleted;
 	void ModCollectionCuratorAvatarDownloadHandler(FModioErrorCode ErrorCode, TOptional<FModioImageWrapper> Image,
 	                                               FModioModCollectionID ID);
 
-	FOnConnectivityChanged OnConnectivityChanged;
+	TModioUIReceiverRegistry<FOnConnectivityChanged> OnConnectivityChanged;
 	// The implementation currently assumes connectivity unless informed otherwise
 	bool bCurrentConnectivityState = true;
 
-	FOnAuthenticatedUserChanged OnUserChanged;
+	TModioUIReceiverRegistry<FOnAuthenticatedUserChanged> OnUserChanged;
 	FOnAuthenticationChangeStarted OnAuthenticationChangeStarted;
 
 	UPROPERTY()
@@ -255,46 +275,100 @@ protected:
 
 	void OnAuthenticationComplete(FModioErrorCode ErrorCode);
 
-	FOnModInfoRequestCompleted OnModInfoRequestCompleted;
+	TModioUIReceiverRegistry<FOnModInfoRequestCompleted> OnModInfoRequestCompleted;
 	void ModInfoRequestCompletedHandler(FModioErrorCode ErrorCode, TOptional<FModioModInfoList> ModInfos,
 	                                    TArray<FModioModID> IDs);
 
-	FOnModCollectionInfoRequestCompleted OnModCollectionInfoRequestCompleted;
+	struct FRecentModInfo
+	{
+		FModioModInfo Info;
+		double FetchTime = 0.0;
+
+		/** Number of cached collections listing this mod, which keep it alive past ModInfoReuseSeconds */
+		int32 NumCollections = 0;
+	};
+
+	/** Mod IDs requested during the current batch window, in request order */
+	TArray<FModioModID> PendingModInfoIDs;
+	TSet<FModioModID> PendingModInfoIDSet;
+
+	/** Mod IDs covered by a query that has not completed yet; repeated requests for them wait on that query */
+	TSet<FModioModID> InFlightModInfoIDs;
+
+	/**
+	 * Recently fetched mod info, reused for UModioUISettings::ModInfoReuseSeconds to answer repeated requests. Also
+	 * holds the info of every mod listed by a cached collection, once however many collections share the mod
+	 */
+	TMap<FModioModID, FRecentModInfo> RecentModInfos;
+
+	FTSTicker::FDelegateHandle ModInfoBatchTickHandle;
+	double ModInfoBatchDeadline = 0.0;
+
+	bool TickModInfoBatch(float DeltaTime);
+
+	/**
+	 * @brief Issues the queries for every pending mod ID that is not already in flight or recently fetched, split into
+	 * chunks of at most UModioUISettings::ModInfoBatchMaxIDs
+	 */
+	void FlushModInfoBatch();
+
+	struct FCachedCollectionMods
+	{
+		/** The collection's mods in the order the server returned them; their info is held in RecentModInfos */
+		TArray<FModioModID> ModIDs;
+		double FetchTime = 0.0;
+	};
+
+	/** Recently viewed collections' mod lists, bounded by UModioUISettings::CollectionModsCacheSize */
+	TMap<FModioModCollectionID, FCachedCollectionMods> CachedCollectionMods;
+
+	/** Keys of CachedCollectionMods, least recently used first */
+	TArray<FModioModCollectionID> CollectionModsLRU;
+
+	/** Collections whose mods have been requested and not returned yet; repeated requests wait on that request */
+	TSet<FModioModCollectionID> InFlightCollectionMods;
+
+	void CacheCollectionMods(FModioModCollectionID CollectionID, const FModioModInfoList& ModInfos);
+	void EvictCollectionMods(FModioModCollectionID CollectionID);
+	void ResetCollectionModsCache();
+
+	TModioUIReceiverRegistry<FOnModCollectionInfoRequestCompleted> OnModCollectionInfoRequestCompleted;
 	void ModCollectionInfoRequestCompletedHandler(FModioErrorCode ErrorCode,
 	                                              TOptional<FModioModCollectionInfoList> ModCollectionInfos,
 	                                              TArray<FModioModCollectionID> IDs);
 
-	FOnListAllModsRequestCompleted OnListAllModsRequestCompleted;
+	TModioUIReceiverRegistry<FOnListAllModsRequestCompleted> OnListAllModsRequestCompleted;
 	void ListAllModsCompletedHandler(FModioErrorCode ErrorCode, TOptional<FModioModInfoList> ModInfos,
 	                                 FString RequestIdentifier);
 
-	FOnListModCollectionsRequestCompleted OnListModCollectionsRequestCompleted;
+	TModioUIReceiverRegistry<FOnListModCollectionsRequestCompleted> OnListModCollectionsRequestCompleted;
 	void ListModCollectionsCompletedHandler(FModioErrorCode ErrorCode,
 	                                        TOptional<FModioModCollectionInfoList> ModCollectionInfos,
 	                                        FString RequestIdentifier);
 
-	FOnGetModCollectionModsRequestCompleted OnGetModCollectionModsRequestCompleted;
+	TModioUIReceiverRegistry<FOnGetModCollectionModsRequestCompleted> OnGetModCollectionModsRequestCompleted;
 	void GetModCollectionModsCompletedHandler(FModioErrorCode ErrorCode, TOptional<FModioModInfoList> ModInfos,
 	                                          FModioModCollectionID CollectionID);
 
-	FOnTokenPackRequestCompleted OnTokenPackRequestCompleted;
+	TModioUIReceiverRegistry<FOnTokenPackRequestCompleted> OnTokenPackRequestCompleted;
 	void TokenPackRequestCompletedHandler(FModioErrorCode ErrorCode, TOptional<FModioTokenPackList> TokenPacks,
 	                                      TArray<FModioTokenPackID> IDs);
 
-	FOnListAllTokenPacksRequestCompleted OnListAllTokenPacksRequestCompleted;
+	TModioUIReceiverRegistry<FOnListAllTokenPacksRequestCompleted> OnListAllTokenPacksRequestCompleted;
 	void ListAllTokenPacksCompletedHandler(FModioErrorCode ErrorCode, TOptional<FModioTokenPackList> TokenPacks);
 
-	FOnModManagementEventUI OnModManagementEvent;
+	TModioUIReceiverRegistry<FOnModManagementEventUI> OnModManagementEvent;
 
 	void ModManagementEventHandler(FModioModManagementEvent Event);
 
-	void OnGetModTagOptionsComplete(FModioErrorCode ModioErrorCode, TOptional<FModioModTagOptions> ModioModTagInfos);
+	void OnGetModTagOptionsComplete(FModioErrorCode ModioErrorCode, TOptional<FModioModTagOptions> ModioModTagInfos,
+	                                uint32 Generation);
 
 	FOnDisplayErrorManualParams OnDisplayManualParams;
 
 	FOnPurchaseRequestCompleted OnPurchaseRequestCompleted;
 
-	FOnGetUserWalletBalanceRequestCompleted OnGetUserWalletBalanceRequestCompleted;
+	TModioUIReceiverRegistry<FOnGetUserWalletBalanceRequestCompleted> OnGetUserWalletBalanceRequestCompleted;
 	void WalletBalanceRequestHandler(FModioErrorCode ErrorCode, TOptional<uint64> Balance);
 
 	FOnDisplayModDetails OnDisplayModDetails;
@@ -302,10 +376,170 @@ protected:
 
 	TOptional<FModioModTagOptions> CachedModTags;
 
+	/** Content hash of CachedModTags, used to tell whether a revalidation actually changed anything */
+	uint32 CachedModTagsHash = 0;
+
+	/** When CachedModTags was last fetched or revalidated, in UTC */
+	FDateTime CachedModTagsFetchTime;
+
+	/** Callbacks waiting on the in-flight tag options request, so concurrent requests share a single fetch */
+	TArray<FOnGetModTagOptionsDelegateFast> PendingTagOptionsCallbacks;
+
+	bool bTagOptionsRequestInFlight = false;
+
+	/** Bumped when the data provider changes, so a response from the previous provider is ignored */
+	uint32 TagOptionsGeneration = 0;
+
+	/** IDs of the collections the current user follows, valid once bFollowedModCollectionsFetched is set */
+	TSet<FModioModCollectionID> FollowedModCollectionIDs;
+
+	bool bFollowedModCollectionsFetched = false;
+
+	/** Handlers waiting on the in-flight followed collections request, so concurrent queries share a single fetch */
+	TArray<TPair<FModioModCollectionID, FOnQueryFollowedModCollectionCompletedFast>> PendingFollowQueries;
+
+	bool bFollowedModCollectionsRequestInFlight = false;
+
+	/** Bumped on invalidation, so that a response fetched for a previous user is discarded */
+	uint32 FollowedModCollectionsGeneration = 0;
+
+	void RequestFollowedModCollectionsFromProvider();
+	void OnListFollowedModCollectionsComplete(FModioErrorCode ErrorCode,
+	                                          TOptional<FModioModCollectionInfoList> FollowedCollections,
+	                                          uint32 Generation);
+
+	/** The current user's avatar, decoded once and shared by every avatar widget */
+	UPROPERTY(Transient)
+	TObjectPtr<class UTexture2DDynamic> CachedUserAvatarTexture;
+
+	/** The downloaded avatar CachedUserAvatarTexture was decoded from, re-broadcast to later RequestUserAvatar calls */
+	TOptional<FModioImageWrapper> CachedUserAvatarImage;
+
+	/** Callbacks waiting on the in-flight avatar download and decode */
+	TArray<FOnUserAvatarTextureReadyFast> PendingUserAvatarCallbacks;
+
+	bool bUserAvatarRequestInFlight = false;
+
+	/** Bumped on invalidation, so that an avatar downloaded for a previous user is discarded */
+	uint32 UserAvatarGeneration = 0;
+
+	void UserAvatarDecodedHandler(UTexture2DDynamic* Texture, uint32 Generation);
+	void CompleteUserAvatarCallbacks(FModioErrorCode ErrorCode);
+
+	/** Token packs listed by the platform store, reused until older than TokenPackCatalogueMaxAgeSeconds */
+	TOptional<FModioTokenPackList> CachedTokenPacks;
+
+	/** FPlatformTime::Seconds() at which CachedTokenPacks was fetched */
+	double CachedTokenPacksFetchTime = 0.0;
+
+	bool bTokenPacksRequestInFlight = false;
+
+	/** Bumped on invalidation, so that a catalogue fetched before an entitlement refresh is not cached */
+	uint32 TokenPacksGeneration = 0;
+
+	/** The current user's wallet balance, kept current from purchase transactions once it has been fetched */
+	TOptional<uint64> CachedWalletBalance;
+
+	/** FPlatformTime::Seconds() at which CachedWalletBalance was fetched or last updated by a purchase */
+	double CachedWalletBalanceFetchTime = 0.0;
+
+	/** Callbacks waiting on the in-flight wallet balance request, so concurrent requests share a single fetch */
+	TArray<FOnGetUserWalletBalanceDelegateFast> PendingWalletBalanceCallbacks;
+
+	bool bWalletBalanceRequestInFlight = false;
+
+	/** Bumped on invalidation, so that a balance fetched for a previous user is discarded */
+	uint32 WalletBalanceGeneration = 0;
+
+	void OnListAllTokenPacksComplete(FModioErrorCode ErrorCode, TOptional<FModioTokenPackList> TokenPacks,
+	                                 uint32 Generation);
+
+	/**
+	 * @brief Answers Callback and the wallet balance receivers from CachedWalletBalance, fetching it first if it is
+	 * unset or older than UModioUISettings::WalletBalanceMaxAgeSeconds
+	 */
+	void RequestWalletBalance(FOnGetUserWalletBalanceDelegateFast Callback);
+	void OnGetUserWalletBalanceComplete(FModioErrorCode ErrorCode, TOptional<uint64> Balance, uint32 Generation);
+
+	/** Keeps the shared tag objects in SharedModTags alive */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<class UModioModTagUI>> SharedModTagObjects;
+
+	/** Flyweight table of shared tag objects, keyed by raw tag string and the language their text is localized for */
+	TMap<TPair<FString, EModioLanguage>, class UModioModTagUI*> SharedModTags;
+
+	/** Keys of shared tags created without localized text, which show their raw string until a caller supplies it */
+	TSet<TPair<FString, EModioLanguage>> SharedModTagsWithFallbackText;
+
+	/** Drops the shared tag objects, so that tags are localized afresh. Widgets still holding old ones keep them alive */
+	void ResetSharedModTags();
+
+	/** Dialogs registered with RegisterWarmDialog, kept constructed between displays */
+	UPROPERTY(Transient)
+	TMap<EModioUIDialogType, TObjectPtr<class UCommonActivatableWidget>> WarmDialogs;
+
+	/** Latest PrepareDialog request for each dialog type, waiting out DialogPreparationDelaySeconds */
+	TMap<EModioUIDialogType, TWeakObjectPtr<UObject>> PendingDialogPreparations;
+
+	FTSTicker::FDelegateHandle DialogPreparationTickHandle;
+	double DialogPreparationDeadline = 0.0;
+
+	bool TickDialogPreparations(float DeltaTime);
+
+	/** Set while SetWarmDialogDataSource hands a data source to a warm dialog */
+	bool bSettingWarmDialogDataSource = false;
+
+	/** Set while that data source is a speculative preparation rather than a dialog about to be shown */
+	bool bPreparingWarmDialog = false;
+
+	/**
+	 * @brief Hands DataSource to the warm dialog for DialogType. A speculative preparation is skipped if the dialog
+	 * already has it; a dialog about to be shown is always handed it, so that it can start its deferred work
+	 */
+	void SetWarmDialogDataSource(EModioUIDialogType DialogType, UObject* DataSource, bool bSpeculative);
+
+	/** Selector menus with built entries that are not open, least recently closed first, with their release callbacks */
+	TArray<TPair<TWeakObjectPtr<UObject>, FSimpleDelegate>> IdleSelectorMenus;
+
+	FStreamableManager UIAssetStreamer;
+
+	/** Handles keeping the preloaded UI assets resident */
+	TArray<TSharedPtr<FStreamableHandle>> UIPreloadHandles;
+
+	/** Every asset PreloadUIAssets has been asked to stream in */
+	TSet<FSoftObjectPath> UIPreloadManifest;
+
+	int32 NumUIPreloadsInFlight = 0;
+
+	/**
+	 * @brief Streams in Assets and adds them to the manifest
+	 * @param bFollowSoftReferences Whether to stream in the soft references held by any widget classes among Assets
+	 * once they load. Only set for the manifest's own entries, so that preloading stops one level down rather than
+	 * walking the whole soft reference graph
+	 */
+	void RequestUIPreload(TArray<FSoftObjectPath> Assets, bool bFollowSoftReferences, FSimpleDelegate OnComplete);
+
+	void OnUIPreloadCompleted(TArray<FSoftObjectPath> Assets, bool bFollowSoftReferences, double StartTime,
+	                          FSimpleDelegate OnComplete);
+
+	/**
+	 * @brief Appends the soft object and class references held by Object's properties, including those nested in
+	 * structs and containers (such as class path overrides)
+	 */
+	static void CollectSoftReferences(const UObject& Object, TArray<FSoftObjectPath>& OutReferences);
+
+	void RequestTagOptionsFromProvider();
+	FString GetPersistedTagOptionsPath() const;
+	/** Only options from mod.io itself are persisted, never those from a substitute provider */
+	bool ShouldPersistTagOptions() const;
+	void LoadPersistedTagOptions();
+	void PersistTagOptions() const;
+
 	FVector2D CachedMouseCursorLocation;
 
 public:
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
 
 	/**
 	 * @docpublic
@@ -338,6 +572,24 @@ public:
 	void SetModCollectionRatingStateDataProvider(
 		TScriptInterface<IModCollectionRatingStateProvider> InModCollectionRatingStateProvider);
 
+	/**
+	 * @docpublic
+	 * @brief Sets the object the subsystem fetches mod.io data (mod and collection lists, tag options, media and mod
+	 * management events) from. Requests already in flight complete against the previous provider.
+	 *
+	 * @param InDataProvider - The provider to use, or nullptr to restore the default provider that forwards to the
+	 * mod.io SDK.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "mod.io|UI|ModioUISubsystem")
+	void SetDataProvider(UModioUIDataProvider* InDataProvider);
+
+	/**
+	 * @docpublic
+	 * @brief Gets the object the subsystem currently fetches mod.io data from
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "mod.io|UI|ModioUISubsystem")
+	UModioUIDataProvider* GetDataProvider() const;
+
 	/**
 	 * @docpublic
 	 * @brief Enables mod management, installing the UI subsystem as the mod management event handler so notifications can be broadcast to UI
@@ -410,7 +662,7 @@ public:
 	void LogOut(FOnErrorOnlyDelegateFast DedicatedCallback);
 
 	template<typename ClassOwner, class... Args, typename DelegateSignature, typename ImplementingClass>
-	void RegisterEventHandler(TMulticastDelegate<DelegateSignature>& Callback,
+	void RegisterEventHandler(TModioUIReceiverRegistry<TMulticastDelegate<DelegateSignature>>& Callback,
 	                          void (ClassOwner::*FunctionPointer)(Args...), ImplementingClass& ObjectToRegister)
 	{
 		if (FunctionPointer == nullptr)
@@ -418,20 +670,22 @@ public:
 			return;
 		}
 
-		Callback.RemoveAll(&ObjectToRegister);
-		Callback.AddUObject(&ObjectToRegister, FunctionPointer);
+		// Keyed by the receiver interface, so an object implementing two interfaces for the same event keeps both
+		Callback.Add(&ObjectToRegister,
+		             TDelegate<DelegateSignature>::CreateUObject(&ObjectToRegister, FunctionPointer),
+		             ClassOwner::UClassType::StaticClass());
 	}
 
-	template<typename DelegateSignature, typename ImplementingClass>
-	void DeregisterEventHandler(TMulticastDelegate<DelegateSignature>& Callback, ImplementingClass& ObjectToRegister)
+	template<typename ClassOwner, typename DelegateSignature, typename ImplementingClass>
+	void DeregisterEventHandler(TModioUIReceiverRegistry<TMulticastDelegate<DelegateSignature>>& Callback,
+	                            ImplementingClass& ObjectToRegister)
 	{
-		Callback.RemoveAll(&ObjectToRegister);
+		Callback.Remove(&ObjectToRegister, ClassOwner::UClassType::StaticClass());
 	}
 
 	template<typename DelegateSignature, typename Func>
-	void RegisterEventHandlerFromK2(TMulticastDelegate<DelegateSignature>& Callback, Func* FunctionPointer,
-	                                TMap<TWeakObjectPtr<>, FDelegateHandle>& Map,
-	                                TWeakObjectPtr<UObject> ObjectToRegisterWeakPtr)
+	void RegisterEventHandlerFromK2(TModioUIReceiverRegistry<TMulticastDelegate<DelegateSignature>>& Callback,
+	                                Func* FunctionPointer, TWeakObjectPtr<UObject> ObjectToRegisterWeakPtr)
 	{
 		if (FunctionPointer == nullptr)
 		{
@@ -439,35 +693,16 @@ public:
 			return;
 		}
 
-		bool bContainsObject = false;
-		// Safety clean up before adding a new one
-		for (auto It = Map.CreateIterator(); It; ++It)
-		{
-			const auto RegisteredObject = It.Key().Get(false);
-			if (!RegisteredObject)
-			{
-				Callback.Remove(It.Value());
-				It.RemoveCurrent();
-			}
-			else if (RegisteredObject == ObjectToRegisterWeakPtr)
-			{
-				bContainsObject = true;
-				break;
-			}
-		}
-
-		// Ensure we don't add duplicates of the same object.
-		if (!bContainsObject)
-		{
-			const FDelegateHandle Handle = Callback.AddStatic(FunctionPointer, ObjectToRegisterWeakPtr);
-			Map.Add(ObjectToRegisterWeakPtr, Handle);
-		}
+		// Blueprint registrations bind a static helper that routes to the native or Blueprint implementation. Each
+		// interface has its own helper, which also serves to key the binding
+		Callback.Add(ObjectToRegisterWeakPtr.Get(),
+		             TDelegate<DelegateSignature>::CreateStatic(FunctionPointer, ObjectToRegisterWeakPtr),
+		             reinterpret_cast<const void*>(FunctionPointer));
 	}
 
 	template<typename DelegateSignature, typename Func>
-	void DeregisterEventHandlerFromK2(TMulticastDelegate<DelegateSignature>& Callback, Func* FunctionPointer,
-	                                  TMap<TWeakObjectPtr<>, FDelegateHandle>& Map,
-	                                  TWeakObjectPtr<UObject> ObjectToDeregisterWeakPtr)
+	void DeregisterEventHandlerFromK2(TModioUIReceiverRegistry<TMulticastDelegate<DelegateSignature>>& Callback,
+	                                  Func* FunctionPointer, TWeakObjectPtr<UObject> ObjectToDeregisterWeakPtr)
 	{
 		if (FunctionPointer == nullptr)
 		{
@@ -475,21 +710,7 @@ public:
 			return;
 		}
 
-		// Collapse delegate list, and remove our object from the delegate
-		for (auto It = Map.CreateIterator(); It; ++It)
-		{
-			const auto RegisteredObject = It.Key().Get(false);
-			if (!RegisteredObject)
-			{
-				Callback.Remove(It.Value());
-				It.RemoveCurrent();
-			}
-			else if (RegisteredObject == ObjectToDeregisterWeakPtr)
-			{
-				Callback.Remove(It.Value());
-				It.RemoveCurrent();
-			}
-		}
+		Callback.Remove(ObjectToDeregisterWeakPtr.Get(), reinterpret_cast<const void*>(FunctionPointer));
 	}
 
 	/**
@@ -522,6 +743,41 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "mod.io|UI|ModioUISubsystem")
 	void RequestUserAvatar();
 
+	/**
+	 * @docpublic
+	 * @brief Provides the currently authenticated user's avatar as a decoded texture shared by every avatar widget. The
+	 * avatar is downloaded and decoded once per user, so the callback runs immediately once it is available, and
+	 * concurrent requests share a single download
+	 *
+	 * @param Callback - Invoked with the texture, or with an error and a null texture if the avatar could not be loaded
+	 */
+	void GetCurrentUserAvatarAsync(FOnUserAvatarTextureReadyFast Callback);
+
+	/**
+	 * @docpublic
+	 * @brief Gets the currently authenticated user's decoded avatar, if it has been loaded
+	 *
+	 * @return The shared avatar texture, or nullptr if it has not been loaded yet
+	 */
+	UFUNCTION(BlueprintPure, Category = "mod.io|UI|ModioUISubsystem")
+	class UTexture2DDynamic* GetCachedUserAvatar() const;
+
+	/**
+	 * @brief Gets the downloaded image the shared avatar texture was decoded from, for image widgets that can only load
+	 * from file
+	 *
+	 * @return The downloaded avatar, or an empty optional if it has not been downloaded yet
+	 */
+	TOptional<FModioImageWrapper> GetCachedUserAvatarImage() const;
+
+	/**
+	 * @docpublic
+	 * @brief Discards the shared avatar, so that the next request downloads it again. Called automatically when the
+	 * user or the data provider changes
+	 */
+	UFUNCTION(BlueprintCallable, Category = "mod.io|UI|ModioUISubsystem")
+	void InvalidateUserAvatar();
+
 	/**
 	 * @docpublic
 	 * @brief Requests the authentication of a provided Authentication Code that has been entered by the user. Calls the callback upon completion.
@@ -572,6 +828,75 @@ public:
 
 	void GetTagOptionsListAsync();
 
+	/**
+	 * @brief Retrieves the mod tag options from the subsystem's shared store. Cached options (including those
+	 * persisted by a previous session) are passed to Callback immediately and revalidated in the background once they
+	 * are older than UModioUISettings::TagOptionsMaxAgeSeconds. Otherwise Callback is invoked once the options have
+	 * been fetched, sharing the fetch with any other request already in flight.
+	 * @param Callback Invoked with the tag options, or with the error if none could be retrieved
+	 */
+	void GetTagOptionsListAsync(FOnGetModTagOptionsDelegateFast Callback);
+
+	/**
+	 * @brief Returns the shared tag object for a tag in the current mod.io language, creating it on first use. Every
+	 * caller asking for the same tag gets the same instance, so browse lists showing thousands of mods only allocate
+	 * and localize each distinct tag once. Intended for read-only tag displays: the instance cannot be selected or
+	 * modified from Blueprint. Use UModioUICommonFunctionLibrary::CreateBindableModTag for tags that track selection
+	 * state.
+	 * @param Tag Raw tag string used in the mod.io API
+	 * @param LocalizedText Localized text to use if the cached tag options have no translation for the tag. A tag first
+	 * requested without it shows its raw string, and is upgraded by the first later request that provides it
+	 * @return The shared tag object
+	 */
+	class UModioModTagUI* GetSharedModTag(const FString& Tag, const FText& LocalizedText = FText());
+
+	/**
+	 * @brief Starts recording the completions this subsystem broadcasts (mod management events, subscription changes,
+	 * mod list results and media downloads) to a JSON Lines file that FModioUIEventReplayer can play back. Replaces any
+	 * recording already in progress.
+	 * @param Path File to write the recording to
+	 * @return Whether the file could be opened
+	 */
+	bool StartEventRecording(const FString& Path);
+
+	/**
+	 * @brief Stops the current event recording, if any, and closes its file
+	 */
+	void StopEventRecording();
+
+	bool IsRecordingEvents() const;
+
+	/**
+	 * @brief Streams the UI preload manifest in the background, so that its assets are already in memory when a screen
+	 * first uses them instead of being loaded synchronously. The manifest is built from UModioUISettings (the colors
+	 * and commands tables, the text input materials, PreloadWidgetClasses and PreloadAssets) plus AdditionalAssets. Once
+	 * a widget class has loaded, the soft references held by its defaults and widget tree are streamed in as well, but
+	 * the assets those reference softly in turn are not. Called at startup when
+	 * UModioUISettings::bPreloadUIAssetsOnStartup is set; call it again before opening a screen to stream in that
+	 * screen's widget classes.
+	 * @param AdditionalAssets Assets to add to the manifest, such as the widget classes of the screen about to open
+	 * @param OnComplete Invoked once every asset requested by this call, and everything they reference softly, is loaded
+	 */
+	void PreloadUIAssets(const TArray<FSoftObjectPath>& AdditionalAssets = TArray<FSoftObjectPath>(),
+	                     FSimpleDelegate OnComplete = FSimpleDelegate());
+
+	/**
+	 * @docpublic
+	 * @brief Streams in the given widget classes, and the assets they reference softly, in the background ahead of
+	 * their first use. See PreloadUIAssets
+	 *
+	 * @param WidgetClasses - Widget classes of the screen or dialog about to open
+	 */
+	UFUNCTION(BlueprintCallable, Category = "mod.io|UI|ModioUISubsystem")
+	void PreloadWidgetClasses(const TArray<TSoftClassPtr<class UUserWidget>>& WidgetClasses);
+
+	/**
+	 * @brief Returns every asset in the preload manifest so far
+	 */
+	TArray<FSoftObjectPath> GetUIPreloadManifest() const;
+
+	bool IsUIPreloadInProgress() const;
+
 	/**
 	 * @docpublic
 	 * @brief Gets the current DPI scale value of the UI based on the viewport size.
@@ -584,7 +909,9 @@ public:
 	/**
 	 * @docpublic
 	 * @brief Requests a list of all Mods for the current game that match the given IDs.
-	 * Executes callbacks in implementations of IModioUIModInfoReceiver
+	 * Executes callbacks in implementations of IModioUIModInfoReceiver.
+	 * Requests made within UModioUISettings::ModInfoBatchWindowSeconds of each other (or within the same frame) are
+	 * merged into shared queries, and IDs that are already being fetched or were fetched recently are not queried again
 	 * 
 	 * @param IDs - Array of ModIds to request information on.
 	 */
@@ -617,6 +944,8 @@ public:
 	 * @docpublic
 	 * @brief Requests The list of mods for the given Mod Collection.
 	 * Executes callbacks in implementations of IModioUIModCollectionInfoReceiver.
+	 * Recently viewed collections are answered immediately from memory, and refetched in the background once older
+	 * than UModioUISettings::CollectionModsMaxAgeSeconds.
 	 *
 	 * @param CollectionID - The ID of the collection to get all the mods for
 	 */
@@ -627,6 +956,7 @@ public:
 	 * @docpublic
 	 * @brief Requests a list of all purchasable Token Packs via the currently active online portal provider
 	 * The result is received by any class implementing the ModioTokenPackReceiver interface via OnListAllTokenPacksRequestCompleted
+	 * Packs listed within UModioUISettings::TokenPackCatalogueMaxAgeSeconds are returned without querying the store again.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "mod.io|UI|ModioUISubsystem")
 	void RequestListAllTokenPacks();
@@ -656,6 +986,8 @@ public:
 	 * @docpublic
 	 * @brief Requests an update of the currently authenticated user's mod.io wallet balance, creating a wallet if one does not already exist.
 	 * Executes callbacks in implementations of IModioUIWalletBalanceUpdatedEventReceiver.
+	 * A balance fetched or updated by a purchase within UModioUISettings::WalletBalanceMaxAgeSeconds is returned
+	 * without another request.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "mod.io|UI|ModioUISubsystem")
 	void RequestWalletBalanceRefresh();
@@ -665,6 +997,7 @@ public:
 	 * @brief Requests an update of the currently authenticated user's mod.io wallet balance, creating a wallet if one
 	 * does not already exist. Also executes the given callback upon completion.
 	 * Executes callbacks in implementations of IModioUIWalletBalanceUpdatedEventReceiver.
+	 * Served from a recent enough cached balance, as for RequestWalletBalanceRefresh.
 	 * 
 	 * @param Callback - The callback to execute upon completion.
 	 */
@@ -705,6 +1038,75 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "mod.io|UI|ModioUISubsystem")
 	void RequestShowDialog(EModioUIDialogType DialogType, UObject* DataSource);
 
+	/**
+	 * @docpublic
+	 * @brief Keeps a constructed dialog as the warm instance for a dialog type. RequestShowDialog and PrepareDialog
+	 * hand their data source to it before the display event is broadcast, so a receiver that reuses it finds its
+	 * content already built
+	 *
+	 * @param DialogType - The type of dialog the widget displays
+	 * @param Dialog - The dialog to reuse, or nullptr to release the current one
+	 */
+	UFUNCTION(BlueprintCallable, Category = "mod.io|UI|ModioUISubsystem")
+	void RegisterWarmDialog(EModioUIDialogType DialogType, class UCommonActivatableWidget* Dialog);
+
+	/**
+	 * @docpublic
+	 * @brief Gets the warm instance registered for a dialog type
+	 *
+	 * @param DialogType - The type of dialog to get
+	 * @return The dialog passed to RegisterWarmDialog, or nullptr if there is none
+	 */
+	UFUNCTION(BlueprintPure, Category = "mod.io|UI|ModioUISubsystem")
+	class UCommonActivatableWidget* GetWarmDialog(EModioUIDialogType DialogType) const;
+
+	/**
+	 * @docpublic
+	 * @brief Speculatively prepares the warm dialog for a dialog type with the given data source, for example that of
+	 * the hovered or focused tile. Applied once the request has stood for UModioUISettings::DialogPreparationDelaySeconds,
+	 * and never while the dialog is active
+	 *
+	 * @param DialogType - The type of dialog likely to be requested next
+	 * @param DataSource - The data it is likely to be requested with
+	 */
+	UFUNCTION(BlueprintCallable, Category = "mod.io|UI|ModioUISubsystem")
+	void PrepareDialog(EModioUIDialogType DialogType, UObject* DataSource);
+
+	/**
+	 * @brief Whether a warm dialog's data source is currently being set by PrepareDialog or RequestShowDialog. Dialogs
+	 * track this through FModioWarmDialogState to tell the subsystem's own calls apart from a caller refreshing
+	 */
+	bool IsSettingWarmDialogDataSource() const
+	{
+		return bSettingWarmDialogDataSource;
+	}
+
+	/**
+	 * @brief Whether the data source being set is a speculative PrepareDialog, so the dialog is not shown yet and
+	 * should defer network-bound work such as media downloads
+	 */
+	bool IsPreparingWarmDialog() const
+	{
+		return bPreparingWarmDialog;
+	}
+
+	/**
+	 * @brief Counts a selector menu whose entries are built but not displayed against
+	 * UModioUISettings::MaxIdleSelectorMenus. Menus idle the longest beyond that budget have their entries released
+	 * through ReleaseContent
+	 *
+	 * @param Owner - The selector owning the menu
+	 * @param ReleaseContent - Destroys the menu's entries, keeping whatever state is needed to rebuild them later
+	 */
+	void RetainIdleSelectorMenu(UObject* Owner, FSimpleDelegate ReleaseContent);
+
+	/**
+	 * @brief Stops counting a selector menu against the idle budget, for example because it has been opened
+	 *
+	 * @param Owner - The selector passed to RetainIdleSelectorMenu
+	 */
+	void ForgetIdleSelectorMenu(UObject* Owner);
+
 	/**
 	 * @docpublic
 	 * @brief Updates the current Connectivity state, and notifies implementations of IMOdioUIConnectivityChangedReceiver *only* if the state changes.
@@ -767,6 +1169,14 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "mod.io|UI|ModioUISubsystem")
 	void RequestRefreshEntitlements();
 
+	/**
+	 * @docpublic
+	 * @brief Discards the cached token pack catalogue and wallet balance, so that the next requests fetch them again.
+	 * Called automatically when entitlements are refreshed and when the user or the data provider changes
+	 */
+	UFUNCTION(BlueprintCallable, Category = "mod.io|UI|ModioUISubsystem")
+	void InvalidateStoreCaches();
+
 	/**
 	 * @docpublic
 	 * @brief Follows the given ModCollection ID for the current user.
@@ -853,12 +1263,42 @@ public:
 
 	/**
 	 * @docpublic
-	 * @brief Checks if the current user is following to the given ModCollectionId, returning the result in a delegate
+	 * @brief Checks if the current user is following the given ModCollectionId, broadcasting the result to
+	 * IModioUICollectionFollowStateChangedReceiver
 	 *
 	 * @param ID - The ModCollectionId of the Mod Collection to check is followed.
 	 */
 	void QueryIsUserFollowingModCollection(FModioModCollectionID ID);
 
+	/**
+	 * @docpublic
+	 * @brief Checks if the current user is following the given ModCollectionId. Answered from the cached set of followed
+	 * collections, so the handler runs immediately once that set has been fetched; before then, every query shares a
+	 * single request
+	 *
+	 * @param ID - The ModCollectionId of the Mod Collection to check is followed.
+	 * @param Handler - The callback to be executed with the result.
+	 */
+	void QueryIsUserFollowingModCollection(FModioModCollectionID ID, FOnQueryFollowedModCollectionCompletedFast Handler);
+
+	/**
+	 * @docpublic
+	 * @brief Synchronously checks if the current user is following the given ModCollectionId
+	 *
+	 * @param ID - The ModCollectionId of the Mod Collection to check is followed.
+	 * @return The follow state, or an unset value if the followed collections have not been fetched yet, in which case
+	 * the fetch is started
+	 */
+	TOptional<bool> GetCachedModCollectionFollowState(FModioModCollectionID ID);
+
+	/**
+	 * @docpublic
+	 * @brief Discards the cached set of followed collections, so that the next query fetches it again. Called
+	 * automatically when the user or the data provider changes
+	 */
+	UFUNCTION(BlueprintCallable, Category = "mod.io|UI|ModioUISubsystem")
+	void InvalidateFollowedModCollections();
+
 	/**
 	 * @docpublic
 	 * @brief Checks if the current user is following to the given ModCollectionId, returning the result in a delegate
@@ -871,6 +1311,74 @@ public:
 	                                                  FOnQueryFollowedModCollectionCompleted Handler);
 
 private:
+	/**
+	 * @brief Records the number of receivers an event is about to broadcast to. Compiles out when stats and CSV
+	 * profiling are disabled
+	 * @param FanOut Number of receivers registered for the event
+	 * @param DelegateName Static name of the event, used as the CSV stat name
+	 */
+	void RecordBroadcastFanOut(int32 FanOut, const char* DelegateName);
+
 	TMap<int64, EModioRating> ModRatingMap;
 	TMap<int64, EModioRating> ModCollectionRatingMap;
+
+	/** A rating change waiting out UModioUISettings::RatingSubmissionSettleSeconds before it is submitted */
+	struct FPendingRatingSubmission
+	{
+		/** The rating to restore locally if the submission fails */
+		EModioRating PreviousRating = EModioRating::Neutral;
+
+		/** The user the rating was made by, so that a late failure does not roll back another user's ratings */
+		FString UserID;
+
+		double SubmitTime = 0.0;
+
+		TArray<FOnErrorOnlyDelegateFast> Callbacks;
+	};
+
+	/** Ratings the server has accepted. Only these are persisted, so an unsent rating is never shown on next launch */
+	TMap<int64, EModioRating> ConfirmedModRatings;
+	TMap<int64, EModioRating> ConfirmedModCollectionRatings;
+	bool bConfirmedRatingsDirty = false;
+
+	TMap<int64, FPendingRatingSubmission> PendingModRatingSubmissions;
+	TMap<int64, FPendingRatingSubmission> PendingModCollectionRatingSubmissions;
+	FTSTicker::FDelegateHandle RatingSubmissionTickHandle;
+
+	/** ID of the user whose ratings are in ModRatingMap and ModCollectionRatingMap, empty if nobody is logged in */
+	FString RatingsUserID;
+
+	/**
+	 * @brief Applies NewRating locally and (re)starts its settle window. Only the rating held when the window closes is
+	 * submitted, and every callback queued for that ID receives its result
+	 */
+	void QueueRatingSubmission(bool bModCollection, int64 ID, EModioRating NewRating,
+	                           FOnErrorOnlyDelegateFast DedicatedCallback);
+	void StartRatingSubmissionTicker();
+	bool TickRatingSubmissions(float DeltaTime);
+
+	/**
+	 * @brief Submits the pending ratings whose settle window has closed, or all of them if bFlushAll is set
+	 */
+	void FlushRatingSubmissions(bool bFlushAll);
+	void OnPendingRatingSubmitted(FModioErrorCode ErrorCode, bool bModCollection, int64 ID, EModioRating Rating,
+	                              FPendingRatingSubmission Submission);
+
+	void SetLocalRating(bool bModCollection, int64 ID, EModioRating NewRating);
+
+	/**
+	 * @brief Records a rating the server has accepted, to be persisted on the next tick of the rating ticker
+	 */
+	void SetConfirmedRating(bool bModCollection, int64 ID, EModioRating Rating);
+
+	/**
+	 * @brief Loads the current user's persisted ratings if none are loaded yet and the SDK has a user
+	 */
+	void ResolveRatingsUser();
+
+	/**
+	 * @brief Swaps the rating maps over to the given user's persisted ratings, or clears them if UserID is empty
+	 */
+	void LoadPersistedRatings(const FString& UserID);
+	void PersistRatings();
 };
\ No newline at end of file
@@ -67,38 +67,67 @@ struct FModioTScriptInterfaceValidator
 	}
 };
 
+/**
+ * @brief A BindWidget property of a widget class whose bound widget must implement the interfaces named by the
+ * property's MustImplement metadata
+ */
+struct FModioBoundWidgetContract
+{
+	FName PropertyName;
+
+	/**
+	 * @brief Interface classes named by MustImplement, in the same order as RequiredInterfaceNames. Entries are null
+	 * where a name did not resolve to a class
+	 */
+	TArray<UClass*> RequiredInterfaces;
+
+	TArray<FString> RequiredInterfaceNames;
+};
+
+namespace ModioUI
+{
+	/**
+	 * @brief Resolves a class by name, as UClass::TryFindTypeSlow does, caching successful lookups. Must be called on
+	 * the game thread, as a cache miss searches every loaded object
+	 */
+	MODIOUICORE_API UClass* FindInterfaceClass(const FString& ClassName);
+
+	/**
+	 * @brief Returns the bound widget contracts declared by WidgetClass. Only native properties can carry BindWidget
+	 * metadata, so contracts are computed once per native class and shared by every Blueprint deriving from it. Must be
+	 * called on the game thread, as resolving the required interfaces may search for classes by name
+	 */
+	MODIOUICORE_API TArray<FModioBoundWidgetContract> GetBoundWidgetContracts(const UClass* WidgetClass);
+
+	/**
+	 * @brief Checks that every widget in WidgetTree bound to a contract of WidgetClass implements the required
+	 * interfaces
+	 * @param OutErrors Receives a message for each missing interface
+	 * @return True if no contract was violated
+	 */
+	MODIOUICORE_API bool ValidateBoundWidgets(const UClass* WidgetClass, const UWidgetTree& WidgetTree,
+											  TArray<FText>& OutErrors);
+
+	/**
+	 * @brief Checks WidgetTree against contracts already returned by GetBoundWidgetContracts. Only reads the contracts
+	 * and the widget tree, so may run on any thread
+	 * @param OutErrors Receives a message for each missing interface
+	 * @return True if no contract was violated
+	 */
+	MODIOUICORE_API bool ValidateBoundWidgets(TArrayView<const FModioBoundWidgetContract> Contracts,
+											  const UWidgetTree& WidgetTree, TArray<FText>& OutErrors);
+} // namespace ModioUI
+
 	#define IMPLEMENT_MODIO_WIDGET_VALIDATION()                                                                       \
 		void ValidateCompiledWidgetTree(const UWidgetTree& BlueprintWidgetTree, class IWidgetCompilerLog& CompileLog) \
 			const override                                                                                            \
 		{                                                                                                             \
 			Super::ValidateCompiledWidgetTree(BlueprintWidgetTree, CompileLog);                                       \
-			for (TFieldIterator<FProperty> PropIterator(GetClass()); PropIterator; ++PropIterator)                    \
+			TArray<FText> BoundWidgetErrors;                                                                          \
+			ModioUI::ValidateBoundWidgets(GetClass(), BlueprintWidgetTree, BoundWidgetErrors);                        \
+			for (const FText& BoundWidgetError : BoundWidgetErrors)                                                   \
 			{                                                                                                         \
-				FObjectProperty* ObjectProperty = CastField<FObjectProperty>(*PropIterator);                          \
-				if (ObjectProperty && ObjectProperty->PropertyClass &&                                                \
-					ObjectProperty->PropertyClass->IsChildOf<UWidget>())                                              \
-				{                                                                                                     \
-					if ((ObjectProperty->HasMetaData("BindWidget") ||                                                 \
-						 ObjectProperty->HasMetaData("BindWidgetOptional")) &&                                        \
-						ObjectProperty->HasMetaData("MustImplement"))                                                 \
-					{                                                                                                 \
-						UWidget* Widget = BlueprintWidgetTree.FindWidget(ObjectProperty->GetFName());                 \
-						const FString& RequiredInterfaceString = ObjectProperty->GetMetaData("MustImplement");        \
-						TArray<FString> ClassNames;                                                                   \
-						RequiredInterfaceString.ParseIntoArrayWS(ClassNames, TEXT(","));                              \
-						for (const FString& CurrentClassName : ClassNames)                                            \
-						{                                                                                             \
-							if (Widget && !Widget->GetClass()->ImplementsInterface(                                   \
-											  UClass::TryFindTypeSlow<UClass>(*CurrentClassName)))                    \
-							{                                                                                         \
-								CompileLog.Error(FText::Format(                                                       \
-									FTextFormat(FText::FromString("{0} does not implement required interface {1}")),  \
-									FText::FromName(ObjectProperty->GetFName()),                                      \
-									FText::FromString(CurrentClassName)));                                            \
-							}                                                                                         \
-						}                                                                                             \
-					}                                                                                                 \
-				}                                                                                                     \
+				CompileLog.Error(BoundWidgetError);                                                                   \
 			}                                                                                                         \
 		}
 
@@ -169,6 +198,83 @@ namespace ModioUI
 			   AdditionalText.IsSet() ? **AdditionalText : TEXT(""));
 	}
 
+	/**
+	 * @brief Finds the first menu anchor in WidgetTree that implements IModioToggleableWidget, so that a selector can
+	 * tell whether its menu is open without a dedicated widget getter
+	 * @return The menu anchor, or nullptr if there is none
+	 */
+	MODIOUICORE_API class UWidget* FindMenuAnchorWidget(const class UWidgetTree* WidgetTree);
+
+	/**
+	 * @brief Tracks whether a selector component's menu holds its content, so that the menu is only built when it is
+	 * opened or about to be, and emptied again once it has sat closed while other menus were used
+	 * (see UModioUISettings::MaxIdleSelectorMenus). The selector supplies how to fill and empty its menu; this keeps
+	 * the open state and the idle budget in step with it
+	 */
+	class MODIOUICORE_API FSelectorMenuState
+	{
+	public:
+		/** Gives the menu the selector's content, returning whether the menu now holds any */
+		using FFillMenu = TFunction<bool()>;
+
+		/** Empties the menu, keeping whatever the selector needs to fill it again later */
+		using FEmptyMenu = TFunction<void()>;
+
+		/**
+		 * @brief Binds the state to its selector. Called from the selector's NativePreConstruct; calls made before then
+		 * are deferred until it is bound
+		 * @param InOwner The selector, counted against the idle budget while its menu is filled but closed
+		 * @param MenuAnchor The widget that opens and closes the menu, if any
+		 * @param MenuToggle The widget clicked to open the menu, used for the open state if it is toggleable itself
+		 */
+		void Initialize(UObject& InOwner, UObject* MenuAnchor, UObject* MenuToggle, FFillMenu InFillMenu,
+						FEmptyMenu InEmptyMenu);
+
+		/**
+		 * @brief Gets the widget reporting whether the menu is open: the menu anchor, or else the menu toggle if it is
+		 * toggleable itself. Without one the open state is unknown, so the menu is never emptied
+		 */
+		UObject* GetOpenStateSource() const;
+
+		/** Whether the menu is known to be closed, so that its content may be released */
+		bool IsKnownClosed() const;
+
+		/** Whether the menu currently holds the selector's content */
+		bool IsPopulated() const
+		{
+			return bPopulated;
+		}
+
+		/**
+		 * @brief Called when the selector's content is replaced. Content is only dropped from a menu known to be
+		 * closed, which is refilled when next opened. An open menu, or one whose state cannot be told, shows the new
+		 * content straight away
+		 */
+		void ContentChanged();
+
+		/**
+		 * @brief Fills the menu if it is not filled already. Called when the menu is opened, or is about to be because
+		 * the selector was hovered or focused
+		 */
+		void Populate();
+
+		/** Empties the menu if it is filled and known to be closed */
+		void Release();
+
+		/** Keeps the idle budget up to date as the menu opens and closes */
+		void OpenStateChanged(bool bIsOpen);
+
+	private:
+		TWeakObjectPtr<UObject> Owner;
+		TWeakObjectPtr<UObject> OpenStateSource;
+		FFillMenu FillMenu;
+		FEmptyMenu EmptyMenu;
+		bool bPopulated = false;
+
+		void RetainWhileIdle();
+		void ForgetIdle();
+	};
+
 } // namespace ModioUI
 
 #if WITH_EDITOR
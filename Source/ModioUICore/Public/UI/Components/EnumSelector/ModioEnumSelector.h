@@ -12,6 +12,7 @@
 
 #include "CoreMinimal.h"
 #include "UI/Components/ModioUIComponentBase.h"
+#include "UI/Interfaces/IModioToggleableWidget.h"
 #include "UI/Interfaces/IModioUIClickableWidget.h"
 #include "UI/Interfaces/IModioUIObjectSelector.h"
 
@@ -60,6 +61,46 @@ protected:
 			  meta = (BlueprintProtected))
 	TScriptInterface<IModioUIClickableWidget> GetMenuToggleClickableWidget() const;
 
+	/**
+	 * @brief Provides a reference to the internal widget that opens and closes the menu. Defaults to the first menu
+	 * anchor in this widget that implements IModioToggleableWidget, such as UModioDropdownAnchor. Once the menu is
+	 * known to be closed, its entries are released when other menus have been used since
+	 * (see UModioUISettings::MaxIdleSelectorMenus)
+	 * @default_component_widget_getter
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintNativeEvent, Category = "mod.io|UI|Enum Selector|Widget Getters",
+			  meta = (BlueprintProtected))
+	TScriptInterface<IModioToggleableWidget> GetMenuAnchorWidget() const;
+
+	/**
+	 * @brief Selected values while the menu has not been populated. The menu is given CachedValues and this selection
+	 * the first time it is opened, or is about to be because the selector was hovered or focused
+	 */
+	UPROPERTY(Transient, meta = (BlueprintProtected))
+	TArray<TObjectPtr<UObject>> PendingSelection;
+
+	/** Tracks whether the menu has been given CachedValues and builds entry widgets for them */
+	ModioUI::FSelectorMenuState MenuState;
+
+	/** The menu anchor found in this widget's tree, returned by the default GetMenuAnchorWidget */
+	TWeakObjectPtr<UWidget> DefaultMenuAnchor;
+
+	/**
+	 * @brief Gives the menu CachedValues and the pending selection
+	 */
+	bool FillMenu();
+
+	/**
+	 * @brief Empties the menu, moving its selection into PendingSelection so it can be rebuilt later
+	 */
+	void EmptyMenu();
+
+	UFUNCTION()
+	void OnMenuToggleClicked(UObject* ClickContext);
+
+	UFUNCTION()
+	void OnMenuToggleStateChanged(UObject* Context, bool bIsOpen);
+
 	virtual void SetValues_Implementation(const TArray<UObject*>& InValues) override;
 
 	virtual UObject* GetSingleSelectedValue_Implementation() override;
@@ -81,6 +122,8 @@ protected:
 	void NotifySelectionChanged(UObject* SelectedObject);
 
 	virtual void NativePreConstruct() override;
+	virtual void NativeOnAddedToFocusPath(const FFocusEvent& InFocusEvent) override;
+	virtual void NativeOnMouseEnter(const FGeometry& InGeometry, const FPointerEvent& InMouseEvent) override;
 
 	virtual void SetSelectedStateForIndex_Implementation(int32 Index, bool bNewSelectionState,
 	                                                     bool bEmitSelectionEvent) override;
@@ -43,6 +43,7 @@ protected:
 	virtual void NativeSetDesiredBrushSize(FVector2D DesiredSize) override;
 	virtual void ImageLoadCompletedHandler(class UTexture2DDynamic* LoadedImage);
 	virtual void NativeSetBrush(const FSlateBrush& NewBrush) override;
+	virtual void NativeSetTexture(UTexture2DDynamic* Texture, FModioImageWrapper SourceImage) override;
 	//~ End IModioUIImageDisplayWidget Interface
 
 	//~ Begin IModioUIHasTooltipWidget Interface
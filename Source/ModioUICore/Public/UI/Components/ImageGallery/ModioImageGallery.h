@@ -52,6 +52,28 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io|UI|Image Gallery", meta = (BlueprintProtected))
 	bool bUseLogoOnly;
 
+	/**
+	 * Whether the 320px thumbnail of the selected image is shown while its full resolution version downloads
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "mod.io|UI|Image Gallery|Loading", meta = (BlueprintProtected))
+	bool bShowThumbnailWhileLoading = true;
+
+	/**
+	 * Number of images either side of the selected one to download in the background, so that paging to them does not
+	 * start cold. Zero disables prefetching
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "mod.io|UI|Image Gallery|Loading",
+			  meta = (BlueprintProtected, ClampMin = "0"))
+	int32 PrefetchRadius = 1;
+
+	/**
+	 * Maximum number of background downloads in flight at once. Prefetched images are downloaded to the media cache
+	 * only, never decoded, so memory use is bounded by the images actually on screen
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "mod.io|UI|Image Gallery|Loading",
+			  meta = (BlueprintProtected, ClampMin = "1"))
+	int32 MaxConcurrentPrefetches = 2;
+
 	/**
 	 * Refreshes the image gallery with the current mod info (reloads images)
 	 */
@@ -90,6 +112,63 @@ protected:
 			  meta = (BlueprintProtected))
 	TScriptInterface<IModioUIClickableWidget> GetIncrementSelectionButtonWidget() const;
 
+	/**
+	 * Shows the thumbnail of the newly selected image and refocuses prefetching around it
+	 */
+	UFUNCTION()
+	void HandleImageSelectionChanged(UObject* SelectedValue);
+
+	/**
+	 * Returns the index of the image that should currently be displayed
+	 */
+	int32 GetDisplayedImageIndex() const;
+
+	/**
+	 * Requests the thumbnail of the displayed image directly from the data provider, so that it does not reach other
+	 * receivers of gallery downloads
+	 */
+	void RequestDisplayedImageThumbnail();
+
+	void OnThumbnailReceived(FModioErrorCode ErrorCode, TOptional<FModioImageWrapper> Image, int32 Generation,
+							 int32 ImageIndex);
+
+	void DisplayImage(const FModioImageWrapper& Image, bool bFullResolution);
+
+	/**
+	 * Rebuilds the prefetch queue around the displayed image, dropping queued downloads that are now out of range
+	 */
+	void UpdatePrefetchQueue();
+
+	void IssuePrefetches();
+
+	void OnPrefetchCompleted(FModioErrorCode ErrorCode, TOptional<FModioImageWrapper> Image, int32 Generation,
+							 int32 ImageIndex, EModioGallerySize ImageSize);
+
+	struct FPrefetchRequest
+	{
+		int32 ImageIndex = INDEX_NONE;
+		EModioGallerySize ImageSize = EModioGallerySize::Thumb1280;
+
+		bool operator==(const FPrefetchRequest& Other) const
+		{
+			return ImageIndex == Other.ImageIndex && ImageSize == Other.ImageSize;
+		}
+	};
+
+	/** Downloads waiting for a free slot, nearest to the displayed image first */
+	TArray<FPrefetchRequest> QueuedPrefetches;
+
+	/** Downloads issued or finished for the bound mod, which do not need to be requested again */
+	TArray<FPrefetchRequest> IssuedPrefetches;
+
+	int32 NumPrefetchesInFlight = 0;
+
+	/** Incremented whenever the bound mod changes, so that responses for the previous mod are ignored */
+	int32 LoadGeneration = 0;
+
+	/** Whether the full resolution version of the displayed image has been shown, after which thumbnails are ignored */
+	bool bShowingFullResolution = false;
+
 	//~ Begin IModioUIDataSourceWidget Interface
 	virtual void NativeSetDataSource(UObject* InDataSource) override;
 	//~ End IModioUIDataSourceWidget Interface
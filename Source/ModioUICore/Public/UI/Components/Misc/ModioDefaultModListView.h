@@ -12,6 +12,7 @@
 
 #include "Components/ListView.h"
 #include "CoreMinimal.h"
+#include "Core/ModioModListItemIndex.h"
 #include "Core/ModioStackedBool.h"
 #include "UI/Components/ComponentHelpers.h"
 #include "UI/Interfaces/IModioUIModListViewInterface.h"
@@ -105,6 +106,18 @@ protected:
 	TWeakObjectPtr<UObject> PreviouslySelectedWidget;
 	
 	int32 LastSelectedIndex = INDEX_NONE;
+
+	/** Constant time lookup of item positions and mod IDs, kept in step with the list items */
+	mutable FModioModListItemIndex ListItemIndex;
+
+	/** Set while this view replaces or appends its own items and updates ListItemIndex itself */
+	bool bUpdatingListItems = false;
+
+	//~ Begin UListView Interface
+	virtual void OnItemsChanged(const TArray<UObject*>& AddedItems, const TArray<UObject*>& RemovedItems) override;
+	//~ End UListView Interface
+
+	int32 FindIndexForItem(const UObject* Item) const;
 	
 	MODIO_WIDGET_PALETTE_OVERRIDE();
 };
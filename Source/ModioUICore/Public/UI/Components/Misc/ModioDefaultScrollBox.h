@@ -11,8 +11,8 @@
 #pragma once
 
 #include "Components/ScrollBox.h"
-#include "Containers/Ticker.h"
 #include "CoreMinimal.h"
+#include "Types/WidgetActiveTimerDelegate.h"
 #include "UI/Components/ComponentHelpers.h"
 
 #include "ModioDefaultScrollBox.generated.h"
@@ -84,8 +84,17 @@ protected:
 	TObjectPtr<UWidgetNavigation> UserDefinedNavigation;
 
 protected:
-	/** Handle to the navigation data tick */
-	FTSTicker::FDelegateHandle NavigationDataTickHandle;
+	/**
+	 * Active timer on the Slate scroll box that watches for changes to the scrollable extent, which SScrollBox only
+	 * settles during layout and does not report. Only runs while the scroll box is visible
+	 */
+	EActiveTimerReturnType WatchScrollExtent(double InCurrentTime, float InDeltaTime);
+
+	/** Scroll extent seen by the last WatchScrollExtent, negative until the first check */
+	float LastScrollOffsetOfEnd = -1.0f;
+
+	/** Boundary state the navigation rules were last built for, INDEX_NONE if they need building */
+	int32 AppliedNavigationState = INDEX_NONE;
 
 	MODIO_WIDGET_PALETTE_OVERRIDE();
 };
\ No newline at end of file
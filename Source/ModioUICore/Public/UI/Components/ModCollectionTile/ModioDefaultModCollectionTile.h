@@ -82,6 +82,11 @@ protected:
 
 	virtual void NativeOnItemSelectionChanged(bool bIsSelected) override;
 
+	/**
+	 * @brief Asks the UI subsystem to prepare the warm details dialog with this tile's collection, as it is likely to be opened next
+	 */
+	void PrepareDetailsDialog();
+
 	virtual void AddSelectedStateChangedHandler_Implementation(
 		const FModioSelectableOnSelectionChanged& Handler) override;
 
@@ -13,6 +13,7 @@
 #include "Core/ModioTagOptionsUI.h"
 #include "CoreMinimal.h"
 #include "UI/Components/ModioUIComponentBase.h"
+#include "UI/Interfaces/IModioToggleableWidget.h"
 #include "UI/Interfaces/IModioUIClickableWidget.h"
 #include "UI/Interfaces/IModioUIModTagSelector.h"
 
@@ -51,11 +52,63 @@ protected:
 	UFUNCTION(BlueprintCallable, BlueprintNativeEvent, Category = "mod.io|UI|Widget Getters", meta = (BlueprintProtected))
 	TScriptInterface<UModioUIClickableWidget> GetMenuToggleClickableWidget() const;
 
-	
+	/**
+	 * @brief Provides a reference to the internal widget that opens and closes the selector menu. Defaults to the
+	 * first menu anchor in this widget that implements IModioToggleableWidget, such as UModioDropdownAnchor. Once the
+	 * menu is known to be closed, its categories are released when other menus have been used since
+	 * (see UModioUISettings::MaxIdleSelectorMenus)
+	 * @return The widget that opens and closes the selector menu
+	 * @default_component_widget_getter
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintNativeEvent, Category = "mod.io|UI|Widget Getters", meta = (BlueprintProtected))
+	TScriptInterface<UModioToggleableWidget> GetMenuAnchorWidget() const;
+
+	/**
+	 * @default_component_event FModioOnTagSelectionChanged
+	 */
+	UPROPERTY()
+	FModioOnTagSelectionChangedMulticast OnTagSelectionChanged;
+
+	/**
+	 * Tracks whether the menu has been given CachedTagOptions and builds category widgets for them. Selection lives on
+	 * the tag options themselves, so nothing is lost while the menu is empty
+	 */
+	ModioUI::FSelectorMenuState MenuState;
+
+	/** The menu anchor found in this widget's tree, returned by the default GetMenuAnchorWidget */
+	TWeakObjectPtr<UWidget> DefaultMenuAnchor;
+
+	/**
+	 * @brief Gives the menu CachedTagOptions, if there are any
+	 */
+	bool FillMenu();
+
+	/**
+	 * @brief Empties the menu, destroying its category widgets until it is next filled
+	 */
+	void EmptyMenu();
+
+	UFUNCTION()
+	void InternalTagSelectionChangedHandler();
+
+	UFUNCTION()
+	void OnMenuToggleClicked(UObject* ClickContext);
+
+	UFUNCTION()
+	void OnMenuToggleStateChanged(UObject* Context, bool bIsOpen);
+
+	//~ Begin UUserWidget Interface
+	virtual void NativePreConstruct() override;
+	virtual void NativeOnAddedToFocusPath(const FFocusEvent& InFocusEvent) override;
+	virtual void NativeOnMouseEnter(const FGeometry& InGeometry, const FPointerEvent& InMouseEvent) override;
+	//~ End UUserWidget Interface
+
 	//~ Begin IModioUIModTagSelector Interface
 	virtual void SetAvailableTagsFromModTagOptions_Implementation(const FModioModTagOptions& InOptions) override;
 	virtual void SetAvailableTagsFromBoundModTagOptions_Implementation(const TScriptInterface<UModioModTagOptionsUIDetails>& InOptions) override;
 	virtual TArray<FString> GetSelectedTags_Implementation() override;
+	virtual int32 NativeGetNumSelectedTags() override;
+	virtual UModioModTagOptionsUI* NativeGetTagOptionsObject() override;
 	virtual void ClearSelectedTags_Implementation() override;
 	virtual void AddTagSelectionChangedHandler_Implementation(const FModioOnTagSelectionChanged& Handler) override;
 	virtual void RemoveTagSelectionChangedHandler_Implementation(const FModioOnTagSelectionChanged& Handler) override;
@@ -17,7 +17,9 @@
 
 #include "ModioModTagSelectorMenu.generated.h"
 
+class UModioModTagOptionsUI;
 class UModioModTagOptionsUIDetails;
+class UModioModTagUI;
 
 /**
  * @default_impl_for Mod Tag Selector Menu
@@ -35,6 +37,14 @@ protected:
 	UPROPERTY(EditDefaultsOnly, Category = "mod.io|UI|TagSelectorMenu")
 	bool bShowLockedTags = true;
 
+	/**
+	 * @brief If true, the menu populates itself from the UI subsystem's shared tag options store when initialized,
+	 * rather than waiting for SetAvailableTagsFromModTagOptions to be called. A menu nested inside another tag
+	 * selector is always left for that selector to populate
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "mod.io|UI|TagSelectorMenu")
+	bool bPopulateFromSharedTagOptions = true;
+
 	/**
 	 * @default_component_event FModioOnTagSelectionChanged
 	 */
@@ -58,6 +68,13 @@ protected:
 	UFUNCTION(BlueprintCallable, Category = "mod.io|UI|Events|Tag Selector", meta = (BlueprintProtected))
 	void NotifySelectionChanged();
 
+	/**
+	 * @brief Deselects the entry widgets displaying Tags without regenerating the categories
+	 * @return False if an entry could not be located, in which case the caller should redraw the categories instead
+	 */
+	bool DeselectTagEntries(UWidget& CategoryContainerWidget, UModioModTagOptionsUI& Options,
+							const TArray<UModioModTagUI*>& Tags);
+
 	/**
 	 * @brief Called when a category widget is created. Adds selection change handlers to the category widget
 	 */
@@ -81,6 +98,8 @@ protected:
 	virtual void SetAvailableTagsFromModTagOptions_Implementation(const FModioModTagOptions& InOptions) override;
 	virtual void SetAvailableTagsFromBoundModTagOptions_Implementation(const TScriptInterface<UModioModTagOptionsUIDetails>& InOptions) override;
 	virtual TArray<FString> GetSelectedTags_Implementation() override;
+	virtual int32 NativeGetNumSelectedTags() override;
+	virtual UModioModTagOptionsUI* NativeGetTagOptionsObject() override;
 	virtual void ClearSelectedTags_Implementation() override;
 	virtual void AddTagSelectionChangedHandler_Implementation(const FModioOnTagSelectionChanged& Handler) override;
 	virtual void RemoveTagSelectionChangedHandler_Implementation(const FModioOnTagSelectionChanged& Handler) override;
@@ -89,7 +108,10 @@ protected:
 	virtual bool GetAllowLockedTags_Implementation() override;
 	//~ End IModioUIModTagSelector Interface
 
+	void OnSharedTagOptionsReceived(FModioErrorCode ErrorCode, TOptional<FModioModTagOptions> Options);
+
 	//~ Begin UUserWidget Interface
+	virtual void NativeOnInitialized() override;
 	virtual void NativePreConstruct() override;
 	//~ End UUserWidget Interface
 };
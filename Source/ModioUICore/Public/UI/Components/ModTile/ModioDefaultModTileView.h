@@ -12,8 +12,11 @@
 
 #include "Components/TileView.h"
 #include "CoreMinimal.h"
+#include "Core/ModioModListItemIndex.h"
 #include "Core/ModioStackedBool.h"
 #include "UI/Components/ComponentHelpers.h"
+#include "UI/Components/Slate/ModioEntryBindingScheduler.h"
+#include "UI/Interfaces/IModioEntryBindingSchedulerOwner.h"
 #include "UI/Interfaces/IModioUIModListViewInterface.h"
 #include "UI/Interfaces/IModioUIObjectListWidget.h"
 #include "UI/Interfaces/IModioUIObjectSelector.h"
@@ -31,12 +34,28 @@ class MODIOUICORE_API UModioDefaultModTileView : public UTileView,
                                                  public IModioUIModListViewInterface,
                                                  public IModioUIObjectListWidget,
                                                  public IModioUIObjectSelector,
-                                                 public IModioScrollableWidget
+                                                 public IModioScrollableWidget,
+                                                 public IModioEntryBindingSchedulerOwner
 {
 	GENERATED_BODY()
 
 protected:
+	/** Time in milliseconds that binding entries to their mods may take each frame. Entries beyond the budget are
+	 * bound on later frames, focused and centered entries first. Set to 0 to bind every entry immediately */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "mod.io|UI|Mod Tile View",
+			  meta = (ClampMin = 0.0, UIMax = 16.0, BlueprintProtected))
+	float EntryBindingBudgetMilliseconds = 4.0f;
+
+	/** Defers entry initialization across frames within EntryBindingBudgetMilliseconds */
+	TSharedPtr<FModioEntryBindingScheduler> EntryBindingScheduler;
+
+	//~ Begin IModioEntryBindingSchedulerOwner Interface
+	virtual TSharedPtr<FModioEntryBindingScheduler> GetEntryBindingScheduler() const override;
+	//~ End IModioEntryBindingSchedulerOwner Interface
+
 	//~ Begin UWidget Interface
+	virtual void SynchronizeProperties() override;
+	virtual void ReleaseSlateResources(bool bReleaseChildren) override;
 #if WITH_EDITOR
 	virtual void ValidateCompiledDefaults(IWidgetCompilerLog& CompileLog) const override;
 #endif
@@ -108,5 +127,17 @@ protected:
 
 	int32 LastSelectedIndex = INDEX_NONE;
 
+	/** Constant time lookup of item positions and mod IDs, kept in step with the list items */
+	mutable FModioModListItemIndex ListItemIndex;
+
+	/** Set while this view replaces or appends its own items and updates ListItemIndex itself */
+	bool bUpdatingListItems = false;
+
+	//~ Begin UListView Interface
+	virtual void OnItemsChanged(const TArray<UObject*>& AddedItems, const TArray<UObject*>& RemovedItems) override;
+	//~ End UListView Interface
+
+	int32 FindIndexForItem(const UObject* Item) const;
+
 	MODIO_WIDGET_PALETTE_OVERRIDE();
 };
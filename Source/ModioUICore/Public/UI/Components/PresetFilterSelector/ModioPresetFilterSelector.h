@@ -77,4 +77,7 @@ protected:
 	 */
 	UPROPERTY(meta = (BlueprintProtected))
 	TArray<TObjectPtr<UObject>> CachedBoundPresets;
+
+	/** Whether the preset list has been given the presets, so that rebuilding this widget does not regenerate them */
+	bool bPresetsApplied = false;
 };
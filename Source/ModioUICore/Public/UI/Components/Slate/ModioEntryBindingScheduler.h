@@ -0,0 +1,92 @@
+/*
+ *  Copyright (C) 2025 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io UE Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "Components/SlateWrapperTypes.h"
+#include "Containers/Ticker.h"
+#include "CoreMinimal.h"
+#include "Templates/SharedPointer.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class UListViewBase;
+class UUserWidget;
+
+/**
+ * @brief Spreads the initialization of list entries across frames so that regenerating a view full of entries does not
+ * bind every entry in a single frame. Entries are bound in priority order within a per-frame time budget: focused or
+ * selected entries first, then the entries closest to the center of the owning list view. Entries waiting to be bound
+ * are hidden, keeping their place in the layout, so that recycled entries never show the item they were bound to
+ * before.
+ *
+ * A list view opts in by owning a scheduler and implementing IModioEntryBindingSchedulerOwner;
+ * SModioDataSourceAwareTableRow defers its initialization when its owning view returns an enabled scheduler.
+ */
+class MODIOUICORE_API FModioEntryBindingScheduler : public TSharedFromThis<FModioEntryBindingScheduler>
+{
+public:
+	explicit FModioEntryBindingScheduler(UListViewBase& InOwningListView);
+	~FModioEntryBindingScheduler();
+
+	/**
+	 * @brief Returns the scheduler owned by the given list view, if it has one
+	 */
+	static TSharedPtr<FModioEntryBindingScheduler> FindForListView(const UListViewBase* ListView);
+
+	/**
+	 * @brief Sets the time each frame may spend binding entries. Zero disables deferral
+	 */
+	void SetFrameBudget(float InBudgetMilliseconds);
+
+	bool IsEnabled() const;
+
+	/**
+	 * @brief Queues Bind to run for EntryWidget on a later frame, replacing any binding already queued for it
+	 */
+	void Enqueue(UUserWidget& EntryWidget, TFunction<void()> Bind);
+
+	/**
+	 * @brief Drops any binding queued for EntryWidget, for example when its row is released back to the pool
+	 */
+	void Cancel(UUserWidget& EntryWidget);
+
+	/**
+	 * @brief Immediately runs every queued binding regardless of the frame budget
+	 */
+	void Flush();
+
+protected:
+	struct FPendingBinding
+	{
+		TWeakObjectPtr<UUserWidget> EntryWidget;
+		TFunction<void()> Bind;
+		ESlateVisibility OriginalVisibility = ESlateVisibility::SelfHitTestInvisible;
+	};
+
+	bool Tick(float DeltaTime);
+
+	void RunBinding(FPendingBinding& Binding);
+
+	/**
+	 * @brief Shows the entry again, as it was before it was queued
+	 */
+	static void RestoreEntry(const FPendingBinding& Binding);
+
+	float GetBindingPriority(UUserWidget& EntryWidget, const FVector2D& ListCenter) const;
+
+	TWeakObjectPtr<UListViewBase> OwningListView;
+
+	/** Bindings waiting to run, keyed by entry widget so that requeueing an entry replaces its binding */
+	TMap<TObjectKey<UUserWidget>, FPendingBinding> PendingBindings;
+
+	FTSTicker::FDelegateHandle TickHandle;
+	double BudgetSeconds = 0.0;
+};
@@ -12,6 +12,7 @@
 
 #include "CoreMinimal.h"
 #include "Slate/SObjectTableRow.h"
+#include "UI/Components/Slate/ModioEntryBindingScheduler.h"
 #include "UI/Interfaces/IModioUIDataSourceWidget.h"
 #include "UObject/ObjectPtr.h"
 #include "Misc/EngineVersionComparison.h"
@@ -19,6 +20,8 @@
 /**
  * Table row that automatically binds data to widgets implementing IModioUIDataSourceWidget.
  * Detects if entry widget implements the data source interface and sets the data source during initialization.
+ * If the owning list view provides an FModioEntryBindingScheduler through IModioEntryBindingSchedulerOwner,
+ * initialization is deferred to it.
  */
 template <typename ItemType>
 class SModioDataSourceAwareTableRow : public SObjectTableRow<ItemType>
@@ -33,6 +36,40 @@ protected:
 
 	//~ Begin SObjectTableRow Interface
 	virtual void InitializeObjectRow() override
+	{
+		TSharedPtr<FModioEntryBindingScheduler> Scheduler =
+			FModioEntryBindingScheduler::FindForListView(this->GetOwningListView());
+		if (Scheduler && Scheduler->IsEnabled() && this->WidgetObject)
+		{
+			// The item is looked up again when the binding runs, so a row recycled in the meantime binds its new item
+			Scheduler->Enqueue(*this->WidgetObject,
+			                   [WeakRow = TWeakPtr<SWidget>(this->AsShared()), this]() {
+				                   if (WeakRow.IsValid())
+				                   {
+					                   BindObjectRow();
+				                   }
+			                   });
+			return;
+		}
+		BindObjectRow();
+	}
+
+	virtual void ResetObjectRow() override
+	{
+		// Cancelling also restores the entry hidden while it waited, so the next item starts from a visible row
+		if (TSharedPtr<FModioEntryBindingScheduler> Scheduler =
+				FModioEntryBindingScheduler::FindForListView(this->GetOwningListView()))
+		{
+			if (this->WidgetObject)
+			{
+				Scheduler->Cancel(*this->WidgetObject);
+			}
+		}
+		SObjectTableRow<ItemType>::ResetObjectRow();
+	}
+	//~ End SObjectTableRow Interface
+
+	void BindObjectRow()
 	{
 #if UE_VERSION_OLDER_THAN(5, 4, 0)
 		TSharedRef<ITypedTableView<ItemType>> OwnerTable = this->OwnerTablePtr.Pin().ToSharedRef();
@@ -54,5 +91,4 @@ protected:
 
 		SObjectTableRow<ItemType>::InitializeObjectRow();
 	}
-	//~ End SObjectTableRow Interface
 };
\ No newline at end of file
@@ -25,9 +25,11 @@
 
 enum class EVirtualKeyboardTrigger : uint8;
 enum class EVirtualKeyboardDismissAction : uint8;
+class SBorder;
+class SEditableText;
+class SImage;
 class STextBlock;
 class SUniformGridPanel;
-class SEditableText;
 
 USTRUCT(BlueprintType)
 struct FModioDefaultCodeInputTextBoxStyle : public FTextBlockStyle
@@ -118,8 +120,30 @@ protected:
 	/** The number of children in the code input text box */
 	TOptional<ETextFlowDirection> TextFlowDirection;
 
-	/** The brush to use for the character border */
-	mutable FSlateBrush CachedCharacterBrush;
+	/** The brushes to use for the character border, with CharacterBorderPadding applied */
+	FSlateBrush CharacterBorderBrush;
+	FSlateBrush FocusedCharacterBorderBrush;
+
+	/** The code the character, caret and border widgets currently display */
+	FString DisplayedText;
+
+	/** Whether the hidden input field has focus, tracked through OnFocusChanging */
+	bool bHasFocus = false;
+
+	/** The focus state the caret and border widgets currently display */
+	bool bHasFocusDisplayed = false;
+
+	/**
+	 * Pushes the current code and focus state into the character, caret and border widgets, touching only those whose
+	 * state changed. Nothing is polled per frame, so an idle code input costs nothing
+	 * @param bForceRefresh Whether to push the state into every widget, e.g. after they have been rebuilt
+	 */
+	virtual void RefreshCharacterState(bool bForceRefresh = false);
+
+	/**
+	 * Applies CharacterBorderPadding to the character border brushes of the current style
+	 */
+	void UpdateCharacterBorderBrushes();
 
 	/**
 	 * Rebuilds the children of the code input text box (the characters)
@@ -130,6 +154,8 @@ protected:
 	//~ Begin SWidget Interface
 	virtual FReply OnFocusReceived(const FGeometry& MyGeometry, const FFocusEvent& InFocusEvent) override;
 	virtual bool SupportsKeyboardFocus() const override;
+	virtual void OnFocusChanging(const FWeakWidgetPath& PreviousFocusPath, const FWidgetPath& NewWidgetPath,
+	                             const FFocusEvent& InFocusEvent) override;
 	//~ End SWidget Interface
 
 	/**
@@ -139,7 +165,7 @@ protected:
 	virtual void OnInputTextChanged(const FText& NewText);
 
 	/**
-	 * Gets the character at the specified index
+	 * Gets the character displayed at the specified index
 	 * @param Index The index of the character to get
 	 * @return The character at the specified index
 	 */
@@ -239,6 +265,12 @@ protected:
 	/** Character widgets */
 	TArray<TSharedPtr<STextBlock>> CharacterWidgets;
 
+	/** Border around each character widget */
+	TArray<TSharedPtr<SBorder>> CharacterBorders;
+
+	/** Fake caret of each character widget */
+	TArray<TSharedPtr<SImage>> CaretImages;
+
 	/** The grid panel that contains the character widgets */
 	TSharedPtr<SUniformGridPanel> MyCharacterGrid;
 
@@ -36,6 +36,20 @@ class MODIOUICORE_API UModioDefaultTextBlock : public UTextBlock,
 {
 	GENERATED_BODY()
 
+public:
+	/**
+	 * @brief Number of text, font and color updates that reached Slate across all text blocks since the last reset
+	 */
+	static uint64 GetNumUpdatesApplied();
+
+	/**
+	 * @brief Number of text, font and color updates skipped across all text blocks because nothing changed, each one
+	 * an invalidation avoided
+	 */
+	static uint64 GetNumUpdatesSkipped();
+
+	static void ResetUpdateCounters();
+
 protected:
 	MODIO_WIDGET_PALETTE_OVERRIDE();
 
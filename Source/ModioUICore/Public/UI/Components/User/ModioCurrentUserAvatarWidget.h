@@ -63,7 +63,9 @@ protected:
 	FModioOnLoadStateWidgetStateChangedMulticast OnLoadStateChanged;
 	EModioUILoadState CurrentLoadState = EModioUILoadState::NotLoaded;
 
+	UFUNCTION()
 	void OnImageLoadCompleted(UObject* Context, bool bLoadSuccess);
+	void OnUserAvatarReady(FModioErrorCode ErrorCode, class UTexture2DDynamic* Texture);
 	virtual void TransitionToLoadState(EModioUILoadState NewState);
 
 	//~ Begin IModioUIUserAvatarDownloadCompletedReceiver Interface
@@ -39,9 +39,9 @@ protected:
 		UModioUISubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioUISubsystem>();
 		if (Subsystem)
 		{
-			Subsystem->OnUserChanged.AddUObject(
-				Cast<ImplementingClass>(this),
-				&IModioUIAuthenticationChangedReceiver::UserAuthenticationChangedHandler);
+			Subsystem->RegisterEventHandler<IModioUIAuthenticationChangedReceiver>(
+				Subsystem->OnUserChanged, &IModioUIAuthenticationChangedReceiver::UserAuthenticationChangedHandler,
+				*Cast<ImplementingClass>(this));
 
 			// Update with the "current" state of user authentication
 			UserAuthenticationChangedHandler(GEngine->GetEngineSubsystem<UModioSubsystem>()->QueryUserProfile());
@@ -40,8 +40,6 @@ class MODIOUICORE_API IModioUICollectionFollowStateChangedReceiver : public IInt
 	friend class UModioUICollectionFollowStateChangedReceiverLibrary;
 
 protected:
-	inline static TMap<TWeakObjectPtr<>, FDelegateHandle> RegistrationMap;
-
 	template<typename ImplementingClass>
 	void Register()
 	{
@@ -76,7 +74,6 @@ protected:
 				Subsystem->RegisterEventHandlerFromK2(
 					Subsystem->OnModCollectionFollowStateChanged,
 					&IModioUICollectionFollowStateChangedReceiver::CollectionFollowStateChangedHandlerK2Helper,
-					RegistrationMap,
 					TWeakObjectPtr<>(ObjectToRegister));
 			}
 		}
@@ -92,7 +89,6 @@ protected:
 				Subsystem->DeregisterEventHandlerFromK2(
 					Subsystem->OnModCollectionFollowStateChanged,
 					&IModioUICollectionFollowStateChangedReceiver::CollectionFollowStateChangedHandlerK2Helper,
-					RegistrationMap,
 					TWeakObjectPtr<>(ObjectToDeregister));
 			}
 		}
@@ -38,8 +38,6 @@ class MODIOUICORE_API IModioUIConnectivityChangedReceiver : public IInterface
 												   TWeakObjectPtr<UObject> ImplementingObject);
 
 protected:
-	inline static TMap<TWeakObjectPtr<>, FDelegateHandle> RegistrationMap;
-
 	template<typename ImplementingClass>
 	void Register()
 	{
@@ -75,7 +73,7 @@ protected:
 			{
 				Subsystem->RegisterEventHandlerFromK2(
 					Subsystem->OnConnectivityChanged,
-					&IModioUIConnectivityChangedReceiver::ConnectivityChangedHandlerK2Helper, RegistrationMap,
+					&IModioUIConnectivityChangedReceiver::ConnectivityChangedHandlerK2Helper,
 					TWeakObjectPtr<>(ObjectToRegister));
 
 				// Update with the "current" connectivity state
@@ -94,7 +92,7 @@ protected:
 			{
 				Subsystem->DeregisterEventHandlerFromK2(
 					Subsystem->OnConnectivityChanged,
-					&IModioUIConnectivityChangedReceiver::ConnectivityChangedHandlerK2Helper, RegistrationMap,
+					&IModioUIConnectivityChangedReceiver::ConnectivityChangedHandlerK2Helper,
 					TWeakObjectPtr<>(ObjectToDeregister));
 			}
 		}
@@ -38,8 +38,6 @@ class MODIOUICORE_API IModioUIDialogDisplayEventReceiver : public IInterface
 	friend class UModioUIDialogDisplayEventReceiverLibrary;
 
 protected:
-	inline static TMap<TWeakObjectPtr<>, FDelegateHandle> RegistrationMap;
-
 	template<typename ImplementingClass>
 	void Register()
 	{
@@ -72,7 +70,7 @@ protected:
 			{
 				Subsystem->RegisterEventHandlerFromK2(
 					Subsystem->OnDialogDisplayEvent,
-					&IModioUIDialogDisplayEventReceiver::DialogDisplayEventHandlerK2Helper, RegistrationMap,
+					&IModioUIDialogDisplayEventReceiver::DialogDisplayEventHandlerK2Helper,
 					TWeakObjectPtr<>(ObjectToRegister));
 			}
 		}
@@ -87,7 +85,7 @@ protected:
 			{
 				Subsystem->DeregisterEventHandlerFromK2(
 					Subsystem->OnDialogDisplayEvent,
-					&IModioUIDialogDisplayEventReceiver::DialogDisplayEventHandlerK2Helper, RegistrationMap,
+					&IModioUIDialogDisplayEventReceiver::DialogDisplayEventHandlerK2Helper,
 					TWeakObjectPtr<>(ObjectToDeregister));
 			}
 		}
@@ -38,8 +38,6 @@ class MODIOUICORE_API IModioUIEntitlementRefreshEventReceiver : public IInterfac
 	friend class UModioUIEntitlementRefreshEventReceiverLibrary;
 
 protected:
-	inline static TMap<TWeakObjectPtr<>, FDelegateHandle> RegistrationMap;
-
 	template<typename ImplementingClass>
 	void Register()
 	{
@@ -73,7 +71,7 @@ protected:
 			{
 				Subsystem->RegisterEventHandlerFromK2(
 					Subsystem->OnEntitlementRefreshEvent,
-					&IModioUIEntitlementRefreshEventReceiver::EntitlementRefreshEventHandlerK2Helper, RegistrationMap,
+					&IModioUIEntitlementRefreshEventReceiver::EntitlementRefreshEventHandlerK2Helper,
 					TWeakObjectPtr<>(ObjectToRegister));
 			}
 		}
@@ -88,7 +86,7 @@ protected:
 			{
 				Subsystem->DeregisterEventHandlerFromK2(
 					Subsystem->OnEntitlementRefreshEvent,
-					&IModioUIEntitlementRefreshEventReceiver::EntitlementRefreshEventHandlerK2Helper, RegistrationMap,
+					&IModioUIEntitlementRefreshEventReceiver::EntitlementRefreshEventHandlerK2Helper,
 					TWeakObjectPtr<>(ObjectToDeregister));
 			}
 		}
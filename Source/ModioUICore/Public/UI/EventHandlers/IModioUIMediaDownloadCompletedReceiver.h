@@ -94,12 +94,6 @@ class MODIOUICORE_API IModioUIMediaDownloadCompletedReceiver : public IInterface
 	friend class UModioUIMediaDownloadCompletedReceiverLibrary;
 
 protected:
-	inline static TMap<TWeakObjectPtr<>, FDelegateHandle> RegistrationMapGallery;
-	inline static TMap<TWeakObjectPtr<>, FDelegateHandle> RegistrationMapLogo;
-	inline static TMap<TWeakObjectPtr<>, FDelegateHandle> RegistrationMapAvatar;
-	inline static TMap<TWeakObjectPtr<>, FDelegateHandle> RegistrationMapCollectionLogo;
-	inline static TMap<TWeakObjectPtr<>, FDelegateHandle> RegistrationMapCollectionAvatar;
-
 	template<typename ImplementingClass>
 	void Register(EModioUIMediaDownloadEventType DownloadTypes)
 	{
@@ -191,13 +185,13 @@ protected:
 					Subsystem->RegisterEventHandlerFromK2(
 						Subsystem->OnModGalleryImageDownloadCompleted,
 						&IModioUIMediaDownloadCompletedReceiver::GalleryImageDownloadHandlerK2Helper,
-						RegistrationMapGallery, TWeakObjectPtr<>(ObjectToRegister));
+						TWeakObjectPtr<>(ObjectToRegister));
 				}
 				if (EnumHasAllFlags(DownloadTypes, EModioUIMediaDownloadEventType::ModLogo))
 				{
 					Subsystem->RegisterEventHandlerFromK2(
 						Subsystem->OnModLogoDownloadCompleted,
-						&IModioUIMediaDownloadCompletedReceiver::ModLogoDownloadHandlerK2Helper, RegistrationMapLogo,
+						&IModioUIMediaDownloadCompletedReceiver::ModLogoDownloadHandlerK2Helper,
 						TWeakObjectPtr<>(ObjectToRegister));
 				}
 				if (EnumHasAllFlags(DownloadTypes, EModioUIMediaDownloadEventType::ModCreatorAvatarImage))
@@ -205,14 +199,13 @@ protected:
 					Subsystem->RegisterEventHandlerFromK2(
 						Subsystem->OnModCreatorAvatarDownloadCompleted,
 						&IModioUIMediaDownloadCompletedReceiver::CreatorAvatarDownloadHandlerK2Helper,
-						RegistrationMapAvatar, TWeakObjectPtr<>(ObjectToRegister));
+						TWeakObjectPtr<>(ObjectToRegister));
 				}
 				if (EnumHasAllFlags(DownloadTypes, EModioUIMediaDownloadEventType::ModCollectionLogo))
 				{
 					Subsystem->RegisterEventHandlerFromK2(
 						Subsystem->OnModCollectionLogoDownloadCompleted,
 						&IModioUIMediaDownloadCompletedReceiver::ModCollectionLogoDownloadHandlerK2Helper,
-						RegistrationMapCollectionLogo,
 						TWeakObjectPtr<>(ObjectToRegister));
 				}
 				if (EnumHasAllFlags(DownloadTypes, EModioUIMediaDownloadEventType::ModCollectionCuratorAvatarImage))
@@ -220,7 +213,7 @@ protected:
 					Subsystem->RegisterEventHandlerFromK2(
 						Subsystem->OnModCollectionCuratorAvatarDownloadCompleted,
 						&IModioUIMediaDownloadCompletedReceiver::ModCollectionCuratorAvatarDownloadHandlerK2Helper,
-						RegistrationMapCollectionAvatar, TWeakObjectPtr<>(ObjectToRegister));
+						TWeakObjectPtr<>(ObjectToRegister));
 				}
 			}
 		}
@@ -238,13 +231,13 @@ protected:
 					Subsystem->DeregisterEventHandlerFromK2(
 						Subsystem->OnModGalleryImageDownloadCompleted,
 						&IModioUIMediaDownloadCompletedReceiver::GalleryImageDownloadHandlerK2Helper,
-						RegistrationMapGallery, TWeakObjectPtr<>(ObjectToDeregister));
+						TWeakObjectPtr<>(ObjectToDeregister));
 				}
 				if (EnumHasAllFlags(DownloadTypes, EModioUIMediaDownloadEventType::ModLogo))
 				{
 					Subsystem->DeregisterEventHandlerFromK2(
 						Subsystem->OnModLogoDownloadCompleted,
-						&IModioUIMediaDownloadCompletedReceiver::ModLogoDownloadHandlerK2Helper, RegistrationMapLogo,
+						&IModioUIMediaDownloadCompletedReceiver::ModLogoDownloadHandlerK2Helper,
 						TWeakObjectPtr<>(ObjectToDeregister));
 				}
 				if (EnumHasAllFlags(DownloadTypes, EModioUIMediaDownloadEventType::ModCreatorAvatarImage))
@@ -252,14 +245,13 @@ protected:
 					Subsystem->DeregisterEventHandlerFromK2(
 						Subsystem->OnModCreatorAvatarDownloadCompleted,
 						&IModioUIMediaDownloadCompletedReceiver::CreatorAvatarDownloadHandlerK2Helper,
-						RegistrationMapAvatar, TWeakObjectPtr<>(ObjectToDeregister));
+						TWeakObjectPtr<>(ObjectToDeregister));
 				}
 				if (EnumHasAllFlags(DownloadTypes, EModioUIMediaDownloadEventType::ModCollectionLogo))
 				{
 					Subsystem->DeregisterEventHandlerFromK2(
 						Subsystem->OnModCollectionLogoDownloadCompleted,
 						&IModioUIMediaDownloadCompletedReceiver::ModCollectionLogoDownloadHandlerK2Helper,
-						RegistrationMapCollectionLogo,
 						TWeakObjectPtr<>(ObjectToDeregister));
 				}
 				if (EnumHasAllFlags(DownloadTypes, EModioUIMediaDownloadEventType::ModCollectionCuratorAvatarImage))
@@ -267,7 +259,7 @@ protected:
 					Subsystem->DeregisterEventHandlerFromK2(
 						Subsystem->OnModCollectionCuratorAvatarDownloadCompleted,
 						&IModioUIMediaDownloadCompletedReceiver::ModCollectionCuratorAvatarDownloadHandlerK2Helper,
-						RegistrationMapCollectionAvatar, TWeakObjectPtr<>(ObjectToDeregister));
+						TWeakObjectPtr<>(ObjectToDeregister));
 				}
 			}
 		}
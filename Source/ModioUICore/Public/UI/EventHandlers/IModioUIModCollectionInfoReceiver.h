@@ -74,10 +74,6 @@ class MODIOUICORE_API IModioUIModCollectionInfoReceiver : public IInterface
 	friend class UModioUIModCollectionInfoReceiverLibrary;
 
 protected:
-	inline static TMap<TWeakObjectPtr<>, FDelegateHandle> RegistrationMapListModCollections;
-	inline static TMap<TWeakObjectPtr<>, FDelegateHandle> RegistrationMapGetModCollectionInfo;
-	inline static TMap<TWeakObjectPtr<>, FDelegateHandle> RegistrationMapGetModCollectionMods;
-
 	template<typename ImplementingClass>
 	void Register(EModioUIModCollectionInfoEventType EventType)
 	{
@@ -146,7 +142,6 @@ protected:
 				{
 					Subsystem->RegisterEventHandlerFromK2(Subsystem->OnListModCollectionsRequestCompleted,
 					                                      &IModioUIModCollectionInfoReceiver::ListModCollectionsRequestHandlerK2Helper,
-					                                      RegistrationMapListModCollections,
 					                                      TWeakObjectPtr<>(ObjectToRegister));
 				}
 				if (EnumHasAllFlags(EventType, EModioUIModCollectionInfoEventType::GetModCollectionInfo))
@@ -154,14 +149,14 @@ protected:
 					Subsystem->RegisterEventHandlerFromK2(
 						Subsystem->OnModCollectionInfoRequestCompleted,
 						&IModioUIModCollectionInfoReceiver::ModCollectionInfoRequestHandlerK2Helper,
-						RegistrationMapGetModCollectionInfo, TWeakObjectPtr<>(ObjectToRegister));
+						TWeakObjectPtr<>(ObjectToRegister));
 				}
 				if (EnumHasAllFlags(EventType, EModioUIModCollectionInfoEventType::GetModCollectionMods))
 				{
 					Subsystem->RegisterEventHandlerFromK2(
 						Subsystem->OnGetModCollectionModsRequestCompleted,
 						&IModioUIModCollectionInfoReceiver::GetModCollectionModsRequestHandlerK2Helper,
-						RegistrationMapGetModCollectionMods, TWeakObjectPtr<>(ObjectToRegister));
+						TWeakObjectPtr<>(ObjectToRegister));
 				}
 			}
 		}
@@ -178,7 +173,6 @@ protected:
 				{
 					Subsystem->DeregisterEventHandlerFromK2(Subsystem->OnListModCollectionsRequestCompleted,
 					                                        &IModioUIModCollectionInfoReceiver::ListModCollectionsRequestHandlerK2Helper,
-					                                        RegistrationMapListModCollections,
 					                                        TWeakObjectPtr<>(ObjectToDeregister));
 				}
 				if (EnumHasAllFlags(EventType, EModioUIModCollectionInfoEventType::GetModCollectionInfo))
@@ -186,14 +180,14 @@ protected:
 					Subsystem->DeregisterEventHandlerFromK2(
 						Subsystem->OnModCollectionInfoRequestCompleted,
 						&IModioUIModCollectionInfoReceiver::ModCollectionInfoRequestHandlerK2Helper,
-						RegistrationMapGetModCollectionInfo, TWeakObjectPtr<>(ObjectToDeregister));
+						TWeakObjectPtr<>(ObjectToDeregister));
 				}
 				if (EnumHasAllFlags(EventType, EModioUIModCollectionInfoEventType::GetModCollectionMods))
 				{
 					Subsystem->DeregisterEventHandlerFromK2(
 						Subsystem->OnGetModCollectionModsRequestCompleted,
 						&IModioUIModCollectionInfoReceiver::GetModCollectionModsRequestHandlerK2Helper,
-						RegistrationMapGetModCollectionMods, TWeakObjectPtr<>(ObjectToDeregister));
+						TWeakObjectPtr<>(ObjectToDeregister));
 				}
 			}
 		}
@@ -42,8 +42,6 @@ class MODIOUICORE_API IModioUIModEnabledStateChangedReceiver : public IInterface
 	friend class UModioUIModEnabledStateChangedReceiverLibrary;
 
 protected:
-	inline static TMap<TWeakObjectPtr<>, FDelegateHandle> RegistrationMap;
-
 	template<typename ImplementingClass>
 	void Register()
 	{
@@ -76,7 +74,7 @@ protected:
 			{
 				Subsystem->RegisterEventHandlerFromK2(
 					Subsystem->OnModEnabledStateChanged,
-					&IModioUIModEnabledStateChangedReceiver::ModEnabledStateChangedHandlerK2Helper, RegistrationMap,
+					&IModioUIModEnabledStateChangedReceiver::ModEnabledStateChangedHandlerK2Helper,
 					TWeakObjectPtr<>(ObjectToRegister));
 			}
 		}
@@ -91,7 +89,7 @@ protected:
 			{
 				Subsystem->DeregisterEventHandlerFromK2(
 					Subsystem->OnModEnabledStateChanged,
-					&IModioUIModEnabledStateChangedReceiver::ModEnabledStateChangedHandlerK2Helper, RegistrationMap,
+					&IModioUIModEnabledStateChangedReceiver::ModEnabledStateChangedHandlerK2Helper,
 					TWeakObjectPtr<>(ObjectToDeregister));
 			}
 		}
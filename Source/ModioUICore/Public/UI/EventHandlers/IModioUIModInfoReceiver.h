@@ -64,9 +64,6 @@ class MODIOUICORE_API IModioUIModInfoReceiver : public IInterface
 	friend class UModioUIModInfoReceiverLibrary;
 
 protected:
-	inline static TMap<TWeakObjectPtr<>, FDelegateHandle> RegistrationMapListAllMods;
-	inline static TMap<TWeakObjectPtr<>, FDelegateHandle> RegistrationMapGetModInfo;
-
 	template<typename ImplementingClass>
 	void Register(EModioUIModInfoEventType EventType)
 	{
@@ -118,14 +115,13 @@ protected:
 				{
 					Subsystem->RegisterEventHandlerFromK2(Subsystem->OnListAllModsRequestCompleted,
 														  &IModioUIModInfoReceiver::ListAllModsRequestHandlerK2Helper,
-														  RegistrationMapListAllMods,
 														  TWeakObjectPtr<>(ObjectToRegister));
 				}
 				if (EnumHasAllFlags(EventType, EModioUIModInfoEventType::GetModInfo))
 				{
 					Subsystem->RegisterEventHandlerFromK2(
 						Subsystem->OnModInfoRequestCompleted, &IModioUIModInfoReceiver::ModInfoRequestHandlerK2Helper,
-						RegistrationMapGetModInfo, TWeakObjectPtr<>(ObjectToRegister));
+						TWeakObjectPtr<>(ObjectToRegister));
 				}
 			}
 		}
@@ -142,14 +138,13 @@ protected:
 				{
 					Subsystem->DeregisterEventHandlerFromK2(Subsystem->OnListAllModsRequestCompleted,
 															&IModioUIModInfoReceiver::ListAllModsRequestHandlerK2Helper,
-															RegistrationMapListAllMods,
 															TWeakObjectPtr<>(ObjectToDeregister));
 				}
 				if (EnumHasAllFlags(EventType, EModioUIModInfoEventType::GetModInfo))
 				{
 					Subsystem->DeregisterEventHandlerFromK2(
 						Subsystem->OnModInfoRequestCompleted, &IModioUIModInfoReceiver::ModInfoRequestHandlerK2Helper,
-						RegistrationMapGetModInfo, TWeakObjectPtr<>(ObjectToDeregister));
+						TWeakObjectPtr<>(ObjectToDeregister));
 				}
 			}
 		}
@@ -36,8 +36,6 @@ class MODIOUICORE_API IModioUIModManagementEventReceiver : public IInterface
 	friend class UModioModManagementEventReceiverLibrary;
 
 protected:
-	inline static TMap<TWeakObjectPtr<UObject>, FDelegateHandle> RegistrationMap;
-
 	template<typename ImplementingClass>
 	void Register()
 	{
@@ -70,7 +68,7 @@ protected:
 			{
 				Subsystem->RegisterEventHandlerFromK2(
 					Subsystem->OnModManagementEvent,
-					&IModioUIModManagementEventReceiver::ModManagementEventHandlerK2Helper, RegistrationMap,
+					&IModioUIModManagementEventReceiver::ModManagementEventHandlerK2Helper,
 					TWeakObjectPtr<>(ObjectToRegister));
 			}
 		}
@@ -85,7 +83,7 @@ protected:
 			{
 				Subsystem->DeregisterEventHandlerFromK2(
 					Subsystem->OnModManagementEvent,
-					&IModioUIModManagementEventReceiver::ModManagementEventHandlerK2Helper, RegistrationMap,
+					&IModioUIModManagementEventReceiver::ModManagementEventHandlerK2Helper,
 					TWeakObjectPtr<>(ObjectToDeregister));
 			}
 		}
@@ -38,8 +38,6 @@ class MODIOUICORE_API IModioUISubscriptionsChangedReceiver : public IInterface
 	friend class UModioUISubscriptionsChangedReceiverLibrary;
 
 protected:
-	inline static TMap<TWeakObjectPtr<>, FDelegateHandle> RegistrationMap;
-
 	template<typename ImplementingClass>
 	void Register()
 	{
@@ -72,7 +70,7 @@ protected:
 			{
 				Subsystem->RegisterEventHandlerFromK2(
 					Subsystem->OnSubscriptionStatusChanged,
-					&IModioUISubscriptionsChangedReceiver::SubscriptionsChangedHandlerK2Helper, RegistrationMap,
+					&IModioUISubscriptionsChangedReceiver::SubscriptionsChangedHandlerK2Helper,
 					TWeakObjectPtr<>(ObjectToRegister));
 			}
 		}
@@ -87,7 +85,7 @@ protected:
 			{
 				Subsystem->DeregisterEventHandlerFromK2(
 					Subsystem->OnSubscriptionStatusChanged,
-					&IModioUISubscriptionsChangedReceiver::SubscriptionsChangedHandlerK2Helper, RegistrationMap,
+					&IModioUISubscriptionsChangedReceiver::SubscriptionsChangedHandlerK2Helper,
 					TWeakObjectPtr<>(ObjectToDeregister));
 			}
 		}
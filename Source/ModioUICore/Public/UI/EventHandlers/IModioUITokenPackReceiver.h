@@ -64,9 +64,6 @@ class MODIOUICORE_API IModioUITokenPackReceiver
 	friend class UModioUITokenPackReceiverLibrary;
 
 protected:
-	inline static TMap<TWeakObjectPtr<>, FDelegateHandle> RegistrationMapListAllTokenPacks;
-	inline static TMap<TWeakObjectPtr<>, FDelegateHandle> RegistrationMapGetTokenPack;
-
 	template<typename ImplementingClass>
 	void Register(EModioUITokenPackEventType EventType)
 	{
@@ -119,14 +116,13 @@ protected:
 				{
 					Subsystem->RegisterEventHandlerFromK2(Subsystem->OnListAllTokenPacksRequestCompleted,
 														  &IModioUITokenPackReceiver::ListAllTokenPacksRequestHandlerK2Helper,
-														  RegistrationMapListAllTokenPacks,
 														  TWeakObjectPtr<>(ObjectToRegister));
 				}
 				if (EnumHasAllFlags(EventType, EModioUITokenPackEventType::GetTokenPack))
 				{
 					Subsystem->RegisterEventHandlerFromK2(
 						Subsystem->OnTokenPackRequestCompleted, &IModioUITokenPackReceiver::TokenPackRequestHandlerK2Helper,
-						IModioUITokenPackReceiver::RegistrationMapGetTokenPack, TWeakObjectPtr<>(ObjectToRegister));
+						IModioUITokenPackReceiver::TWeakObjectPtr<>(ObjectToRegister));
 				}
 			}
 		}
@@ -143,14 +139,13 @@ protected:
 				{
 					Subsystem->DeregisterEventHandlerFromK2(Subsystem->OnListAllTokenPacksRequestCompleted,
 															&IModioUITokenPackReceiver::ListAllTokenPacksRequestHandlerK2Helper,
-															RegistrationMapListAllTokenPacks,
 															TWeakObjectPtr<>(ObjectToDeregister));
 				}
 				if (EnumHasAllFlags(EventType, EModioUITokenPackEventType::GetTokenPack))
 				{
 					Subsystem->DeregisterEventHandlerFromK2(
 						Subsystem->OnTokenPackRequestCompleted, &IModioUITokenPackReceiver::TokenPackRequestHandlerK2Helper,
-						RegistrationMapGetTokenPack, TWeakObjectPtr<>(ObjectToDeregister));
+						TWeakObjectPtr<>(ObjectToDeregister));
 				}
 			}
 		}
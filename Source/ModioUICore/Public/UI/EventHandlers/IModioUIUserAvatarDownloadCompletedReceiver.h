@@ -40,17 +40,16 @@ class MODIOUICORE_API IModioUIUserAvatarDownloadCompletedReceiver : public IInte
 	friend class UModioUIUserAvatarDownloadCompletedReceiverLibrary;
 
 protected:
-	inline static TMap<TWeakObjectPtr<>, FDelegateHandle> RegistrationMap;
-
 	template<typename ImplementingClass>
 	void Register()
 	{
 		UModioUISubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioUISubsystem>();
 		if (Subsystem)
 		{
-			Subsystem->OnUserAvatarDownloadCompleted.AddUObject(
-				Cast<ImplementingClass>(this),
-				&IModioUIUserAvatarDownloadCompletedReceiver::UserAvatarDownloadCompletedHandler);
+			Subsystem->RegisterEventHandler<IModioUIUserAvatarDownloadCompletedReceiver>(
+				Subsystem->OnUserAvatarDownloadCompleted,
+				&IModioUIUserAvatarDownloadCompletedReceiver::UserAvatarDownloadCompletedHandler,
+				*Cast<ImplementingClass>(this));
 		}
 	}
 
@@ -75,7 +74,7 @@ protected:
 				Subsystem->RegisterEventHandlerFromK2(
 					Subsystem->OnUserAvatarDownloadCompleted,
 					&IModioUIUserAvatarDownloadCompletedReceiver::UserAvatarDownloadCompletedHandlerK2Helper,
-					RegistrationMap, TWeakObjectPtr<>(ObjectToRegister));
+					TWeakObjectPtr<>(ObjectToRegister));
 			}
 		}
 	}
@@ -90,7 +89,7 @@ protected:
 				Subsystem->DeregisterEventHandlerFromK2(
 					Subsystem->OnUserAvatarDownloadCompleted,
 					&IModioUIUserAvatarDownloadCompletedReceiver::UserAvatarDownloadCompletedHandlerK2Helper,
-					RegistrationMap, TWeakObjectPtr<>(ObjectToDeregister));
+					TWeakObjectPtr<>(ObjectToDeregister));
 			}
 		}
 	}
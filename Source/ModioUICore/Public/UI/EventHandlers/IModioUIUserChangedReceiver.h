@@ -38,8 +38,6 @@ class MODIOUICORE_API IModioUIUserChangedReceiver : public IInterface
 	friend class UModioUIUserChangedReceiverLibrary;
 
 protected:
-	inline static TMap<TWeakObjectPtr<>, FDelegateHandle> RegistrationMap;
-
 	template<typename ImplementingClass>
 	void Register()
 	{
@@ -76,7 +74,7 @@ protected:
 			{
 				Subsystem->RegisterEventHandlerFromK2(Subsystem->OnUserChanged,
 													  &IModioUIUserChangedReceiver::UserChangedHandlerK2Helper,
-													  RegistrationMap, TWeakObjectPtr<>(ObjectToRegister));
+													  TWeakObjectPtr<>(ObjectToRegister));
 			}
 		}
 	}
@@ -90,7 +88,7 @@ protected:
 			{
 				Subsystem->DeregisterEventHandlerFromK2(Subsystem->OnUserChanged,
 														&IModioUIUserChangedReceiver::UserChangedHandlerK2Helper,
-														RegistrationMap, TWeakObjectPtr<>(ObjectToDeregister));
+														TWeakObjectPtr<>(ObjectToDeregister));
 			}
 		}
 	}
@@ -39,8 +39,6 @@ class MODIOUICORE_API IModioUIWalletBalanceUpdatedEventReceiver : public IInterf
 	friend class UModioUIWalletBalanceUpdatedEventReceiverLibrary;
 
 protected:
-	inline static TMap<TWeakObjectPtr<>, FDelegateHandle> RegistrationMap;
-
 	template<typename ImplementingClass>
 	void Register()
 	{
@@ -74,7 +72,7 @@ protected:
 			{
 				Subsystem->RegisterEventHandlerFromK2(
 					Subsystem->OnGetUserWalletBalanceRequestCompleted,
-					&IModioUIWalletBalanceUpdatedEventReceiver::WalletBalanceUpdatedHandlerK2Helper, RegistrationMap,
+					&IModioUIWalletBalanceUpdatedEventReceiver::WalletBalanceUpdatedHandlerK2Helper,
 					TWeakObjectPtr<>(ObjectToRegister));
 			}
 		}
@@ -89,7 +87,7 @@ protected:
 			{
 				Subsystem->DeregisterEventHandlerFromK2(
 					Subsystem->OnGetUserWalletBalanceRequestCompleted,
-					&IModioUIWalletBalanceUpdatedEventReceiver::WalletBalanceUpdatedHandlerK2Helper, RegistrationMap,
+					&IModioUIWalletBalanceUpdatedEventReceiver::WalletBalanceUpdatedHandlerK2Helper,
 					TWeakObjectPtr<>(ObjectToDeregister));
 			}
 		}
@@ -0,0 +1,39 @@
+/*
+ *  Copyright (C) 2025 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io UE Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/SharedPointer.h"
+#include "UObject/Interface.h"
+#include "IModioEntryBindingSchedulerOwner.generated.h"
+
+class FModioEntryBindingScheduler;
+
+/**
+ * @brief Native-only interface for list views that defer the binding of their entries to an
+ * FModioEntryBindingScheduler
+ */
+UINTERFACE(meta = (CannotImplementInterfaceInBlueprint))
+class UModioEntryBindingSchedulerOwner : public UInterface
+{
+	GENERATED_BODY()
+};
+
+class MODIOUICORE_API IModioEntryBindingSchedulerOwner
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * @brief Returns the scheduler the rows of this list view defer their binding to, if any
+	 */
+	virtual TSharedPtr<FModioEntryBindingScheduler> GetEntryBindingScheduler() const = 0;
+};
@@ -15,6 +15,8 @@
 #include "Types/ModioImageWrapper.h"
 #include "UObject/Interface.h"
 
+class UTexture2DDynamic;
+
 #include "IModioUIImageDisplayWidget.generated.h"
 
 DECLARE_DYNAMIC_DELEGATE_TwoParams(FModioImageDisplayOnLoadStateChanged, UObject*, LoadContext, bool, bLoadSuccess);
@@ -40,6 +42,14 @@ protected:
 	virtual void NativeSetBrushMatchTextureSize(bool bMatchTextureSize) {}
 	virtual void NativeSetDesiredBrushSize(FVector2D DesiredSize) {}
 	virtual void NativeSetBrush(const FSlateBrush& NewBrush) {}
+	/**
+	 * @brief Widgets that cannot take a decoded texture fall back to loading the image it was decoded from, which
+	 * still displays it and notifies their load event handlers
+	 */
+	virtual void NativeSetTexture(UTexture2DDynamic* Texture, FModioImageWrapper SourceImage)
+	{
+		NativeBeginLoadImageFromFile(SourceImage);
+	}
 	virtual void AddImageLoadEventHandler_Implementation(const FModioImageDisplayOnLoadStateChanged& Handler)
 	{
 		NativeAddImageLoadEventHandler(Handler);
@@ -63,6 +73,10 @@ protected:
 	virtual void SetBrushDirectly_Implementation(const FSlateBrush& NewBrush) {
 		NativeSetBrush(NewBrush);
 	}
+	virtual void SetTextureDirectly_Implementation(UTexture2DDynamic* Texture, FModioImageWrapper SourceImage)
+	{
+		NativeSetTexture(Texture, SourceImage);
+	}
 public:
 	/**
 	 * @brief Register a delegate to receive callbacks when the load state of the implementing object changes
@@ -105,4 +119,20 @@ public:
 	 */
 	UFUNCTION(BlueprintCallable, BlueprintNativeEvent, Category = "mod.io|UI|Image Display")
 	void SetBrushDirectly(const FSlateBrush& NewBrush);
+
+	/**
+	 * @brief Displays an already decoded texture, such as one shared between several widgets, without loading it again.
+	 * Load event handlers are notified as if the image had been loaded from file. Implementations that cannot take a
+	 * texture load SourceImage instead
+	 * @param Texture The texture to display
+	 * @param SourceImage The image Texture was decoded from
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintNativeEvent, Category = "mod.io|UI|Image Display")
+	void SetTextureDirectly(UTexture2DDynamic* Texture, FModioImageWrapper SourceImage);
+
+	/**
+	 * @brief Calls SetTextureDirectly on ImageWidget, or BeginLoadImageFromFile with SourceImage if ImageWidget is a
+	 * Blueprint implementation of this interface that does not implement SetTextureDirectly
+	 */
+	static void DisplayTexture(UObject* ImageWidget, UTexture2DDynamic* Texture, const FModioImageWrapper& SourceImage);
 };
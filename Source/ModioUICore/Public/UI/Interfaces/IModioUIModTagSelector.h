@@ -20,6 +20,8 @@
 
 #include "IModioUIModTagSelector.generated.h"
 
+class UModioModTagOptionsUI;
+
 DECLARE_DYNAMIC_DELEGATE(FModioOnTagSelectionChanged);
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FModioOnTagSelectionChangedMulticast);
@@ -38,6 +40,18 @@ class MODIOUICORE_API IModioUIModTagSelector
 	GENERATED_BODY()
 
 public:
+	/**
+	 * @brief Returns the number of selected tags. Native implementations can override this to answer without building
+	 * the array returned by GetSelectedTags
+	 */
+	virtual int32 NativeGetNumSelectedTags();
+
+	/**
+	 * @brief Returns the native tag options object this selector displays, if it has one, so that callers can listen for
+	 * individual selection changes on it
+	 */
+	virtual UModioModTagOptionsUI* NativeGetTagOptionsObject();
+
 	/**
 	 * @brief Checks if hidden tag categories should be shown by the implementing object
 	 */
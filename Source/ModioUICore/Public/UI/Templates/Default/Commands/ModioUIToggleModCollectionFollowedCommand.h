@@ -48,28 +48,24 @@ protected:
 	virtual void SetDataSource_Implementation(UObject* InDataSource) override
 	{
 		DataSource = InDataSource;
-		if (UModioSubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioSubsystem>())
+		if (UModioUISubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioUISubsystem>())
 		{
 			if (DataSource &&
 				DataSource->GetClass()->ImplementsInterface(UModioModCollectionInfoUIDetails::StaticClass()))
 			{
 				FModioModCollectionID CurrentCollectionID =
 					IModioModCollectionInfoUIDetails::Execute_GetModCollectionID(DataSource);
-				Subsystem->ListUserFollowedModCollectionsAsync(
-					{}, FOnListFollowedModCollectionsDelegateFast::CreateLambda(
-							[&](FModioErrorCode ec, TOptional<FModioModCollectionInfoList> FollowedCollections) {
-								if (ec)
-								{
-									UE_LOG(ModioUICore, Error, TEXT("Failed to query collection follow state: \"%s\""),
-										   *ec.GetErrorMessage());
-									bIsFollowed = false;
-								}
-								else
-								{
-									bIsFollowed =
-										FollowedCollections.GetValue().GetRawList().Contains(CurrentCollectionID);
-								}
-							}));
+				Subsystem->QueryIsUserFollowingModCollection(
+					CurrentCollectionID,
+					FOnQueryFollowedModCollectionCompletedFast::CreateWeakLambda(
+						this, [this](FModioErrorCode ec, bool bFollowed) {
+							if (ec)
+							{
+								UE_LOG(ModioUICore, Error, TEXT("Failed to query collection follow state: \"%s\""),
+									   *ec.GetErrorMessage());
+							}
+							bIsFollowed = bFollowed;
+						}));
 			}
 		}
 	}
@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include "Core/ModioWarmDialogState.h"
 #include "CoreMinimal.h"
 #include "UI/Components/ModioUIComponentBase.h"
 #include "UI/EventHandlers/IModioUIMediaDownloadCompletedReceiver.h"
@@ -99,6 +100,11 @@ protected:
 	virtual void NativeSetDataSource(UObject* InDataSource) override;
 	virtual void NativePreConstruct() override;
 
+	FModioWarmDialogState WarmDialogState;
+
+	/** Hands the data source to the image gallery if it was deferred while the dialog was being prepared */
+	void ApplyDeferredGalleryDataSource();
+
 	// Interface functions
 	virtual void NativeOnSubscriptionsChanged(FModioModID ModID, bool bNewSubscriptionState) override;
 
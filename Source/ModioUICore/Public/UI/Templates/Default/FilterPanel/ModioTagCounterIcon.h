@@ -17,6 +17,8 @@
 
 #include "ModioTagCounterIcon.generated.h"
 
+class UModioModTagOptionsUI;
+
 /**
  *
  */
@@ -36,4 +38,19 @@ protected:
 	int32 SynchronizeCounter();
 
 	virtual void NativeSetDataSource(UObject* InDataSource) override;
+	virtual void NativeDestruct() override;
+
+	/**
+	 * @brief Listens for selection changes on the data source's tag options object so the counter updates as tags are
+	 * toggled, rebinding if the data source now displays a different object
+	 */
+	void BindToTagOptions();
+
+	void UnbindFromTagOptions();
+
+	void OnTagSelectionToggled(UModioModTagUI* Tag, bool bSelected);
+
+	TWeakObjectPtr<UModioModTagOptionsUI> BoundTagOptions;
+
+	FDelegateHandle TagSelectionToggledHandle;
 };
@@ -53,6 +53,11 @@ class MODIOUICORE_API UModioModBrowser
 {
 	GENERATED_BODY()
 
+#if WITH_EDITOR
+	// The benchmark commandlet exercises the search and filter paths without constructing the full browser
+	friend class UModioUIBenchmarkCommandlet;
+#endif
+
 protected:
 	//~ Begin UUserWidget Interface
 	virtual void NativePreConstruct() override;
@@ -165,6 +170,8 @@ protected:
 	TArray<FModioModInfo> SearchSubscriptionsAndInstallsWithStoredParams() const;
 	UFUNCTION(BlueprintCallable, Category = "mod.io|UI|Mod Browser|Search and Filters", meta = (BlueprintProtected))
 	TArray<FModioModInfo> SearchPurchasesWithStoredParams() const;
+	TArray<FModioModInfo> SearchLibraryModsWithStoredParams(bool bSubscriptionsAndInstallations,
+	                                                        bool bPurchases) const;
 	TArray<FModioModInfo> FilterModArrayByTags(const TArray<FModioModInfo>& ModArray,
 	                                           const TObjectPtr<UObject>& Tags) const;
 	static bool ModIncludesTag(const FModioModInfo& Mod, const FString& Tag);
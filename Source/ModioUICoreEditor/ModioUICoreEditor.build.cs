@@ -15,6 +15,8 @@ public class ModioUICoreEditor : ModuleRules
             "KismetCompiler", "DeveloperToolSettings", "ScriptableEditorWidgets"
         });
 
+        PrivateDependencyModuleNames.AddRange(new string[] { "AssetRegistry", "Json", "JsonUtilities", "Settings" });
+
         PublicIncludePaths.AddRange(new string[] { Path.Combine(ModuleDirectory, "Public") });
         PrivateIncludePaths.AddRange(new string[] { Path.Combine(ModuleDirectory, "Private") });
     }
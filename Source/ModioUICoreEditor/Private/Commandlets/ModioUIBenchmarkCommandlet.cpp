@@ -0,0 +1,846 @@
+/*
+ *  Copyright (C) 2025 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io UE Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue/blob/main/LICENSE>)
+ *
+ */
+
+#include "Commandlets/ModioUIBenchmarkCommandlet.h"
+#include "Algo/AllOf.h"
+
+#include "Core/ModioModInfoUI.h"
+#include "Core/ModioTagOptionsUI.h"
+#include "Core/ModioUIFakeDataProvider.h"
+#include "Dom/JsonObject.h"
+#include "Engine/Engine.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "ModioUICoreEditor.h"
+#include "ModioUISettings.h"
+#include "ModioUISubsystem.h"
+#include "Serialization/JsonSerializer.h"
+#include "Types/ModioModInfoList.h"
+#include "UI/Components/EnumSelector/ModioEnumSelector.h"
+#include "UI/Components/Misc/ModioDropdownAnchor.h"
+#include "UI/Components/Misc/ModioObjectWrapBox.h"
+#include "UI/Components/ModTagSelector/ModioModTagSelector.h"
+#include "UI/Components/ModTile/ModioDefaultModTile.h"
+#include "UI/Components/ModTile/ModioDefaultModTileView.h"
+#include "UI/Components/Text/ModioDefaultTextBlock.h"
+#include "UI/Interfaces/IModioUIModListViewInterface.h"
+#include "UI/Interfaces/IModioUIObjectListWidget.h"
+#include "UI/ModioUICommonFunctionLibrary.h"
+#include "UI/Templates/Default/ModioModBrowser.h"
+#include "UObject/StrongObjectPtr.h"
+#include "UObject/UObjectArray.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(ModioUIBenchmarkCommandlet)
+
+namespace ModioUIBenchmark
+{
+	// Number of tags applied to each synthetic mod
+	constexpr int32 TagsPerMod = 5;
+
+	int64 GetLiveUObjectCount()
+	{
+		return GUObjectArray.GetObjectArrayNumMinusAvailable();
+	}
+
+	/** Process-wide, so it also picks up allocator slack and other threads; only meaningful for large differences */
+	int64 GetUsedPhysicalMemory()
+	{
+		return static_cast<int64>(FPlatformMemory::GetStats().UsedPhysical);
+	}
+
+	/**
+	 * Makes a UModioUIFakeDataProvider answering without latency or failures the UI subsystem's data provider for the
+	 * lifetime of the scope, and restores the previous provider afterwards
+	 */
+	class FScopedFakeDataProvider
+	{
+	public:
+		explicit FScopedFakeDataProvider(UModioUISubsystem& InSubsystem)
+			: Subsystem(&InSubsystem),
+			  PreviousProvider(InSubsystem.GetDataProvider()),
+			  FakeProvider(NewObject<UModioUIFakeDataProvider>(&InSubsystem))
+		{
+			FakeProvider->ApplyOverrides(TEXT("LatencySeconds=0 JitterSeconds=0 FailureRate=0"));
+			Subsystem->SetDataProvider(FakeProvider.Get());
+		}
+
+		~FScopedFakeDataProvider()
+		{
+			Subsystem->SetDataProvider(PreviousProvider.Get());
+		}
+
+		UModioUIFakeDataProvider* operator->() const
+		{
+			return FakeProvider.Get();
+		}
+
+		int32 GetRequestCount(FName RequestName) const
+		{
+			return FakeProvider->GetRequestCount(RequestName);
+		}
+
+		/** Fake responses complete on the core ticker, so tick it until IsDone returns true or MaxTicks have run */
+		static void PumpUntil(TFunctionRef<bool()> IsDone, int32 MaxTicks = 100)
+		{
+			for (int32 Tick = 0; Tick < MaxTicks && !IsDone(); Tick++)
+			{
+				FTSTicker::GetCoreTicker().Tick(0.0f);
+			}
+		}
+
+		/** Ticks the core ticker enough times for the fake responses to requests made so far to complete */
+		static void Pump()
+		{
+			PumpUntil([]() { return false; }, 10);
+		}
+
+	private:
+		UModioUISubsystem* Subsystem;
+		TStrongObjectPtr<UModioUIDataProvider> PreviousProvider;
+		TStrongObjectPtr<UModioUIFakeDataProvider> FakeProvider;
+	};
+} // namespace ModioUIBenchmark
+
+void UModioUIBenchmarkReceiver::BeginReceiving()
+{
+	IModioUIModInfoReceiver::Register<UModioUIBenchmarkReceiver>(EModioUIModInfoEventType::GetModInfo);
+}
+
+void UModioUIBenchmarkReceiver::EndReceiving()
+{
+	IModioUIModInfoReceiver::Deregister<UModioUIBenchmarkReceiver>(EModioUIModInfoEventType::GetModInfo);
+}
+
+void UModioUIBenchmarkReceiver::NativeOnModInfoRequestCompleted(FModioModID ModID, FModioErrorCode ErrorCode,
+                                                                TOptional<FModioModInfo> Info)
+{
+	IModioUIModInfoReceiver::NativeOnModInfoRequestCompleted(ModID, ErrorCode, Info);
+	NumEventsReceived++;
+}
+
+UModioUIBenchmarkCommandlet::UModioUIBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UModioUIBenchmarkCommandlet::Main(const FString& Params)
+{
+	FParse::Value(*Params, TEXT("Iterations="), NumIterations);
+	FParse::Value(*Params, TEXT("NumMods="), NumMods);
+	FParse::Value(*Params, TEXT("PageSize="), PageSize);
+	FParse::Value(*Params, TEXT("NumReceivers="), NumReceivers);
+	FParse::Value(*Params, TEXT("NumRegistrationReceivers="), NumRegistrationReceivers);
+	FParse::Value(*Params, TEXT("NumTagCategories="), NumTagCategories);
+	FParse::Value(*Params, TEXT("NumTagsPerCategory="), NumTagsPerCategory);
+	FParse::Value(*Params, TEXT("NumCollectionTiles="), NumCollectionTiles);
+	FParse::Value(*Params, TEXT("NumTextRebinds="), NumTextRebinds);
+	FParse::Value(*Params, TEXT("NumStoreOpens="), NumStoreOpens);
+	FParse::Value(*Params, TEXT("NumSelectorMenus="), NumSelectorMenus);
+
+	NumIterations = FMath::Max(NumIterations, 1);
+	PageSize = FMath::Max(PageSize, 1);
+	NumTagCategories = FMath::Max(NumTagCategories, 1);
+	NumTagsPerCategory = FMath::Max(NumTagsPerCategory, 1);
+
+	FString OutputPath =
+		FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("ModioUI"), TEXT("Benchmarks"), TEXT("ModioUIBenchmark.json"));
+	FParse::Value(*Params, TEXT("Output="), OutputPath);
+
+	// Synthetic tag options, laid out the same way the mod.io REST API returns them
+	for (int32 CategoryIndex = 0; CategoryIndex < NumTagCategories; CategoryIndex++)
+	{
+		FModioModTagInfo Category;
+		Category.TagGroupName = FString::Printf(TEXT("Category%d"), CategoryIndex);
+		Category.bAllowMultipleSelection = true;
+		for (int32 TagIndex = 0; TagIndex < NumTagsPerCategory; TagIndex++)
+		{
+			Category.TagGroupValues.Add(FString::Printf(TEXT("Tag%d_%d"), CategoryIndex, TagIndex));
+		}
+		SyntheticTagOptions.InternalList.Add(Category);
+	}
+
+	// Synthetic mods, each tagged with a deterministic spread of the tags above
+	FRandomStream Stream(0x6d6f64);
+	SyntheticMods.Reserve(NumMods);
+	for (int32 ModIndex = 0; ModIndex < NumMods; ModIndex++)
+	{
+		FModioModInfo Mod;
+		Mod.ModId = FModioModID(static_cast<int64>(ModIndex) + 1);
+		Mod.ProfileName = FString::Printf(TEXT("Synthetic Mod %d"), ModIndex);
+		for (int32 Tag = 0; Tag < ModioUIBenchmark::TagsPerMod; Tag++)
+		{
+			const int32 CategoryIndex = Stream.RandRange(0, NumTagCategories - 1);
+			const int32 TagIndex = Stream.RandRange(0, NumTagsPerCategory - 1);
+			FModioModTag ModTag;
+			ModTag.Tag = FString::Printf(TEXT("Tag%d_%d"), CategoryIndex, TagIndex);
+			ModTag.TagLocalized = FText::FromString(ModTag.Tag);
+			Mod.Tags.Add(ModTag);
+		}
+		SyntheticMods.Add(Mod);
+	}
+
+	UE_LOG(ModioUICoreEditor, Display,
+	       TEXT("Running ModioUI benchmarks: %d iterations, %d mods, page size %d, %d receivers, %d x %d tags"),
+	       NumIterations, NumMods, PageSize, NumReceivers, NumTagCategories, NumTagsPerCategory);
+
+	BenchmarkTileViewItemAssign();
+	BenchmarkTileViewPaginatedItemAppend();
+	BenchmarkModBrowserTagFilter();
+	BenchmarkModBrowserLibrarySearch();
+	BenchmarkModTagBinding();
+	BenchmarkBroadcastFanOut();
+	BenchmarkReceiverRegistration();
+	BenchmarkTagSelectorConstruction();
+	BenchmarkObjectWrapBoxRebuild();
+	BenchmarkFollowedCollectionQueries();
+	BenchmarkTextBlockRebind();
+	BenchmarkStoreCaches();
+	BenchmarkCollectionModsReopen();
+	BenchmarkSelectorMenuIdleBudget();
+
+	return WriteReport(OutputPath) && !bConsistencyCheckFailed ? 0 : 1;
+}
+
+void UModioUIBenchmarkCommandlet::RunBenchmark(const FString& Name, TFunctionRef<void()> Setup,
+                                               TFunctionRef<void()> Body)
+{
+	FBenchmarkResult& Result = Results.AddDefaulted_GetRef();
+	Result.Name = Name;
+
+	for (int32 Iteration = 0; Iteration < NumIterations; Iteration++)
+	{
+		Setup();
+
+		const int64 UObjectsBefore = ModioUIBenchmark::GetLiveUObjectCount();
+		const int64 MemoryBefore = ModioUIBenchmark::GetUsedPhysicalMemory();
+		const double StartTime = FPlatformTime::Seconds();
+
+		Body();
+
+		Result.SampleMs.Add((FPlatformTime::Seconds() - StartTime) * 1000.0);
+		Result.UObjectsAllocated = ModioUIBenchmark::GetLiveUObjectCount() - UObjectsBefore;
+		Result.ProcessMemoryDeltaBytes = ModioUIBenchmark::GetUsedPhysicalMemory() - MemoryBefore;
+	}
+
+	// Keep the UObject counts of one benchmark from leaking into the next
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+	UE_LOG(ModioUICoreEditor, Display, TEXT("%s: min %.3fms, max %.3fms, %lld UObjects, process memory %+lld bytes"),
+	       *Name, FMath::Min(Result.SampleMs), FMath::Max(Result.SampleMs), Result.UObjectsAllocated,
+	       Result.ProcessMemoryDeltaBytes);
+}
+
+void UModioUIBenchmarkCommandlet::BenchmarkTileViewItemAssign()
+{
+	TStrongObjectPtr<UModioDefaultModTileView> TileView(NewObject<UModioDefaultModTileView>(GetTransientPackage()));
+
+	RunBenchmark(
+		FString::Printf(TEXT("TileViewItemAssign_%d"), NumMods),
+		[&TileView]() {
+			IModioUIModListViewInterface::Execute_SetModsFromModInfoArray(TileView.Get(), {}, false);
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+		},
+		[this, &TileView]() {
+			IModioUIModListViewInterface::Execute_SetModsFromModInfoArray(TileView.Get(), SyntheticMods, false);
+		});
+}
+
+void UModioUIBenchmarkCommandlet::BenchmarkTileViewPaginatedItemAppend()
+{
+	TStrongObjectPtr<UModioDefaultModTileView> TileView(NewObject<UModioDefaultModTileView>(GetTransientPackage()));
+
+	TArray<TArray<FModioModInfo>> Pages;
+	for (int32 Offset = 0; Offset < SyntheticMods.Num(); Offset += PageSize)
+	{
+		Pages.Emplace(SyntheticMods.GetData() + Offset, FMath::Min(PageSize, SyntheticMods.Num() - Offset));
+	}
+
+	RunBenchmark(
+		FString::Printf(TEXT("TileViewPaginatedItemAppend_%dx%d"), Pages.Num(), PageSize),
+		[&TileView]() {
+			IModioUIModListViewInterface::Execute_SetModsFromModInfoArray(TileView.Get(), {}, false);
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+		},
+		[&TileView, &Pages]() {
+			for (const TArray<FModioModInfo>& Page : Pages)
+			{
+				IModioUIModListViewInterface::Execute_SetModsFromModInfoArray(TileView.Get(), Page, true);
+			}
+		});
+}
+
+void UModioUIBenchmarkCommandlet::BenchmarkModBrowserTagFilter()
+{
+	if (SyntheticMods.Num() == 0)
+	{
+		return;
+	}
+
+	TStrongObjectPtr<UModioModBrowser> Browser(NewObject<UModioModBrowser>(GetTransientPackage()));
+	TStrongObjectPtr<UModioModTagSelector> Selector(NewObject<UModioModTagSelector>(GetTransientPackage()));
+
+	// Filter by two of the first mod's tags, which is the common couple-of-filters case and guarantees at least one
+	// match. Selection goes through the setter so the options object's selected set sees it
+	TSet<FString> FilterTags;
+	for (const FModioModTag& ModTag : SyntheticMods[0].Tags)
+	{
+		if (FilterTags.Num() < 2)
+		{
+			FilterTags.Add(ModTag.Tag);
+		}
+	}
+	UModioModTagOptionsUI* BoundOptions = UModioUICommonFunctionLibrary::CreateBindableModTagOptions(SyntheticTagOptions);
+	for (UModioModTagInfoUI* Category : BoundOptions->BindableTagCategories)
+	{
+		for (UModioModTagUI* Tag : Category->BindableTags)
+		{
+			if (FilterTags.Contains(Tag->Underlying))
+			{
+				IModioModTagUIDetails::Execute_SetSelectionState(Tag, true);
+			}
+		}
+	}
+	if (BoundOptions->GetNumSelectedTags() != FilterTags.Num())
+	{
+		UE_LOG(ModioUICoreEditor, Error, TEXT("Tag filter benchmark selected %d of %d tags"),
+		       BoundOptions->GetNumSelectedTags(), FilterTags.Num());
+		bConsistencyCheckFailed = true;
+		return;
+	}
+	IModioUIModTagSelector::Execute_SetAvailableTagsFromBoundModTagOptions(
+		Selector.Get(), TScriptInterface<UModioModTagOptionsUIDetails>(BoundOptions));
+	Browser->StoredLibraryTagData = Selector.Get();
+
+	int32 NumMatches = 0;
+	RunBenchmark(
+		FString::Printf(TEXT("ModBrowserTagFilter_%d"), NumMods), []() {},
+		[this, &Browser, &NumMatches]() {
+			NumMatches = Browser->FilterModArrayByTags(SyntheticMods, Browser->StoredLibraryTagData).Num();
+		});
+
+	// The filter returns every mod when it sees no selection, so the count is checked against a plain scan rather than
+	// just for being non-empty
+	int32 ExpectedMatches = 0;
+	for (const FModioModInfo& Mod : SyntheticMods)
+	{
+		const bool bHasAllTags = Algo::AllOf(FilterTags, [&Mod](const FString& FilterTag) {
+			return Mod.Tags.ContainsByPredicate(
+				[&FilterTag](const FModioModTag& ModTag) { return ModTag.Tag == FilterTag; });
+		});
+		ExpectedMatches += bHasAllTags ? 1 : 0;
+	}
+	if (NumMatches == 0 || NumMatches != ExpectedMatches)
+	{
+		UE_LOG(ModioUICoreEditor, Error, TEXT("Tag filter matched %d mods, expected %d"), NumMatches, ExpectedMatches);
+		bConsistencyCheckFailed = true;
+	}
+	UE_LOG(ModioUICoreEditor, Verbose, TEXT("Tag filter matched %d of %d mods"), NumMatches, NumMods);
+}
+
+void UModioUIBenchmarkCommandlet::BenchmarkModBrowserLibrarySearch()
+{
+	UModioUISubsystem* Subsystem = GEngine ? GEngine->GetEngineSubsystem<UModioUISubsystem>() : nullptr;
+	if (!Subsystem)
+	{
+		UE_LOG(ModioUICoreEditor, Warning, TEXT("UModioUISubsystem unavailable, skipping library search benchmark"));
+		return;
+	}
+
+	ModioUIBenchmark::FScopedFakeDataProvider FakeProvider(*Subsystem);
+	FakeProvider->NumMods = NumMods;
+	FakeProvider->NumSubscribedMods = NumMods;
+
+	TStrongObjectPtr<UModioModBrowser> Browser(NewObject<UModioModBrowser>(GetTransientPackage()));
+	Browser->StoredSearchString = TEXT("7");
+
+	int32 NumMatches = 0;
+	RunBenchmark(
+		FString::Printf(TEXT("ModBrowserLibrarySearch_%d"), NumMods),
+		[&FakeProvider]() { FakeProvider->ResetRequestCounts(); },
+		[&Browser, &NumMatches]() { NumMatches = Browser->SearchSubscriptionsAndInstallsWithStoredParams().Num(); });
+
+	int32 ExpectedMatches = 0;
+	for (int32 ModIndex = 0; ModIndex < NumMods; ModIndex++)
+	{
+		ExpectedMatches += FakeProvider->MakeMod(ModIndex).ProfileName.Contains(Browser->StoredSearchString) ? 1 : 0;
+	}
+	const int32 NumRequests = FakeProvider.GetRequestCount(TEXT("QueryLibraryMods"));
+	if (NumRequests != 1 || NumMatches != ExpectedMatches)
+	{
+		UE_LOG(ModioUICoreEditor, Error, TEXT("Library search made %d queries and matched %d mods, expected 1 and %d"),
+		       NumRequests, NumMatches, ExpectedMatches);
+		bConsistencyCheckFailed = true;
+	}
+}
+
+void UModioUIBenchmarkCommandlet::BenchmarkModTagBinding()
+{
+	UModioUISubsystem* Subsystem = GEngine ? GEngine->GetEngineSubsystem<UModioUISubsystem>() : nullptr;
+	if (!Subsystem)
+	{
+		UE_LOG(ModioUICoreEditor, Warning, TEXT("UModioUISubsystem unavailable, skipping tag binding benchmark"));
+		return;
+	}
+
+	// Binds tags the way UModioModTagDisplay does
+	TSet<UModioModTagUI*> BoundTagObjects;
+	RunBenchmark(
+		FString::Printf(TEXT("ModTagBinding_%d"), NumMods), [&BoundTagObjects]() { BoundTagObjects.Reset(); },
+		[this, Subsystem, &BoundTagObjects]() {
+			for (const FModioModInfo& Mod : SyntheticMods)
+			{
+				for (const FModioModTag& Tag : Mod.Tags)
+				{
+					BoundTagObjects.Add(Subsystem->GetSharedModTag(Tag.Tag, Tag.TagLocalized));
+				}
+			}
+		});
+
+	TSet<FString> DistinctTags;
+	for (const FModioModInfo& Mod : SyntheticMods)
+	{
+		for (const FModioModTag& Tag : Mod.Tags)
+		{
+			DistinctTags.Add(Tag.Tag);
+		}
+	}
+	if (BoundTagObjects.Num() != DistinctTags.Num())
+	{
+		UE_LOG(ModioUICoreEditor, Error, TEXT("Tag binding produced %d objects for %d distinct tags"),
+		       BoundTagObjects.Num(), DistinctTags.Num());
+		bConsistencyCheckFailed = true;
+	}
+}
+
+void UModioUIBenchmarkCommandlet::BenchmarkBroadcastFanOut()
+{
+	UModioUISubsystem* Subsystem = GEngine ? GEngine->GetEngineSubsystem<UModioUISubsystem>() : nullptr;
+	if (!Subsystem)
+	{
+		UE_LOG(ModioUICoreEditor, Warning, TEXT("UModioUISubsystem unavailable, skipping broadcast benchmark"));
+		return;
+	}
+
+	TArray<TStrongObjectPtr<UModioUIBenchmarkReceiver>> Receivers;
+	Receivers.Reserve(NumReceivers);
+	for (int32 ReceiverIndex = 0; ReceiverIndex < NumReceivers; ReceiverIndex++)
+	{
+		Receivers.Emplace(NewObject<UModioUIBenchmarkReceiver>(GetTransientPackage()));
+		Receivers.Last()->BeginReceiving();
+	}
+
+	FModioModInfoList Page;
+	Page.InternalList.Append(SyntheticMods.GetData(), FMath::Min(PageSize, SyntheticMods.Num()));
+
+	RunBenchmark(
+		FString::Printf(TEXT("BroadcastFanOut_%dx%d"), Page.InternalList.Num(), NumReceivers), []() {},
+		[Subsystem, &Page]() { Subsystem->ModInfoRequestCompletedHandler({}, Page, {}); });
+
+	for (TStrongObjectPtr<UModioUIBenchmarkReceiver>& Receiver : Receivers)
+	{
+		Receiver->EndReceiving();
+	}
+}
+
+void UModioUIBenchmarkCommandlet::BenchmarkReceiverRegistration()
+{
+	UModioUISubsystem* Subsystem = GEngine ? GEngine->GetEngineSubsystem<UModioUISubsystem>() : nullptr;
+	if (!Subsystem)
+	{
+		UE_LOG(ModioUICoreEditor, Warning, TEXT("UModioUISubsystem unavailable, skipping registration benchmark"));
+		return;
+	}
+
+	TArray<TStrongObjectPtr<UModioUIBenchmarkReceiver>> Receivers;
+	Receivers.Reserve(NumRegistrationReceivers);
+	for (int32 ReceiverIndex = 0; ReceiverIndex < NumRegistrationReceivers; ReceiverIndex++)
+	{
+		Receivers.Emplace(NewObject<UModioUIBenchmarkReceiver>(GetTransientPackage()));
+	}
+
+	// Deregistration order is shuffled so that receivers do not simply leave in the order they joined
+	TArray<int32> DeregistrationOrder;
+	DeregistrationOrder.Reserve(Receivers.Num());
+	for (int32 ReceiverIndex = 0; ReceiverIndex < Receivers.Num(); ReceiverIndex++)
+	{
+		DeregistrationOrder.Add(ReceiverIndex);
+	}
+	FRandomStream Stream(0x726567);
+	for (int32 Index = DeregistrationOrder.Num() - 1; Index > 0; Index--)
+	{
+		DeregistrationOrder.Swap(Index, Stream.RandRange(0, Index));
+	}
+
+	const int32 InitialNumReceivers = Subsystem->OnModInfoRequestCompleted.Num();
+	RunBenchmark(
+		FString::Printf(TEXT("ReceiverRegistration_%d"), Receivers.Num()), []() {},
+		[this, Subsystem, &Receivers, &DeregistrationOrder, InitialNumReceivers]() {
+			for (TStrongObjectPtr<UModioUIBenchmarkReceiver>& Receiver : Receivers)
+			{
+				Receiver->BeginReceiving();
+			}
+			// Registering twice must not add a second binding
+			Receivers[0]->BeginReceiving();
+			if (Subsystem->OnModInfoRequestCompleted.Num() != InitialNumReceivers + Receivers.Num())
+			{
+				UE_LOG(ModioUICoreEditor, Error, TEXT("Expected %d registered receivers, found %d"),
+				       InitialNumReceivers + Receivers.Num(), Subsystem->OnModInfoRequestCompleted.Num());
+				bConsistencyCheckFailed = true;
+			}
+
+			for (const int32 ReceiverIndex : DeregistrationOrder)
+			{
+				Receivers[ReceiverIndex]->EndReceiving();
+			}
+			if (Subsystem->OnModInfoRequestCompleted.Num() != InitialNumReceivers)
+			{
+				UE_LOG(ModioUICoreEditor, Error, TEXT("%d receivers remained registered after deregistration"),
+				       Subsystem->OnModInfoRequestCompleted.Num() - InitialNumReceivers);
+				bConsistencyCheckFailed = true;
+			}
+		});
+}
+
+void UModioUIBenchmarkCommandlet::BenchmarkTagSelectorConstruction()
+{
+	TStrongObjectPtr<UModioModTagSelector> Selector(NewObject<UModioModTagSelector>(GetTransientPackage()));
+
+	RunBenchmark(
+		FString::Printf(TEXT("TagSelectorConstruction_%dx%d"), NumTagCategories, NumTagsPerCategory),
+		[]() { CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS); },
+		[this, &Selector]() {
+			IModioUIModTagSelector::Execute_SetAvailableTagsFromModTagOptions(Selector.Get(), SyntheticTagOptions);
+		});
+}
+
+void UModioUIBenchmarkCommandlet::BenchmarkObjectWrapBoxRebuild()
+{
+	TStrongObjectPtr<UModioObjectWrapBox> WrapBox(NewObject<UModioObjectWrapBox>(GetTransientPackage()));
+
+	// WidgetClass is only exposed to the details panel, so assign it the same way the editor would
+	if (FClassProperty* WidgetClassProperty =
+	        FindFProperty<FClassProperty>(UModioObjectWrapBox::StaticClass(), TEXT("WidgetClass")))
+	{
+		WidgetClassProperty->SetObjectPropertyValue_InContainer(WrapBox.Get(), UModioDefaultModTile::StaticClass());
+	}
+
+	TArray<UObject*> BoundMods;
+	for (int32 ModIndex = 0; ModIndex < FMath::Min(PageSize, SyntheticMods.Num()); ModIndex++)
+	{
+		BoundMods.Add(UModioUICommonFunctionLibrary::CreateBindableModInfo(SyntheticMods[ModIndex]));
+	}
+
+	RunBenchmark(
+		FString::Printf(TEXT("ObjectWrapBoxRebuild_%d"), BoundMods.Num()),
+		[&WrapBox]() { IModioUIObjectListWidget::Execute_SetObjects(WrapBox.Get(), {}); },
+		[&WrapBox, &BoundMods]() { IModioUIObjectListWidget::Execute_SetObjects(WrapBox.Get(), BoundMods); });
+}
+
+void UModioUIBenchmarkCommandlet::BenchmarkFollowedCollectionQueries()
+{
+	UModioUISubsystem* Subsystem = GEngine ? GEngine->GetEngineSubsystem<UModioUISubsystem>() : nullptr;
+	if (!Subsystem)
+	{
+		UE_LOG(ModioUICoreEditor, Warning, TEXT("UModioUISubsystem unavailable, skipping followed collection benchmark"));
+		return;
+	}
+
+	ModioUIBenchmark::FScopedFakeDataProvider FakeProvider(*Subsystem);
+
+	TArray<FModioModCollectionID> CollectionIDs;
+	for (int32 TileIndex = 0; TileIndex < NumCollectionTiles; TileIndex++)
+	{
+		CollectionIDs.Add(FakeProvider->MakeModCollection(TileIndex).Id);
+	}
+
+	int32 NumAnswered = 0;
+	int32 NumFollowed = 0;
+	RunBenchmark(
+		FString::Printf(TEXT("FollowedCollectionQueries_%d"), NumCollectionTiles),
+		[Subsystem, &FakeProvider]() {
+			Subsystem->InvalidateFollowedModCollections();
+			FakeProvider->ResetRequestCounts();
+		},
+		[Subsystem, &CollectionIDs, &NumAnswered, &NumFollowed]() {
+			NumAnswered = 0;
+			NumFollowed = 0;
+			for (const FModioModCollectionID& ID : CollectionIDs)
+			{
+				Subsystem->QueryIsUserFollowingModCollection(
+					ID, FOnQueryFollowedModCollectionCompletedFast::CreateLambda(
+						    [&NumAnswered, &NumFollowed](FModioErrorCode, bool bIsFollowed) {
+							    NumAnswered++;
+							    NumFollowed += bIsFollowed ? 1 : 0;
+						    }));
+			}
+			ModioUIBenchmark::FScopedFakeDataProvider::PumpUntil(
+				[&NumAnswered, &CollectionIDs]() { return NumAnswered == CollectionIDs.Num(); });
+		});
+
+	const int32 NumRequests = FakeProvider.GetRequestCount(TEXT("ListUserFollowedModCollections"));
+	const int32 ExpectedFollowed =
+		FMath::Min3(FakeProvider->NumFollowedModCollections, FakeProvider->NumModCollections, NumCollectionTiles);
+	if (NumRequests != 1 || NumAnswered != CollectionIDs.Num() || NumFollowed != ExpectedFollowed)
+	{
+		UE_LOG(ModioUICoreEditor, Error,
+		       TEXT("%d followed collection queries made %d requests and got %d answers, %d followed (expected %d)"),
+		       CollectionIDs.Num(), NumRequests, NumAnswered, NumFollowed, ExpectedFollowed);
+		bConsistencyCheckFailed = true;
+	}
+}
+
+void UModioUIBenchmarkCommandlet::BenchmarkTextBlockRebind()
+{
+	TStrongObjectPtr<UModioDefaultTextBlock> TextBlock(NewObject<UModioDefaultTextBlock>(GetTransientPackage()));
+
+	// A download tracker's percentage only changes every hundredth tick or so
+	constexpr int32 RebindsPerChange = 100;
+	TArray<FText> Texts;
+	for (int32 Rebind = 0; Rebind < NumTextRebinds; Rebind++)
+	{
+		Texts.Add(FText::AsPercent(static_cast<float>(Rebind / RebindsPerChange) / 100.0f));
+	}
+
+	RunBenchmark(
+		FString::Printf(TEXT("TextBlockRebind_%d"), NumTextRebinds),
+		[&TextBlock]() {
+			IModioUIHasTextWidget::Execute_SetWidgetText(TextBlock.Get(), FText::GetEmpty());
+			UModioDefaultTextBlock::ResetUpdateCounters();
+		},
+		[&TextBlock, &Texts]() {
+			for (const FText& Text : Texts)
+			{
+				IModioUIHasTextWidget::Execute_SetWidgetText(TextBlock.Get(), Text);
+			}
+		});
+
+	const uint64 NumApplied = UModioDefaultTextBlock::GetNumUpdatesApplied();
+	const uint64 NumSkipped = UModioDefaultTextBlock::GetNumUpdatesSkipped();
+	UE_LOG(ModioUICoreEditor, Display, TEXT("Text block rebinds: %llu applied, %llu invalidations avoided"), NumApplied,
+	       NumSkipped);
+
+	const uint64 ExpectedApplied = FMath::DivideAndRoundUp(NumTextRebinds, RebindsPerChange);
+	if (NumApplied != ExpectedApplied || NumApplied + NumSkipped != static_cast<uint64>(NumTextRebinds))
+	{
+		UE_LOG(ModioUICoreEditor, Error, TEXT("Text block applied %llu of %d rebinds, expected %llu"), NumApplied,
+		       NumTextRebinds, ExpectedApplied);
+		bConsistencyCheckFailed = true;
+	}
+}
+
+void UModioUIBenchmarkCommandlet::BenchmarkStoreCaches()
+{
+	UModioUISubsystem* Subsystem = GEngine ? GEngine->GetEngineSubsystem<UModioUISubsystem>() : nullptr;
+	if (!Subsystem)
+	{
+		UE_LOG(ModioUICoreEditor, Warning, TEXT("UModioUISubsystem unavailable, skipping store cache benchmark"));
+		return;
+	}
+
+	ModioUIBenchmark::FScopedFakeDataProvider FakeProvider(*Subsystem);
+
+	// Each open of a token pack browser lists the packs and refreshes the balance
+	auto OpenStore = [Subsystem]() {
+		Subsystem->RequestListAllTokenPacks();
+		Subsystem->RequestWalletBalanceRefresh();
+	};
+
+	RunBenchmark(
+		FString::Printf(TEXT("StoreCaches_%d"), NumStoreOpens),
+		[Subsystem, &FakeProvider]() {
+			Subsystem->InvalidateStoreCaches();
+			FakeProvider->ResetRequestCounts();
+		},
+		[this, &OpenStore]() {
+			for (int32 Open = 0; Open < NumStoreOpens; Open++)
+			{
+				OpenStore();
+				ModioUIBenchmark::FScopedFakeDataProvider::Pump();
+			}
+		});
+
+	const int32 NumPackRequests = FakeProvider.GetRequestCount(TEXT("ListAllTokenPacks"));
+	const int32 NumBalanceRequests = FakeProvider.GetRequestCount(TEXT("GetUserWalletBalance"));
+	if (NumPackRequests != 1 || NumBalanceRequests != 1)
+	{
+		UE_LOG(ModioUICoreEditor, Error,
+		       TEXT("%d store opens made %d token pack and %d wallet balance requests, expected 1 of each"),
+		       NumStoreOpens, NumPackRequests, NumBalanceRequests);
+		bConsistencyCheckFailed = true;
+	}
+
+	Subsystem->RequestRefreshEntitlements();
+	OpenStore();
+	ModioUIBenchmark::FScopedFakeDataProvider::Pump();
+	if (FakeProvider.GetRequestCount(TEXT("ListAllTokenPacks")) != NumPackRequests + 1 ||
+	    FakeProvider.GetRequestCount(TEXT("GetUserWalletBalance")) != NumBalanceRequests + 1)
+	{
+		UE_LOG(ModioUICoreEditor, Error, TEXT("Refreshing entitlements did not invalidate the store caches"));
+		bConsistencyCheckFailed = true;
+	}
+}
+
+void UModioUIBenchmarkCommandlet::BenchmarkCollectionModsReopen()
+{
+	UModioUISubsystem* Subsystem = GEngine ? GEngine->GetEngineSubsystem<UModioUISubsystem>() : nullptr;
+	const int32 NumCollections = GetDefault<UModioUISettings>()->CollectionModsCacheSize;
+	if (!Subsystem || NumCollections <= 0)
+	{
+		UE_LOG(ModioUICoreEditor, Warning,
+		       TEXT("UModioUISubsystem unavailable or collection mods cache disabled, skipping collection mods benchmark"));
+		return;
+	}
+
+	ModioUIBenchmark::FScopedFakeDataProvider FakeProvider(*Subsystem);
+
+	TArray<FModioModCollectionID> CollectionIDs;
+	for (int32 CollectionIndex = 0; CollectionIndex < NumCollections; CollectionIndex++)
+	{
+		CollectionIDs.Add(FakeProvider->MakeModCollection(CollectionIndex).Id);
+	}
+
+	// View every collection once to fill the cache; only the reopens are timed
+	FakeProvider->ResetRequestCounts();
+	for (const FModioModCollectionID& ID : CollectionIDs)
+	{
+		Subsystem->RequestGetModCollectionMods(ID);
+	}
+	ModioUIBenchmark::FScopedFakeDataProvider::Pump();
+
+	RunBenchmark(
+		FString::Printf(TEXT("CollectionModsReopen_%d"), NumCollections), []() {},
+		[Subsystem, &CollectionIDs]() {
+			for (const FModioModCollectionID& ID : CollectionIDs)
+			{
+				Subsystem->RequestGetModCollectionMods(ID);
+			}
+		});
+
+	const int32 NumRequests = FakeProvider.GetRequestCount(TEXT("GetModCollectionMods"));
+	if (NumRequests != NumCollections)
+	{
+		UE_LOG(ModioUICoreEditor, Error, TEXT("Viewing and reopening %d collections made %d requests, expected %d"),
+		       NumCollections, NumRequests, NumCollections);
+		bConsistencyCheckFailed = true;
+	}
+}
+
+void UModioUIBenchmarkCommandlet::BenchmarkSelectorMenuIdleBudget()
+{
+	UModioUISubsystem* Subsystem = GEngine ? GEngine->GetEngineSubsystem<UModioUISubsystem>() : nullptr;
+	if (!Subsystem)
+	{
+		UE_LOG(ModioUICoreEditor, Warning,
+		       TEXT("UModioUISubsystem unavailable, skipping selector menu idle budget benchmark"));
+		return;
+	}
+
+	// Each menu is owned by a selector and opened through a dropdown anchor. Without Slate the anchors report closed,
+	// so every populated menu is eligible for release
+	TArray<TStrongObjectPtr<UModioEnumSelector>> Owners;
+	TArray<TStrongObjectPtr<UModioDropdownAnchor>> Anchors;
+	TArray<TUniquePtr<ModioUI::FSelectorMenuState>> MenuStates;
+	int32 NumReleased = 0;
+	for (int32 MenuIndex = 0; MenuIndex < NumSelectorMenus; MenuIndex++)
+	{
+		UModioEnumSelector* Owner = NewObject<UModioEnumSelector>(GetTransientPackage());
+		UModioDropdownAnchor* Anchor = NewObject<UModioDropdownAnchor>(GetTransientPackage());
+		Owners.Emplace(Owner);
+		Anchors.Emplace(Anchor);
+		MenuStates.Add(MakeUnique<ModioUI::FSelectorMenuState>());
+		MenuStates.Last()->Initialize(*Owner, Anchor, nullptr, []() { return true; },
+		                              [&NumReleased]() { NumReleased++; });
+	}
+
+	RunBenchmark(
+		FString::Printf(TEXT("SelectorMenuIdleBudget_%d"), NumSelectorMenus),
+		[Subsystem, &Owners, &NumReleased]() {
+			for (const TStrongObjectPtr<UModioEnumSelector>& Owner : Owners)
+			{
+				Subsystem->ForgetIdleSelectorMenu(Owner.Get());
+			}
+			NumReleased = 0;
+		},
+		[&MenuStates]() {
+			// Open then close each menu in turn, as a user working along a filter bar does
+			for (const TUniquePtr<ModioUI::FSelectorMenuState>& MenuState : MenuStates)
+			{
+				MenuState->OpenStateChanged(true);
+				MenuState->OpenStateChanged(false);
+			}
+		});
+
+	const int32 ExpectedReleased =
+		FMath::Max(NumSelectorMenus - GetDefault<UModioUISettings>()->MaxIdleSelectorMenus, 0);
+	if (NumReleased != ExpectedReleased)
+	{
+		UE_LOG(ModioUICoreEditor, Error, TEXT("Closing %d selector menus released %d of them, expected %d"),
+		       NumSelectorMenus, NumReleased, ExpectedReleased);
+		bConsistencyCheckFailed = true;
+	}
+
+	for (const TStrongObjectPtr<UModioEnumSelector>& Owner : Owners)
+	{
+		Subsystem->ForgetIdleSelectorMenu(Owner.Get());
+	}
+}
+
+bool UModioUIBenchmarkCommandlet::WriteReport(const FString& OutputPath) const
+{
+	TSharedRef<FJsonObject> Report = MakeShared<FJsonObject>();
+	Report->SetNumberField(TEXT("Iterations"), NumIterations);
+	Report->SetNumberField(TEXT("NumMods"), NumMods);
+	Report->SetNumberField(TEXT("PageSize"), PageSize);
+	Report->SetNumberField(TEXT("NumReceivers"), NumReceivers);
+	Report->SetNumberField(TEXT("NumRegistrationReceivers"), NumRegistrationReceivers);
+	Report->SetNumberField(TEXT("NumTagCategories"), NumTagCategories);
+	Report->SetNumberField(TEXT("NumTagsPerCategory"), NumTagsPerCategory);
+
+	TArray<TSharedPtr<FJsonValue>> JsonResults;
+	for (const FBenchmarkResult& Result : Results)
+	{
+		TArray<double> SortedSamples = Result.SampleMs;
+		SortedSamples.Sort();
+
+		double TotalMs = 0;
+		for (double Sample : SortedSamples)
+		{
+			TotalMs += Sample;
+		}
+
+		TSharedRef<FJsonObject> JsonResult = MakeShared<FJsonObject>();
+		JsonResult->SetStringField(TEXT("Name"), Result.Name);
+		JsonResult->SetNumberField(TEXT("MinMs"), SortedSamples[0]);
+		JsonResult->SetNumberField(TEXT("MedianMs"), SortedSamples[SortedSamples.Num() / 2]);
+		JsonResult->SetNumberField(TEXT("MeanMs"), TotalMs / SortedSamples.Num());
+		JsonResult->SetNumberField(TEXT("MaxMs"), SortedSamples.Last());
+		JsonResult->SetNumberField(TEXT("UObjectsAllocated"), Result.UObjectsAllocated);
+		JsonResult->SetNumberField(TEXT("ProcessMemoryDeltaBytes"), Result.ProcessMemoryDeltaBytes);
+		JsonResults.Add(MakeShared<FJsonValueObject>(JsonResult));
+	}
+	Report->SetArrayField(TEXT("Results"), JsonResults);
+
+	FString ReportString;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ReportString);
+	if (!FJsonSerializer::Serialize(Report, Writer) || !FFileHelper::SaveStringToFile(ReportString, *OutputPath))
+	{
+		UE_LOG(ModioUICoreEditor, Error, TEXT("Failed to write ModioUI benchmark report to %s"), *OutputPath);
+		return false;
+	}
+
+	UE_LOG(ModioUICoreEditor, Display, TEXT("Wrote ModioUI benchmark report to %s"), *OutputPath);
+	return true;
+}
@@ -0,0 +1,161 @@
+/*
+ *  Copyright (C) 2025 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io UE Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue/blob/main/LICENSE>)
+ *
+ */
+
+#include "Commandlets/ModioUIReplayEventsCommandlet.h"
+
+#include "Containers/Ticker.h"
+#include "Core/ModioUIEventRecording.h"
+#include "Dom/JsonObject.h"
+#include "Engine/Engine.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "ModioUICoreEditor.h"
+#include "ModioUISubsystem.h"
+#include "Serialization/JsonSerializer.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(ModioUIReplayEventsCommandlet)
+
+namespace ModioUIReplayEventsCommandlet
+{
+	// Longest the replay sleeps before giving the ticker another chance to run while waiting for the next event
+	constexpr double MaxWaitSliceSeconds = 1.0 / 60.0;
+
+	// Ticks the core ticker with the time elapsed since the previous pump, so handlers see realistic frame deltas
+	void PumpTicker(double& LastTickTime)
+	{
+		const double Now = FPlatformTime::Seconds();
+		FTSTicker::GetCoreTicker().Tick(static_cast<float>(Now - LastTickTime));
+		LastTickTime = Now;
+	}
+} // namespace ModioUIReplayEventsCommandlet
+
+UModioUIReplayEventsCommandlet::UModioUIReplayEventsCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UModioUIReplayEventsCommandlet::Main(const FString& Params)
+{
+	FString RecordingPath;
+	if (!FParse::Value(*Params, TEXT("File="), RecordingPath))
+	{
+		UE_LOG(ModioUICoreEditor, Error, TEXT("Missing -File=<Recording.jsonl>"));
+		return 1;
+	}
+	FParse::Value(*Params, TEXT("Iterations="), NumIterations);
+	FParse::Value(*Params, TEXT("Speed="), Speed);
+	NumIterations = FMath::Max(NumIterations, 1);
+
+	FString OutputPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("ModioUI"), TEXT("Benchmarks"),
+										 FPaths::GetBaseFilename(RecordingPath) + TEXT("_Replay.json"));
+	FParse::Value(*Params, TEXT("Output="), OutputPath);
+
+	UModioUISubsystem* Subsystem = GEngine ? GEngine->GetEngineSubsystem<UModioUISubsystem>() : nullptr;
+	TSharedPtr<FModioUIEventReplayer> Replayer = FModioUIEventReplayer::Load(RecordingPath);
+	if (!Subsystem || !Replayer.IsValid())
+	{
+		return 1;
+	}
+
+	UE_LOG(ModioUICoreEditor, Display, TEXT("Replaying %d events from %s, %d iterations at speed %.2f"),
+	       Replayer->GetEvents().Num(), *RecordingPath, NumIterations, Speed);
+
+	bool bAllDispatched = true;
+	TArray<double> IterationMs;
+	for (int32 Iteration = 0; Iteration < NumIterations; Iteration++)
+	{
+		Results.Reset();
+		const double IterationStart = FPlatformTime::Seconds();
+		double LastTickTime = IterationStart;
+		for (const FModioUIRecordedEvent& Event : Replayer->GetEvents())
+		{
+			if (Speed > 0.0f)
+			{
+				// Keep the ticker running while waiting, as a game would, so deferred work interleaves with events
+				const double DispatchTime = IterationStart + Event.Time / Speed;
+				for (double Now = FPlatformTime::Seconds(); Now < DispatchTime; Now = FPlatformTime::Seconds())
+				{
+					ModioUIReplayEventsCommandlet::PumpTicker(LastTickTime);
+					const double WaitSeconds = DispatchTime - FPlatformTime::Seconds();
+					if (WaitSeconds > 0.0)
+					{
+						FPlatformProcess::Sleep(static_cast<float>(
+							FMath::Min(WaitSeconds, ModioUIReplayEventsCommandlet::MaxWaitSliceSeconds)));
+					}
+				}
+			}
+
+			const double DispatchStart = FPlatformTime::Seconds();
+			bAllDispatched &= FModioUIEventReplayer::DispatchEvent(*Subsystem, Event);
+			const double DispatchMs = (FPlatformTime::Seconds() - DispatchStart) * 1000.0;
+
+			FEventTypeResult& Result = Results.FindOrAdd(Event.Type);
+			Result.NumEvents++;
+			Result.TotalMs += DispatchMs;
+			Result.MaxMs = FMath::Max(Result.MaxMs, DispatchMs);
+
+			// Let anything the handler scheduled on the ticker run before the next event, outside the dispatch timing
+			ModioUIReplayEventsCommandlet::PumpTicker(LastTickTime);
+		}
+		IterationMs.Add((FPlatformTime::Seconds() - IterationStart) * 1000.0);
+	}
+
+	for (const TPair<FString, FEventTypeResult>& Result : Results)
+	{
+		UE_LOG(ModioUICoreEditor, Display, TEXT("%s: %d events, %.3fms total, %.3fms max"), *Result.Key,
+		       Result.Value.NumEvents, Result.Value.TotalMs, Result.Value.MaxMs);
+	}
+
+	return WriteReport(OutputPath, RecordingPath, IterationMs) && bAllDispatched ? 0 : 1;
+}
+
+bool UModioUIReplayEventsCommandlet::WriteReport(const FString& OutputPath, const FString& RecordingPath,
+                                                 const TArray<double>& IterationMs) const
+{
+	TSharedRef<FJsonObject> Report = MakeShared<FJsonObject>();
+	Report->SetStringField(TEXT("Recording"), RecordingPath);
+	Report->SetNumberField(TEXT("Iterations"), NumIterations);
+	Report->SetNumberField(TEXT("Speed"), Speed);
+
+	TArray<double> SortedIterationMs = IterationMs;
+	SortedIterationMs.Sort();
+	Report->SetNumberField(TEXT("MinMs"), SortedIterationMs[0]);
+	Report->SetNumberField(TEXT("MedianMs"), SortedIterationMs[SortedIterationMs.Num() / 2]);
+	Report->SetNumberField(TEXT("MaxMs"), SortedIterationMs.Last());
+
+	TArray<TSharedPtr<FJsonValue>> JsonResults;
+	for (const TPair<FString, FEventTypeResult>& Result : Results)
+	{
+		TSharedRef<FJsonObject> JsonResult = MakeShared<FJsonObject>();
+		JsonResult->SetStringField(TEXT("Type"), Result.Key);
+		JsonResult->SetNumberField(TEXT("NumEvents"), Result.Value.NumEvents);
+		JsonResult->SetNumberField(TEXT("TotalMs"), Result.Value.TotalMs);
+		JsonResult->SetNumberField(TEXT("MeanMs"), Result.Value.TotalMs / FMath::Max(Result.Value.NumEvents, 1));
+		JsonResult->SetNumberField(TEXT("MaxMs"), Result.Value.MaxMs);
+		JsonResults.Add(MakeShared<FJsonValueObject>(JsonResult));
+	}
+	Report->SetArrayField(TEXT("EventTypes"), JsonResults);
+
+	FString ReportString;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ReportString);
+	if (!FJsonSerializer::Serialize(Report, Writer) || !FFileHelper::SaveStringToFile(ReportString, *OutputPath))
+	{
+		UE_LOG(ModioUICoreEditor, Error, TEXT("Failed to write ModioUI replay report to %s"), *OutputPath);
+		return false;
+	}
+
+	UE_LOG(ModioUICoreEditor, Display, TEXT("Wrote ModioUI replay report to %s"), *OutputPath);
+	return true;
+}
@@ -0,0 +1,311 @@
+/*
+ *  Copyright (C) 2025 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io UE Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue/blob/main/LICENSE>)
+ *
+ */
+
+#include "Commandlets/ModioUIValidateComponentsCommandlet.h"
+
+#include "Algo/Count.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Async/ParallelFor.h"
+#include "Blueprint/WidgetTree.h"
+#include "Dom/JsonObject.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/EngineVersionComparison.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "ModioUICoreEditor.h"
+#include "Serialization/JsonSerializer.h"
+#include "UI/Components/ComponentHelpers.h"
+#include "UI/Components/ModioUIComponentStatics.h"
+#include "UObject/UObjectGlobals.h"
+#include "WidgetBlueprint.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(ModioUIValidateComponentsCommandlet)
+
+UModioUIValidateComponentsCommandlet::UModioUIValidateComponentsCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UModioUIValidateComponentsCommandlet::Main(const FString& Params)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	FString PathsParam = TEXT("/Game");
+	FParse::Value(*Params, TEXT("Paths="), PathsParam, false);
+	FParse::Value(*Params, TEXT("BatchSize="), BatchSize);
+	BatchSize = FMath::Max(BatchSize, 1);
+	bStrict = FParse::Param(*Params, TEXT("Strict"));
+	bSingleThreaded = FParse::Param(*Params, TEXT("SingleThreaded"));
+
+	FString OutputPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("ModioUI"), TEXT("Validation"),
+										 TEXT("ModioUIComponentValidation.json"));
+	FParse::Value(*Params, TEXT("Output="), OutputPath);
+
+	// Resolve every component contract up front so that the parallel phase only reads immutable data
+	for (const TPair<EModioUIComponentID, FModioUIComponentMetadata>& Entry :
+		 UModioUIComponentStatics::GetAllComponentMetadata())
+	{
+		TArray<const UClass*> Interfaces;
+		for (const UClass* InterfaceClass : Entry.Value.RequiredInterfaces)
+		{
+			if (InterfaceClass)
+			{
+				Interfaces.Add(InterfaceClass);
+				ComponentInterfaces.Add(InterfaceClass);
+			}
+		}
+		ComponentContracts.Emplace(Entry.Value.ComponentDisplayName.ToString(), MoveTemp(Interfaces));
+	}
+
+	TArray<FString> PackagePaths;
+	PathsParam.ParseIntoArray(PackagePaths, TEXT(","));
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	AssetRegistry.SearchAllAssets(true);
+
+	FARFilter Filter;
+#if UE_VERSION_OLDER_THAN(5, 1, 0)
+	Filter.ClassNames.Add(UWidgetBlueprint::StaticClass()->GetFName());
+#else
+	Filter.ClassPaths.Add(UWidgetBlueprint::StaticClass()->GetClassPathName());
+#endif
+	Filter.bRecursiveClasses = true;
+	Filter.bRecursivePaths = true;
+	for (const FString& PackagePath : PackagePaths)
+	{
+		Filter.PackagePaths.Add(FName(*PackagePath.TrimStartAndEnd()));
+	}
+	TArray<FAssetData> Assets;
+	AssetRegistry.GetAssets(Filter, Assets);
+
+	UE_LOG(ModioUICoreEditor, Display, TEXT("Validating %d widget Blueprints under %s in batches of %d"), Assets.Num(),
+		   *PathsParam, BatchSize);
+
+	Results.SetNum(Assets.Num());
+	for (int32 BatchStart = 0; BatchStart < Assets.Num(); BatchStart += BatchSize)
+	{
+		const int32 BatchEnd = FMath::Min(BatchStart + BatchSize, Assets.Num());
+
+		// Loading has to happen on the game thread
+		TArray<UWidgetBlueprint*> Blueprints;
+		Blueprints.SetNumZeroed(BatchEnd - BatchStart);
+		TArray<TArray<FModioBoundWidgetContract>> BoundWidgetContracts;
+		BoundWidgetContracts.SetNum(BatchEnd - BatchStart);
+		for (int32 AssetIndex = BatchStart; AssetIndex < BatchEnd; ++AssetIndex)
+		{
+			FAssetResult& Result = Results[AssetIndex];
+			Result.AssetPath = Assets[AssetIndex].GetObjectPathString();
+
+			const double LoadStart = FPlatformTime::Seconds();
+			UWidgetBlueprint* Blueprint = Cast<UWidgetBlueprint>(Assets[AssetIndex].GetAsset());
+			Result.LoadMs = (FPlatformTime::Seconds() - LoadStart) * 1000.0;
+
+			if (!Blueprint || !Blueprint->GeneratedClass || !Blueprint->WidgetTree)
+			{
+				Result.Errors.Add(TEXT("Failed to load Blueprint"));
+				continue;
+			}
+			if (!IsModioWidget(*Blueprint))
+			{
+				Result.bSkipped = true;
+				continue;
+			}
+			// Resolved here because looking classes up by name is not safe off the game thread. The parallel phase
+			// only reads the result
+			BoundWidgetContracts[AssetIndex - BatchStart] = ModioUI::GetBoundWidgetContracts(Blueprint->GeneratedClass);
+			Blueprints[AssetIndex - BatchStart] = Blueprint;
+		}
+
+		ParallelFor(
+			Blueprints.Num(),
+			[this, &Blueprints, &BoundWidgetContracts, BatchStart](int32 Index) {
+				if (Blueprints[Index])
+				{
+					FAssetResult& Result = Results[BatchStart + Index];
+					const double ValidateStart = FPlatformTime::Seconds();
+					ValidateBlueprint(*Blueprints[Index], BoundWidgetContracts[Index], Result);
+					Result.ValidateMs = (FPlatformTime::Seconds() - ValidateStart) * 1000.0;
+				}
+			},
+			bSingleThreaded ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+		// Let the batch go so that memory use does not grow with the size of the project
+		Blueprints.Reset();
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	}
+
+	int32 NumValidated = 0;
+	int32 NumFailed = 0;
+	int32 NumWarnings = 0;
+	for (const FAssetResult& Result : Results)
+	{
+		for (const FString& Error : Result.Errors)
+		{
+			UE_LOG(ModioUICoreEditor, Error, TEXT("%s: %s"), *Result.AssetPath, *Error);
+		}
+		for (const FString& Warning : Result.Warnings)
+		{
+			UE_LOG(ModioUICoreEditor, Warning, TEXT("%s: %s"), *Result.AssetPath, *Warning);
+		}
+		NumValidated += Result.bSkipped ? 0 : 1;
+		NumFailed += Result.Errors.Num() > 0 ? 1 : 0;
+		NumWarnings += Result.Warnings.Num();
+	}
+
+	const double TotalSeconds = FPlatformTime::Seconds() - StartTime;
+	UE_LOG(ModioUICoreEditor, Display, TEXT("Validated %d mod.io widgets (%d skipped) in %.2fs: %d failed, %d warnings"),
+		   NumValidated, Results.Num() - NumValidated, TotalSeconds, NumFailed, NumWarnings);
+
+	return WriteReport(OutputPath, TotalSeconds) && NumFailed == 0 ? 0 : 1;
+}
+
+void UModioUIValidateComponentsCommandlet::ValidateBlueprint(
+	const UWidgetBlueprint& Blueprint, TArrayView<const FModioBoundWidgetContract> BoundWidgetContracts,
+	FAssetResult& Result) const
+{
+	const UClass* WidgetClass = Blueprint.GeneratedClass;
+
+	TArray<FText> BoundWidgetErrors;
+	ModioUI::ValidateBoundWidgets(BoundWidgetContracts, *Blueprint.WidgetTree, BoundWidgetErrors);
+	for (const FText& Error : BoundWidgetErrors)
+	{
+		Result.Errors.Add(Error.ToString());
+	}
+
+	// The closest contract is the one with the most of its interfaces implemented, preferring larger contracts on a tie
+	int32 BestContractIndex = INDEX_NONE;
+	int32 BestImplementedCount = 0;
+	for (int32 ContractIndex = 0; ContractIndex < ComponentContracts.Num(); ++ContractIndex)
+	{
+		const TArray<const UClass*>& Interfaces = ComponentContracts[ContractIndex].Value;
+		const int32 ImplementedCount = Algo::CountIf(
+			Interfaces, [WidgetClass](const UClass* Interface) { return WidgetClass->ImplementsInterface(Interface); });
+		if (ImplementedCount == 0)
+		{
+			continue;
+		}
+		const float Coverage = static_cast<float>(ImplementedCount) / Interfaces.Num();
+		const float BestCoverage = BestContractIndex == INDEX_NONE
+									   ? 0.0f
+									   : static_cast<float>(BestImplementedCount) /
+											 ComponentContracts[BestContractIndex].Value.Num();
+		if (Coverage > BestCoverage || (Coverage == BestCoverage && ImplementedCount > BestImplementedCount))
+		{
+			BestContractIndex = ContractIndex;
+			BestImplementedCount = ImplementedCount;
+		}
+	}
+	if (BestContractIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	const TPair<FString, TArray<const UClass*>>& Contract = ComponentContracts[BestContractIndex];
+	Result.MatchedComponent = Contract.Key;
+	for (const UClass* Interface : Contract.Value)
+	{
+		if (!WidgetClass->ImplementsInterface(Interface))
+		{
+			const FString Message =
+				FString::Printf(TEXT("Closest component contract is %s, but %s is not implemented"), *Contract.Key,
+								*Interface->GetName());
+			(bStrict ? Result.Errors : Result.Warnings).Add(Message);
+		}
+	}
+}
+
+bool UModioUIValidateComponentsCommandlet::IsModioWidget(const UWidgetBlueprint& Blueprint) const
+{
+	const UClass* WidgetClass = Blueprint.GeneratedClass;
+	for (const UClass* Interface : ComponentInterfaces)
+	{
+		if (WidgetClass->ImplementsInterface(Interface))
+		{
+			return true;
+		}
+	}
+
+	const UClass* NativeClass = WidgetClass;
+	while (NativeClass && !NativeClass->HasAnyClassFlags(CLASS_Native))
+	{
+		NativeClass = NativeClass->GetSuperClass();
+	}
+	return NativeClass && NativeClass->GetOutermost()->GetName().StartsWith(TEXT("/Script/ModioUI"));
+}
+
+bool UModioUIValidateComponentsCommandlet::WriteReport(const FString& OutputPath, double TotalSeconds) const
+{
+	TSharedRef<FJsonObject> Report = MakeShared<FJsonObject>();
+	Report->SetNumberField(TEXT("TotalSeconds"), TotalSeconds);
+	Report->SetBoolField(TEXT("Strict"), bStrict);
+
+	double TotalLoadMs = 0.0;
+	double TotalValidateMs = 0.0;
+	int32 NumValidated = 0;
+	int32 NumFailed = 0;
+	TArray<TSharedPtr<FJsonValue>> JsonResults;
+	for (const FAssetResult& Result : Results)
+	{
+		TotalLoadMs += Result.LoadMs;
+		TotalValidateMs += Result.ValidateMs;
+		NumValidated += Result.bSkipped ? 0 : 1;
+		NumFailed += Result.Errors.Num() > 0 ? 1 : 0;
+		if (Result.bSkipped)
+		{
+			continue;
+		}
+
+		TSharedRef<FJsonObject> JsonResult = MakeShared<FJsonObject>();
+		JsonResult->SetStringField(TEXT("Asset"), Result.AssetPath);
+		JsonResult->SetStringField(TEXT("Component"), Result.MatchedComponent);
+		JsonResult->SetBoolField(TEXT("Passed"), Result.Errors.Num() == 0);
+		JsonResult->SetNumberField(TEXT("LoadMs"), Result.LoadMs);
+		JsonResult->SetNumberField(TEXT("ValidateMs"), Result.ValidateMs);
+
+		TArray<TSharedPtr<FJsonValue>> JsonErrors;
+		for (const FString& Error : Result.Errors)
+		{
+			JsonErrors.Add(MakeShared<FJsonValueString>(Error));
+		}
+		JsonResult->SetArrayField(TEXT("Errors"), JsonErrors);
+
+		TArray<TSharedPtr<FJsonValue>> JsonWarnings;
+		for (const FString& Warning : Result.Warnings)
+		{
+			JsonWarnings.Add(MakeShared<FJsonValueString>(Warning));
+		}
+		JsonResult->SetArrayField(TEXT("Warnings"), JsonWarnings);
+
+		JsonResults.Add(MakeShared<FJsonValueObject>(JsonResult));
+	}
+
+	Report->SetNumberField(TEXT("NumAssets"), Results.Num());
+	Report->SetNumberField(TEXT("NumValidated"), NumValidated);
+	Report->SetNumberField(TEXT("NumFailed"), NumFailed);
+	Report->SetNumberField(TEXT("TotalLoadMs"), TotalLoadMs);
+	Report->SetNumberField(TEXT("TotalValidateMs"), TotalValidateMs);
+	Report->SetNumberField(TEXT("MeanValidateMs"), NumValidated > 0 ? TotalValidateMs / NumValidated : 0.0);
+	Report->SetArrayField(TEXT("Results"), JsonResults);
+
+	FString ReportString;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ReportString);
+	if (!FJsonSerializer::Serialize(Report, Writer) || !FFileHelper::SaveStringToFile(ReportString, *OutputPath))
+	{
+		UE_LOG(ModioUICoreEditor, Error, TEXT("Failed to write ModioUI component validation report to %s"),
+			   *OutputPath);
+		return false;
+	}
+
+	UE_LOG(ModioUICoreEditor, Display, TEXT("Wrote ModioUI component validation report to %s"), *OutputPath);
+	return true;
+}
@@ -15,17 +15,12 @@
 	#include "AssetRegistry/AssetRegistryModule.h"
 	#include "Core/ModioModCollectionInfoUI.h"
 	#include "Core/ModioUIHelpers.h"
-	#include "Libraries/ModioErrorConditionLibrary.h"
-	#include "Libraries/ModioSDKLibrary.h"
-	#include "ModioSubsystem.h"
 	#include "Widgets/DeclarativeSyntaxSupport.h"
 	#include "Widgets/Input/SButton.h"
 	#include "Widgets/SWindow.h"
 	#include "Widgets/Text/STextBlock.h"
 	#include "Widgets/Views/SListView.h"
 	#include "Widgets/Views/STableRow.h"
-	#include "Framework/Notifications/NotificationManager.h"
-	#include "Widgets/Notifications/SNotificationList.h"
 
 	#include UE_INLINE_GENERATED_CPP_BY_NAME(ModioModCollectionInfoUIFactory)
 
@@ -68,63 +63,10 @@ bool UModioModCollectionInfoUIFactory::DoesSupportClass(UClass* Class)
 
 bool UModioModCollectionInfoUIFactory::ConfigureProperties()
 {
-	bOperationInProgress = false;
-	FNotificationInfo Info {FText::FromString("Fetching mod collections...")};
-	Info.bUseThrobber = true;
-	TSharedPtr<SNotificationItem> Notification = FSlateNotificationManager::Get().AddNotification(Info);
-	UModioSubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioSubsystem>();
-	if (Subsystem)
-	{
-		bOperationInProgress = true;
-		Subsystem->InitializeAsync(
-			UModioSDKLibrary::GetProjectInitializeOptions(),
-			FOnErrorOnlyDelegateFast::CreateLambda([this, Subsystem](FModioErrorCode ec) {
-				if (!ec)
-				{
-					bRequiresSDKShutdown = true;
-					Subsystem->ListModCollectionsAsync(
-						FModioFilterParams(),
-						FOnListModCollectionsDelegateFast::CreateUObject(
-							this, &UModioModCollectionInfoUIFactory::OnModCollectionListRetrieved));
-				}
-				else if (UModioErrorConditionLibrary::ErrorCodeMatches(ec, EModioErrorCondition::SDKAlreadyInitialized))
-				{
-					Subsystem->ListModCollectionsAsync(
-						FModioFilterParams(),
-						FOnListModCollectionsDelegateFast::CreateUObject(
-							this, &UModioModCollectionInfoUIFactory::OnModCollectionListRetrieved));
-				}
-				bOperationInProgress = false;
-			}));
-
-		while (bOperationInProgress)
-		{
-			if (!UModioSDKLibrary::GetProjectInitializeOptions().bUseBackgroundThread)
-			{
-				Subsystem->RunPendingHandlers();
-			}
-			else
-			{
-				FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
-	#if UE_VERSION_OLDER_THAN(5, 3, 0)
-				FTicker::GetCoreTicker().Tick(FApp::GetDeltaTime());
-	#else
-				FTSTicker::GetCoreTicker().Tick(FApp::GetDeltaTime());
-	#endif
-				FSlateApplication::Get().PumpMessages();
-				FSlateApplication::Get().Tick();
-				FPlatformProcess::Sleep(0);
-			}
-		}
-	}
-	else
-	{
-		return false;
-	}
-
-	Notification->ExpireAndFadeout();
-	Notification.Reset();
-
+	ModCollectionInfos.Empty();
+	SelectedItem.Reset();
+	bConfirmClicked = false;
+	Loader = MakeShared<FModioUIPreviewDataLoader>();
 
 	// clang-format off
 	SAssignNew(ImportWindow, SWindow)
@@ -138,6 +80,11 @@ bool UModioModCollectionInfoUIFactory::ConfigureProperties()
 		[
 			SNew(SVerticalBox)
 			+ SVerticalBox::Slot()
+			.AutoHeight()
+			[
+				Loader->MakeStatusWidget()
+			]
+			+ SVerticalBox::Slot()
 			[
 				SAssignNew(AvailableModCollectionInfoList, SListView<TSharedPtr<FModioModCollectionInfo>>)
 					.ListItemsSource(&ModCollectionInfos)
@@ -166,25 +113,33 @@ bool UModioModCollectionInfoUIFactory::ConfigureProperties()
 		]
 	];
 	// clang-format on
+
+	// The dialog opens straight away and fills in when the data arrives
+	TWeakObjectPtr<UModioModCollectionInfoUIFactory> WeakThis = this;
+	Loader->LoadModCollectionsAsync([WeakThis](TArray<FModioModCollectionInfo> LoadedModCollectionInfos) {
+		if (WeakThis.IsValid())
+		{
+			WeakThis->OnModCollectionsLoaded(MoveTemp(LoadedModCollectionInfos));
+		}
+	});
 	GEditor->EditorAddModalWindow(ImportWindow.ToSharedRef());
 	ImportWindow.Reset();
+	Loader->Cancel();
+	Loader.Reset();
 
 	return bConfirmClicked;
 }
 
-void UModioModCollectionInfoUIFactory::OnModCollectionListRetrieved(FModioErrorCode ec,
-														  TOptional<FModioModCollectionInfoList> ModList)
+void UModioModCollectionInfoUIFactory::OnModCollectionsLoaded(TArray<FModioModCollectionInfo> LoadedModCollectionInfos)
 {
 	ModCollectionInfos.Empty();
-	if (!ec)
+	Algo::Transform(LoadedModCollectionInfos, ModCollectionInfos, [](const FModioModCollectionInfo& Info) {
+		return MakeShareable(new FModioModCollectionInfo(Info));
+	});
+	if (AvailableModCollectionInfoList)
 	{
-		Algo::Transform(ModList->GetRawList(), ModCollectionInfos, [](const FModioModCollectionInfo& Info) {
-			return MakeShareable(new FModioModCollectionInfo(Info));
-		});
 		AvailableModCollectionInfoList->RequestListRefresh();
 	}
-	GEngine->GetEngineSubsystem<UModioSubsystem>()->ShutdownAsync(
-		FOnErrorOnlyDelegateFast::CreateLambda([this](FModioErrorCode) { bOperationInProgress = false; }));
 }
 
 FReply UModioModCollectionInfoUIFactory::OnConfirmClicked()
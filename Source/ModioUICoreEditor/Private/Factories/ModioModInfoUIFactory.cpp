@@ -16,9 +16,6 @@
 	#include "Core/ModioUIHelpers.h"
 	#include "Widgets/DeclarativeSyntaxSupport.h"
 	#include "Widgets/SWindow.h"
-	#include "ModioSubsystem.h"
-	#include "Libraries/ModioErrorConditionLibrary.h"
-	#include "Libraries/ModioSDKLibrary.h"
 	#include "Algo/Transform.h"
 	#include "Widgets/Input/SButton.h"
 	#include "Widgets/Text/STextBlock.h"
@@ -63,35 +60,11 @@ bool UModioModInfoUIFactory::DoesSupportClass(UClass* Class)
 
 bool UModioModInfoUIFactory::ConfigureProperties()
 {
-	UModioSubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioSubsystem>();
-	if (Subsystem)
-	{
-		bOperationInProgress = true;
-		Subsystem->InitializeAsync(
-			UModioSDKLibrary::GetProjectInitializeOptions(),
-			FOnErrorOnlyDelegateFast::CreateLambda([this, Subsystem](FModioErrorCode ec) {
-				if (!ec)
-				{
-					bRequiresSDKShutdown = true;
-					Subsystem->ListAllModsAsync(
-						FModioFilterParams(),
-						FOnListAllModsDelegateFast::CreateUObject(this, &UModioModInfoUIFactory::OnModListRetrieved));
-				}
-				else
-				{
-					bOperationInProgress = false;
-				}
-			}));
-
-		while (bOperationInProgress && !UModioSDKLibrary::GetProjectInitializeOptions().bUseBackgroundThread)
-		{
-			Subsystem->RunPendingHandlers();
-		}
-	}
-	else
-	{
-		return false;
-	}
+	ModInfos.Empty();
+	SelectedItem.Reset();
+	bConfirmClicked = false;
+	Loader = MakeShared<FModioUIPreviewDataLoader>();
+
 	// clang-format off
 	SAssignNew(ImportWindow, SWindow)
 	.Title(FText::FromString("Import Preview Mod Info"))
@@ -104,6 +77,11 @@ bool UModioModInfoUIFactory::ConfigureProperties()
 		[
 			SNew(SVerticalBox)
 			+ SVerticalBox::Slot()
+			.AutoHeight()
+			[
+				Loader->MakeStatusWidget()
+			]
+			+ SVerticalBox::Slot()
 			[
 				SAssignNew(AvailableModInfoList, SListView<TSharedPtr<FModioModInfo>>)
 					.ListItemsSource(&ModInfos)
@@ -132,23 +110,32 @@ bool UModioModInfoUIFactory::ConfigureProperties()
 		]
 	];
 	// clang-format on
+
+	// The dialog opens straight away and fills in when the data arrives
+	TWeakObjectPtr<UModioModInfoUIFactory> WeakThis = this;
+	Loader->LoadModsAsync([WeakThis](TArray<FModioModInfo> LoadedModInfos) {
+		if (WeakThis.IsValid())
+		{
+			WeakThis->OnModsLoaded(MoveTemp(LoadedModInfos));
+		}
+	});
 	GEditor->EditorAddModalWindow(ImportWindow.ToSharedRef());
 	ImportWindow.Reset();
+	Loader->Cancel();
+	Loader.Reset();
 
 	return bConfirmClicked;
 }
 
-void UModioModInfoUIFactory::OnModListRetrieved(FModioErrorCode ec, TOptional<FModioModInfoList> ModList)
+void UModioModInfoUIFactory::OnModsLoaded(TArray<FModioModInfo> LoadedModInfos)
 {
 	ModInfos.Empty();
-	if (!ec)
+	Algo::Transform(LoadedModInfos, ModInfos,
+					[](const FModioModInfo& Info) { return MakeShareable(new FModioModInfo(Info)); });
+	if (AvailableModInfoList)
 	{
-		Algo::Transform(ModList->GetRawList(), ModInfos,
-						[](const FModioModInfo& Info) { return MakeShareable(new FModioModInfo(Info)); });
 		AvailableModInfoList->RequestListRefresh();
 	}
-	GEngine->GetEngineSubsystem<UModioSubsystem>()->ShutdownAsync(
-		FOnErrorOnlyDelegateFast::CreateLambda([this](FModioErrorCode) { bOperationInProgress = false; }));
 }
 
 FReply UModioModInfoUIFactory::OnConfirmClicked()
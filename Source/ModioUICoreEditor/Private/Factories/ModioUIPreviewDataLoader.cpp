@@ -0,0 +1,424 @@
+/*
+ *  Copyright (C) 2025 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io UE Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue/blob/main/LICENSE>)
+ *
+ */
+
+#if WITH_EDITOR
+
+	#include "Factories/ModioUIPreviewDataLoader.h"
+	#include "Async/Async.h"
+	#include "Core/ModioUIFakeDataProvider.h"
+	#include "JsonObjectConverter.h"
+	#include "Libraries/ModioErrorConditionLibrary.h"
+	#include "Libraries/ModioSDKLibrary.h"
+	#include "Misc/FileHelper.h"
+	#include "Misc/Paths.h"
+	#include "ModioSubsystem.h"
+	#include "ModioUICoreEditor.h"
+	#include "Widgets/Images/SThrobber.h"
+	#include "Widgets/SBoxPanel.h"
+	#include "Widgets/Text/STextBlock.h"
+
+	#define LOCTEXT_NAMESPACE "FModioUIPreviewDataLoader"
+
+namespace ModioUIPreviewDataLoader
+{
+	template<typename StructType>
+	bool ParseFixture(const FString& Json, TArray<StructType>& OutValue)
+	{
+		return FJsonObjectConverter::JsonArrayStringToUStruct(Json, &OutValue, 0, 0);
+	}
+
+	bool ParseFixture(const FString& Json, FModioUser& OutValue)
+	{
+		return FJsonObjectConverter::JsonObjectStringToUStruct(Json, &OutValue, 0, 0);
+	}
+} // namespace ModioUIPreviewDataLoader
+
+FModioUIPreviewDataLoader::FModioUIPreviewDataLoader() {}
+
+FModioUIPreviewDataLoader::~FModioUIPreviewDataLoader()
+{
+	if (PumpTickHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(PumpTickHandle);
+	}
+}
+
+void FModioUIPreviewDataLoader::Cancel()
+{
+	bCancelled = true;
+}
+
+void FModioUIPreviewDataLoader::LoadModsAsync(FOnModsLoaded OnLoaded)
+{
+	bCancelled = false;
+	switch (GetDefault<UModioUIPreviewDataSettings>()->Source)
+	{
+		case EModioUIPreviewDataSource::Fixtures:
+			LoadFixtureAsync<TArray<FModioModInfo>>(
+				TEXT("Mods.json"), [this, OnLoaded](TOptional<TArray<FModioModInfo>> Mods) {
+					if (!Mods.IsSet())
+					{
+						LoadModsFromFakeBackend(OnLoaded);
+						return;
+					}
+					SetStatus(FText::Format(LOCTEXT("ModsFromFixture", "Loaded {0} mods from fixture"), Mods->Num()),
+							  false);
+					if (!bCancelled)
+					{
+						OnLoaded(MoveTemp(Mods.GetValue()));
+					}
+				});
+			break;
+		case EModioUIPreviewDataSource::FakeBackend:
+			LoadModsFromFakeBackend(MoveTemp(OnLoaded));
+			break;
+		case EModioUIPreviewDataSource::ModioService:
+			RunServiceRequest(UModioSDKLibrary::GetProjectInitializeOptions(), [this, OnLoaded]() {
+				SetStatus(LOCTEXT("ListingMods", "Fetching mods..."), true);
+				GEngine->GetEngineSubsystem<UModioSubsystem>()->ListAllModsAsync(
+					FModioFilterParams(),
+					FOnListAllModsDelegateFast::CreateLambda(
+						[this, StrongThis = AsShared(), OnLoaded](FModioErrorCode ec,
+																  TOptional<FModioModInfoList> ModList) {
+							TArray<FModioModInfo> Mods;
+							if (!ec && ModList.IsSet())
+							{
+								Mods = ModList->GetRawList();
+							}
+							SetStatus(ec ? FText::FromString(ec.GetErrorMessage())
+										 : FText::Format(LOCTEXT("ModsFromService", "Fetched {0} mods"), Mods.Num()),
+									  false);
+							if (!bCancelled)
+							{
+								OnLoaded(MoveTemp(Mods));
+							}
+							FinishServiceRequest();
+						}));
+			});
+			break;
+	}
+}
+
+void FModioUIPreviewDataLoader::LoadModCollectionsAsync(FOnModCollectionsLoaded OnLoaded)
+{
+	bCancelled = false;
+	switch (GetDefault<UModioUIPreviewDataSettings>()->Source)
+	{
+		case EModioUIPreviewDataSource::Fixtures:
+			LoadFixtureAsync<TArray<FModioModCollectionInfo>>(
+				TEXT("ModCollections.json"), [this, OnLoaded](TOptional<TArray<FModioModCollectionInfo>> Collections) {
+					if (!Collections.IsSet())
+					{
+						LoadModCollectionsFromFakeBackend(OnLoaded);
+						return;
+					}
+					SetStatus(FText::Format(LOCTEXT("CollectionsFromFixture", "Loaded {0} mod collections from fixture"),
+											Collections->Num()),
+							  false);
+					if (!bCancelled)
+					{
+						OnLoaded(MoveTemp(Collections.GetValue()));
+					}
+				});
+			break;
+		case EModioUIPreviewDataSource::FakeBackend:
+			LoadModCollectionsFromFakeBackend(MoveTemp(OnLoaded));
+			break;
+		case EModioUIPreviewDataSource::ModioService:
+			RunServiceRequest(UModioSDKLibrary::GetProjectInitializeOptions(), [this, OnLoaded]() {
+				SetStatus(LOCTEXT("ListingCollections", "Fetching mod collections..."), true);
+				GEngine->GetEngineSubsystem<UModioSubsystem>()->ListModCollectionsAsync(
+					FModioFilterParams(),
+					FOnListModCollectionsDelegateFast::CreateLambda(
+						[this, StrongThis = AsShared(),
+						 OnLoaded](FModioErrorCode ec, TOptional<FModioModCollectionInfoList> CollectionList) {
+							TArray<FModioModCollectionInfo> Collections;
+							if (!ec && CollectionList.IsSet())
+							{
+								Collections = CollectionList->GetRawList();
+							}
+							SetStatus(ec ? FText::FromString(ec.GetErrorMessage())
+										 : FText::Format(LOCTEXT("CollectionsFromService", "Fetched {0} mod collections"),
+														 Collections.Num()),
+									  false);
+							if (!bCancelled)
+							{
+								OnLoaded(MoveTemp(Collections));
+							}
+							FinishServiceRequest();
+						}));
+			});
+			break;
+	}
+}
+
+void FModioUIPreviewDataLoader::LoadUserAsync(FOnUserLoaded OnLoaded)
+{
+	bCancelled = false;
+	switch (GetDefault<UModioUIPreviewDataSettings>()->Source)
+	{
+		case EModioUIPreviewDataSource::Fixtures:
+			LoadFixtureAsync<FModioUser>(TEXT("User.json"), [this, OnLoaded](TOptional<FModioUser> User) {
+				if (!User.IsSet())
+				{
+					LoadUserFromFakeBackend(OnLoaded);
+					return;
+				}
+				SetStatus(LOCTEXT("UserFromFixture", "Loaded user from fixture"), false);
+				if (!bCancelled)
+				{
+					OnLoaded(MoveTemp(User));
+				}
+			});
+			break;
+		case EModioUIPreviewDataSource::FakeBackend:
+			LoadUserFromFakeBackend(MoveTemp(OnLoaded));
+			break;
+		case EModioUIPreviewDataSource::ModioService:
+			RunServiceRequest(UModioSDKLibrary::GetProjectInitializeOptionsForSessionId("ModioUnrealEditor"),
+							  [this, OnLoaded]() {
+								  TOptional<FModioUser> User =
+									  GEngine->GetEngineSubsystem<UModioSubsystem>()->QueryUserProfile();
+								  SetStatus(User.IsSet() ? LOCTEXT("UserFromService", "Fetched authenticated user")
+														 : LOCTEXT("NoUserFromService", "No user is authenticated"),
+											false);
+								  if (!bCancelled)
+								  {
+									  OnLoaded(MoveTemp(User));
+								  }
+								  FinishServiceRequest();
+							  });
+			break;
+	}
+}
+
+TSharedRef<SWidget> FModioUIPreviewDataLoader::MakeStatusWidget()
+{
+	TWeakPtr<FModioUIPreviewDataLoader> WeakThis = AsShared();
+	// clang-format off
+	return SNew(SHorizontalBox)
+		+ SHorizontalBox::Slot()
+		.AutoWidth()
+		.VAlign(VAlign_Center)
+		.Padding(4.0f)
+		[
+			SNew(SThrobber)
+			.Visibility_Lambda([WeakThis]() {
+				TSharedPtr<FModioUIPreviewDataLoader> This = WeakThis.Pin();
+				return This && This->IsLoading() ? EVisibility::Visible : EVisibility::Collapsed;
+			})
+		]
+		+ SHorizontalBox::Slot()
+		.VAlign(VAlign_Center)
+		.Padding(4.0f)
+		[
+			SNew(STextBlock)
+			.Text_Lambda([WeakThis]() {
+				TSharedPtr<FModioUIPreviewDataLoader> This = WeakThis.Pin();
+				return This ? This->GetStatusText() : FText::GetEmpty();
+			})
+		];
+	// clang-format on
+}
+
+template<typename ResultType>
+void FModioUIPreviewDataLoader::LoadFixtureAsync(const TCHAR* FileName,
+												 TFunction<void(TOptional<ResultType>)> OnParsed)
+{
+	const FString FilePath =
+		FPaths::Combine(GetDefault<UModioUIPreviewDataSettings>()->GetFixtureDirectory(), FileName);
+	SetStatus(FText::Format(LOCTEXT("ReadingFixture", "Reading {0}..."), FText::FromString(FilePath)), true);
+
+	TWeakPtr<FModioUIPreviewDataLoader> WeakThis = AsShared();
+	Async(EAsyncExecution::ThreadPool, [FilePath, WeakThis, OnParsed = MoveTemp(OnParsed)]() mutable {
+		TOptional<ResultType> Result;
+		FString Json;
+		if (FFileHelper::LoadFileToString(Json, *FilePath))
+		{
+			ResultType Parsed;
+			if (ModioUIPreviewDataLoader::ParseFixture(Json, Parsed))
+			{
+				Result = MoveTemp(Parsed);
+			}
+			else
+			{
+				UE_LOG(ModioUICoreEditor, Warning, TEXT("Could not parse preview fixture %s"), *FilePath);
+			}
+		}
+		else
+		{
+			UE_LOG(ModioUICoreEditor, Log, TEXT("No preview fixture at %s, using synthetic data instead"), *FilePath);
+		}
+
+		AsyncTask(ENamedThreads::GameThread,
+				  [WeakThis, Result = MoveTemp(Result), OnParsed = MoveTemp(OnParsed)]() mutable {
+					  if (WeakThis.IsValid())
+					  {
+						  OnParsed(MoveTemp(Result));
+					  }
+				  });
+	});
+}
+
+void FModioUIPreviewDataLoader::LoadModsFromFakeBackend(FOnModsLoaded OnLoaded)
+{
+	SetStatus(LOCTEXT("GeneratingMods", "Generating synthetic mods..."), true);
+	TWeakPtr<FModioUIPreviewDataLoader> WeakThis = AsShared();
+	GetFakeBackend().ListAllModsAsync(
+		FModioFilterParams(),
+		FOnListAllModsDelegateFast::CreateLambda(
+			[WeakThis, OnLoaded](FModioErrorCode ec, TOptional<FModioModInfoList> ModList) {
+				TSharedPtr<FModioUIPreviewDataLoader> This = WeakThis.Pin();
+				if (!This)
+				{
+					return;
+				}
+				TArray<FModioModInfo> Mods;
+				if (!ec && ModList.IsSet())
+				{
+					Mods = ModList->GetRawList();
+				}
+				This->SetStatus(
+					FText::Format(LOCTEXT("ModsFromFakeBackend", "Generated {0} synthetic mods"), Mods.Num()), false);
+				if (!This->bCancelled)
+				{
+					OnLoaded(MoveTemp(Mods));
+				}
+			}));
+}
+
+void FModioUIPreviewDataLoader::LoadModCollectionsFromFakeBackend(FOnModCollectionsLoaded OnLoaded)
+{
+	SetStatus(LOCTEXT("GeneratingCollections", "Generating synthetic mod collections..."), true);
+	TWeakPtr<FModioUIPreviewDataLoader> WeakThis = AsShared();
+	GetFakeBackend().ListModCollectionsAsync(
+		FModioFilterParams(),
+		FOnListModCollectionsDelegateFast::CreateLambda(
+			[WeakThis, OnLoaded](FModioErrorCode ec, TOptional<FModioModCollectionInfoList> CollectionList) {
+				TSharedPtr<FModioUIPreviewDataLoader> This = WeakThis.Pin();
+				if (!This)
+				{
+					return;
+				}
+				TArray<FModioModCollectionInfo> Collections;
+				if (!ec && CollectionList.IsSet())
+				{
+					Collections = CollectionList->GetRawList();
+				}
+				This->SetStatus(FText::Format(LOCTEXT("CollectionsFromFakeBackend",
+													  "Generated {0} synthetic mod collections"),
+											  Collections.Num()),
+								false);
+				if (!This->bCancelled)
+				{
+					OnLoaded(MoveTemp(Collections));
+				}
+			}));
+}
+
+void FModioUIPreviewDataLoader::LoadUserFromFakeBackend(FOnUserLoaded OnLoaded)
+{
+	// The stand-in backend has no user session, so there is nothing to wait for
+	FModioUser User;
+	User.UserId = FModioUserID(1);
+	User.Username = TEXT("Preview User");
+	SetStatus(LOCTEXT("UserFromFakeBackend", "Generated synthetic user"), false);
+	OnLoaded(MoveTemp(User));
+}
+
+UModioUIFakeDataProvider& FModioUIPreviewDataLoader::GetFakeBackend()
+{
+	if (!FakeBackend.IsValid())
+	{
+		FakeBackend.Reset(NewObject<UModioUIFakeDataProvider>(GetTransientPackage()));
+	}
+	return *FakeBackend;
+}
+
+void FModioUIPreviewDataLoader::RunServiceRequest(const FModioInitializeOptions& InitializeOptions,
+												  TFunction<void()> Request)
+{
+	UModioSubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioSubsystem>();
+	if (!Subsystem)
+	{
+		SetStatus(LOCTEXT("NoSubsystem", "The mod.io subsystem is not available"), false);
+		return;
+	}
+
+	SetStatus(LOCTEXT("Connecting", "Connecting to mod.io..."), true);
+	// Callbacks are only delivered when handlers are pumped; do that from the ticker rather than a blocking loop
+	if (!InitializeOptions.bUseBackgroundThread && !PumpTickHandle.IsValid())
+	{
+		PumpTickHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateSP(this, &FModioUIPreviewDataLoader::PumpServiceHandlers));
+	}
+
+	// Keep ourselves alive until the request finishes so that the SDK is always shut down again
+	TSharedRef<FModioUIPreviewDataLoader> StrongThis = AsShared();
+	Subsystem->InitializeAsync(
+		InitializeOptions, FOnErrorOnlyDelegateFast::CreateLambda([StrongThis, Request](FModioErrorCode ec) {
+			if (!ec)
+			{
+				StrongThis->bRequiresSDKShutdown = true;
+				Request();
+			}
+			else if (UModioErrorConditionLibrary::ErrorCodeMatches(ec, EModioErrorCondition::SDKAlreadyInitialized))
+			{
+				Request();
+			}
+			else
+			{
+				StrongThis->SetStatus(FText::Format(LOCTEXT("ConnectFailed", "Could not connect to mod.io: {0}"),
+													FText::FromString(ec.GetErrorMessage())),
+									  false);
+				StrongThis->FinishServiceRequest();
+			}
+		}));
+}
+
+void FModioUIPreviewDataLoader::FinishServiceRequest()
+{
+	TSharedRef<FModioUIPreviewDataLoader> StrongThis = AsShared();
+	auto StopPumping = [StrongThis]() {
+		if (StrongThis->PumpTickHandle.IsValid())
+		{
+			FTSTicker::GetCoreTicker().RemoveTicker(StrongThis->PumpTickHandle);
+			StrongThis->PumpTickHandle.Reset();
+		}
+	};
+
+	if (!bRequiresSDKShutdown)
+	{
+		StopPumping();
+		return;
+	}
+	bRequiresSDKShutdown = false;
+	GEngine->GetEngineSubsystem<UModioSubsystem>()->ShutdownAsync(
+		FOnErrorOnlyDelegateFast::CreateLambda([StopPumping](FModioErrorCode) { StopPumping(); }));
+}
+
+bool FModioUIPreviewDataLoader::PumpServiceHandlers(float DeltaTime)
+{
+	if (UModioSubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioSubsystem>())
+	{
+		Subsystem->RunPendingHandlers();
+	}
+	return true;
+}
+
+void FModioUIPreviewDataLoader::SetStatus(const FText& InStatusText, bool bInLoading)
+{
+	StatusText = InStatusText;
+	bLoading = bInLoading;
+}
+
+	#undef LOCTEXT_NAMESPACE
+
+#endif
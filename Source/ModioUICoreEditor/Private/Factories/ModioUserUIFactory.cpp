@@ -16,16 +16,11 @@
 	#include "Core/ModioUIHelpers.h"
 	#include "Widgets/DeclarativeSyntaxSupport.h"
 	#include "Widgets/SWindow.h"
-	#include "ModioSubsystem.h"
-	#include "Libraries/ModioErrorConditionLibrary.h"
-	#include "Libraries/ModioSDKLibrary.h"
 	#include "Algo/Transform.h"
 	#include "Widgets/Input/SButton.h"
 	#include "Widgets/Text/STextBlock.h"
 	#include "Widgets/Views/STableRow.h"
 	#include "Widgets/Views/SListView.h"
-	#include "Framework/Notifications/NotificationManager.h"
-	#include "Widgets/Notifications/SNotificationList.h"
 	#include "IStructureDetailsView.h"
 	#include "PropertyEditorModule.h"
 	#include "Framework/Application/SlateApplication.h"
@@ -68,71 +63,13 @@ bool UModioUserUIFactory::DoesSupportClass(UClass* Class)
 
 bool UModioUserUIFactory::ConfigureProperties()
 {
-	bool bOperationInProgress = false;
-	FNotificationInfo Info {FText::FromString("Fetching current authenticated user...")};
-	Info.bUseThrobber = true;
+	bConfirmClicked = false;
+	Loader = MakeShared<FModioUIPreviewDataLoader>();
 
-	TSharedPtr<SNotificationItem> Notification = FSlateNotificationManager::Get().AddNotification(Info);
-	UModioSubsystem* Subsystem = GEngine->GetEngineSubsystem<UModioSubsystem>();
-	FModioInitializeOptions InitOptions =
-		UModioSDKLibrary::GetProjectInitializeOptionsForSessionId("ModioUnrealEditor");
-
-	if (Subsystem)
-	{
-		bOperationInProgress = true;
-		Subsystem->InitializeAsync(
-			InitOptions,
-			FOnErrorOnlyDelegateFast::CreateLambda([this, Subsystem, &bOperationInProgress](FModioErrorCode ec) {
-				if (!ec)
-				{
-					bRequiresSDKShutdown = true;
-					CurrentUser = Subsystem->QueryUserProfile();
-				}
-				else if (UModioErrorConditionLibrary::ErrorCodeMatches(ec, EModioErrorCondition::SDKAlreadyInitialized))
-				{
-					CurrentUser = Subsystem->QueryUserProfile();
-				}
-				bOperationInProgress = false;
-			}));
-
-		while (bOperationInProgress)
-		{
-			if (!InitOptions.bUseBackgroundThread)
-			{
-				Subsystem->RunPendingHandlers();
-			}
-			else
-			{
-				FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
-	#if UE_VERSION_OLDER_THAN(5, 3, 0)
-				FTicker::GetCoreTicker().Tick(FApp::GetDeltaTime());
-	#else
-				FTSTicker::GetCoreTicker().Tick(FApp::GetDeltaTime());
-	#endif
-				FSlateApplication::Get().PumpMessages();
-				FSlateApplication::Get().Tick();
-				FPlatformProcess::Sleep(0);
-			}
-		}
-	}
-	else
-	{
-		return false;
-	}
-
-	Notification->ExpireAndFadeout();
-	Notification.Reset();
-	if (!CurrentUser.IsSet())
-	{
-		CurrentUser = FModioUser {};
-		CurrentUser->UserId = FModioUserID(0);
-		CurrentUser->Username = "Default User";
-	}
-	// Use 4 hours ago as the default 'last seen' date;
-	CurrentUser->DateOnline = FDateTime::Now() - FTimespan::FromHours(4);
+	// The dialog opens straight away with a placeholder user, which is replaced when the data arrives
+	OnUserLoaded({});
 
 	FPropertyEditorModule& PropertyModule = FModuleManager::LoadModuleChecked<FPropertyEditorModule>("PropertyEditor");
-	UserStructWrapper = MakeShared<FStructOnScope>(FModioUser::StaticStruct(), (uint8*) CurrentUser.GetPtrOrNull());
 	FDetailsViewArgs DetailArgs;
 	DetailArgs.bUpdatesFromSelection = false;
 	DetailArgs.bLockable = false;
@@ -141,6 +78,8 @@ bool UModioUserUIFactory::ConfigureProperties()
 	DetailArgs.bCustomFilterAreaLocation = true;
 	DetailArgs.DefaultsOnlyVisibility = EEditDefaultsOnlyNodeVisibility::Show;
 	DetailArgs.bForceHiddenPropertyVisibility = true;
+	UserDetailsView =
+		PropertyModule.CreateStructureDetailView({}, {}, UserStructWrapper, FText::FromString("User Info"));
 
 	// clang-format off
 	SAssignNew(ImportWindow, SWindow)
@@ -154,10 +93,13 @@ bool UModioUserUIFactory::ConfigureProperties()
 		[
 			SNew(SVerticalBox)
 			+ SVerticalBox::Slot()
+			.AutoHeight()
 			[
-				PropertyModule.CreateStructureDetailView(
-						{}, {}, UserStructWrapper,
-						FText::FromString("User Info"))->GetWidget().ToSharedRef()
+				Loader->MakeStatusWidget()
+			]
+			+ SVerticalBox::Slot()
+			[
+				UserDetailsView->GetWidget().ToSharedRef()
 			]
 			+ SVerticalBox::Slot()
 			.AutoHeight()
@@ -179,12 +121,42 @@ bool UModioUserUIFactory::ConfigureProperties()
 		]
 	];
 	// clang-format on
+
+	TWeakObjectPtr<UModioUserUIFactory> WeakThis = this;
+	Loader->LoadUserAsync([WeakThis](TOptional<FModioUser> LoadedUser) {
+		if (WeakThis.IsValid())
+		{
+			WeakThis->OnUserLoaded(MoveTemp(LoadedUser));
+		}
+	});
 	GEditor->EditorAddModalWindow(ImportWindow.ToSharedRef());
 	ImportWindow.Reset();
+	UserDetailsView.Reset();
+	Loader->Cancel();
+	Loader.Reset();
 
 	return bConfirmClicked;
 }
 
+void UModioUserUIFactory::OnUserLoaded(TOptional<FModioUser> LoadedUser)
+{
+	CurrentUser = MoveTemp(LoadedUser);
+	if (!CurrentUser.IsSet())
+	{
+		CurrentUser = FModioUser {};
+		CurrentUser->UserId = FModioUserID(0);
+		CurrentUser->Username = "Default User";
+	}
+	// Use 4 hours ago as the default 'last seen' date;
+	CurrentUser->DateOnline = FDateTime::Now() - FTimespan::FromHours(4);
+
+	UserStructWrapper = MakeShared<FStructOnScope>(FModioUser::StaticStruct(), (uint8*) CurrentUser.GetPtrOrNull());
+	if (UserDetailsView)
+	{
+		UserDetailsView->SetStructureData(UserStructWrapper);
+	}
+}
+
 FReply UModioUserUIFactory::OnConfirmClicked()
 {
 	bConfirmClicked = true;
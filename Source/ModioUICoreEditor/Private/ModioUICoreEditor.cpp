@@ -10,8 +10,19 @@
 #include "Factories/ModioModCollectionInfoUIFactory.h"
 #include "Factories/ModioModProgressInfoUIFactory.h"
 #include "Factories/ModioUserUIFactory.h"
+#include "Factories/ModioUIPreviewDataSettings.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Core/ModioModCollectionInfoUI.h"
+#include "Core/ModioModInfoUI.h"
+#include "Core/ModioUIFakeDataProvider.h"
+#include "Core/ModioUIHelpers.h"
+#include "Core/ModioUserUI.h"
+#include "HAL/IConsoleManager.h"
 #include "IAssetTools.h"
+#include "ISettingsModule.h"
 #include "K2Node_FunctionEntry.h"
+#include "Misc/ScopedSlowTask.h"
+#include "UObject/StrongObjectPtr.h"
 #include "Templates/SharedPointer.h"
 #include "UMGEditorModule.h"
 
@@ -23,6 +34,21 @@ void FModioUICoreEditor::StartupModule()
 {
 	UpdatePackagingSettings();
 
+	if (ISettingsModule* SettingsModule = FModuleManager::GetModulePtr<ISettingsModule>("Settings"))
+	{
+		SettingsModule->RegisterSettings(
+			"Editor", "Plugins", "mod.io UI Preview Data", LOCTEXT("PreviewDataSettingsName", "mod.io UI Preview Data"),
+			LOCTEXT("PreviewDataSettingsDescription",
+					"Configure where the mod.io UI preview data factories fetch their data from."),
+			GetMutableDefault<UModioUIPreviewDataSettings>());
+	}
+
+	ConsoleCommands.Add(IConsoleManager::Get().RegisterConsoleCommand(
+		TEXT("Modio.GeneratePreviewAssets"),
+		TEXT("Creates synthetic preview data assets for stress testing UI layouts. Usage: "
+			 "Modio.GeneratePreviewAssets <ModInfo|ModCollectionInfo|User> [Count] [/Game/Path]"),
+		FConsoleCommandWithArgsDelegate::CreateRaw(this, &FModioUICoreEditor::GeneratePreviewAssets), ECVF_Default));
+
 	// Register custom asset actions for our preview data binding objects
 	IAssetTools& AssetTools = FModuleManager::LoadModuleChecked<FAssetToolsModule>("AssetTools").Get();
 	AssetActions.Add(MakeShared<FModioModInfoUIAssetActions>());
@@ -71,6 +97,17 @@ void FModioUICoreEditor::StartupModule()
 
 void FModioUICoreEditor::ShutdownModule()
 {
+	for (IConsoleCommand* Command : ConsoleCommands)
+	{
+		IConsoleManager::Get().UnregisterConsoleObject(Command);
+	}
+	ConsoleCommands.Empty();
+
+	if (ISettingsModule* SettingsModule = FModuleManager::GetModulePtr<ISettingsModule>("Settings"))
+	{
+		SettingsModule->UnregisterSettings("Editor", "Plugins", "mod.io UI Preview Data");
+	}
+
 	if (AssetActions.Num())
 	{
 		FAssetToolsModule* AssetToolsModule = FModuleManager::GetModulePtr<FAssetToolsModule>("AssetTools");
@@ -137,6 +174,77 @@ bool FModioUICoreEditor::UpdatePackagingSettings() const
 	return true;
 }
 
+void FModioUICoreEditor::GeneratePreviewAssets(const TArray<FString>& Args)
+{
+	const UModioUIPreviewDataSettings* Settings = GetDefault<UModioUIPreviewDataSettings>();
+	const FString Kind = Args.Num() > 0 ? Args[0] : TEXT("ModInfo");
+	const int32 Count = Args.Num() > 1 ? FMath::Max(FCString::Atoi(*Args[1]), 1) : Settings->DefaultBulkAssetCount;
+	const FString BasePath = Args.Num() > 2 ? Args[2] : Settings->DefaultBulkAssetPath;
+
+	UClass* AssetClass = nullptr;
+	if (Kind == TEXT("ModInfo"))
+	{
+		AssetClass = UModioModInfoUI::StaticClass();
+	}
+	else if (Kind == TEXT("ModCollectionInfo"))
+	{
+		AssetClass = UModioModCollectionInfoUI::StaticClass();
+	}
+	else if (Kind == TEXT("User"))
+	{
+		AssetClass = UModioUserUI::StaticClass();
+	}
+	if (!AssetClass || !FPackageName::IsValidLongPackageName(BasePath / TEXT("Asset")))
+	{
+		UE_LOG(ModioUICoreEditor, Error,
+			   TEXT("Usage: Modio.GeneratePreviewAssets <ModInfo|ModCollectionInfo|User> [Count] [/Game/Path]"));
+		return;
+	}
+
+	// Content comes from the stand-in backend's generators so that bulk assets match what the fake backend serves
+	TStrongObjectPtr<UModioUIFakeDataProvider> FakeBackend(NewObject<UModioUIFakeDataProvider>(GetTransientPackage()));
+
+	FScopedSlowTask SlowTask(
+		Count, FText::Format(LOCTEXT("GeneratingPreviewAssets", "Generating {0} preview {1} assets..."), Count,
+							 FText::FromString(Kind)));
+	SlowTask.MakeDialog(true);
+
+	int32 NumCreated = 0;
+	for (int32 Index = 0; Index < Count && !SlowTask.ShouldCancel(); ++Index)
+	{
+		SlowTask.EnterProgressFrame();
+
+		const FString AssetName = FString::Printf(TEXT("Preview%s_%05d"), *Kind, Index);
+		const FString PackageName = BasePath / AssetName;
+		UPackage* Package = CreatePackage(*PackageName);
+		UObject* Asset = NewObject<UObject>(Package, AssetClass, *AssetName, RF_Public | RF_Standalone);
+		if (UModioModInfoUI* ModInfo = Cast<UModioModInfoUI>(Asset))
+		{
+			ModInfo->Underlying = FakeBackend->MakeMod(Index);
+		}
+		else if (UModioModCollectionInfoUI* ModCollectionInfo = Cast<UModioModCollectionInfoUI>(Asset))
+		{
+			ModCollectionInfo->Underlying = FakeBackend->MakeModCollection(Index);
+		}
+		else if (UModioUserUI* User = Cast<UModioUserUI>(Asset))
+		{
+			User->Underlying.UserId = FModioUserID(Index + 1);
+			User->Underlying.Username = FString::Printf(TEXT("Preview User %d"), Index + 1);
+		}
+		FAssetRegistryModule::AssetCreated(Asset);
+
+		const FString FileName =
+			FPackageName::LongPackageNameToFilename(PackageName, FPackageName::GetAssetPackageExtension());
+		if (ModioUIHelpers::SavePackage(Package, Asset, RF_Public | RF_Standalone, *FileName))
+		{
+			++NumCreated;
+		}
+	}
+
+	UE_LOG(ModioUICoreEditor, Log, TEXT("Generated %d of %d preview %s assets under %s"), NumCreated, Count, *Kind,
+		   *BasePath);
+}
+
 #undef LOCTEXT_NAMESPACE
 
 IMPLEMENT_MODULE(FModioUICoreEditor, ModioUICoreEditor)
@@ -0,0 +1,167 @@
+/*
+ *  Copyright (C) 2025 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io UE Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+#include "CoreMinimal.h"
+#include "Types/ModioModInfo.h"
+#include "Types/ModioModTagOptions.h"
+#include "UI/EventHandlers/IModioUIModInfoReceiver.h"
+
+#include "ModioUIBenchmarkCommandlet.generated.h"
+
+/**
+ * @brief Minimal mod info receiver used to measure subsystem broadcast fan-out without any widget overhead
+ */
+UCLASS(Transient)
+class MODIOUICOREEDITOR_API UModioUIBenchmarkReceiver : public UObject, public IModioUIModInfoReceiver
+{
+	GENERATED_BODY()
+
+public:
+	void BeginReceiving();
+	void EndReceiving();
+
+	int32 NumEventsReceived = 0;
+
+protected:
+	//~ Begin IModioUIModInfoReceiver Interface
+	virtual void NativeOnModInfoRequestCompleted(FModioModID ModID, FModioErrorCode ErrorCode,
+	                                             TOptional<FModioModInfo> Info) override;
+	//~ End IModioUIModInfoReceiver Interface
+};
+
+/**
+ * @brief Headless benchmark for the ModioUICore hot paths. Drives the default components with synthetic mod data so
+ * that no mod.io session is required, and writes a JSON report of timings, live UObject counts and memory deltas.
+ *
+ * Usage: UnrealEditor-Cmd <Project> -run=ModioUIBenchmark -nullrhi -unattended [-Iterations=5] [-NumMods=10000]
+ * [-PageSize=100] [-NumReceivers=1000] [-NumRegistrationReceivers=10000] [-NumTagCategories=50]
+ * [-NumTagsPerCategory=100] [-NumCollectionTiles=60]
+ * [-NumTextRebinds=10000] [-NumStoreOpens=20] [-NumSelectorMenus=50] [-Output=<Path.json>]
+ *
+ * Returns a non-zero exit code if the report cannot be written or a consistency check fails.
+ */
+UCLASS()
+class MODIOUICOREEDITOR_API UModioUIBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UModioUIBenchmarkCommandlet();
+
+	//~ Begin UCommandlet Interface
+	virtual int32 Main(const FString& Params) override;
+	//~ End UCommandlet Interface
+
+protected:
+	struct FBenchmarkResult
+	{
+		FString Name;
+		TArray<double> SampleMs;
+		int64 UObjectsAllocated = 0;
+		int64 ProcessMemoryDeltaBytes = 0;
+	};
+
+	/**
+	 * @brief Runs Body the configured number of times, collecting wall time per iteration, and the change in live
+	 * UObjects and in the process's used physical memory over the final iteration. The memory figure is process-wide
+	 * rather than an allocation count, so it is only a rough indicator. Setup runs before each iteration and is not
+	 * timed.
+	 */
+	void RunBenchmark(const FString& Name, TFunctionRef<void()> Setup, TFunctionRef<void()> Body);
+
+	/**
+	 * @brief Assigns NumMods mods to a tile view in one call. Only the wrapping of mods and the item assignment are
+	 * timed: the commandlet runs without a renderer, so the view never ticks and generates no entry widgets
+	 */
+	void BenchmarkTileViewItemAssign();
+
+	/**
+	 * @brief Appends NumMods mods to a tile view PageSize at a time. As with BenchmarkTileViewItemAssign, no entry
+	 * widgets are generated
+	 */
+	void BenchmarkTileViewPaginatedItemAppend();
+	void BenchmarkModBrowserTagFilter();
+
+	/**
+	 * @brief Searches a library of NumMods mods from UModioUIFakeDataProvider by name, as the mod browser's library
+	 * view does, and checks the result against a plain scan of the same mods
+	 */
+	void BenchmarkModBrowserLibrarySearch();
+
+	/**
+	 * @brief Binds the tags of every synthetic mod as a tag display would, and checks that each distinct tag is bound
+	 * to a single shared object
+	 */
+	void BenchmarkModTagBinding();
+	void BenchmarkBroadcastFanOut();
+
+	/**
+	 * @brief Registers and deregisters NumRegistrationReceivers receivers in shuffled order, as recycling list entries
+	 * do, and checks that every registration is removed again
+	 */
+	void BenchmarkReceiverRegistration();
+	void BenchmarkTagSelectorConstruction();
+	void BenchmarkObjectWrapBoxRebuild();
+
+	/**
+	 * @brief Queries the follow state of NumCollectionTiles collections against UModioUIFakeDataProvider, as a
+	 * collection grid does when its tiles bind, and checks that they share a single followed collections request
+	 */
+	void BenchmarkFollowedCollectionQueries();
+
+	/**
+	 * @brief Rebinds a text block with mostly unchanged text, as progress trackers do every tick, and checks that only
+	 * the real changes reach Slate
+	 */
+	void BenchmarkTextBlockRebind();
+
+	/**
+	 * @brief Opens the token pack store NumStoreOpens times against UModioUIFakeDataProvider, and checks that the
+	 * catalogue and wallet balance are fetched once until an entitlement refresh invalidates them
+	 */
+	void BenchmarkStoreCaches();
+
+	/**
+	 * @brief Reopens recently viewed collections against UModioUIFakeDataProvider, and checks that their mods are
+	 * answered from the collection mods cache without further requests
+	 */
+	void BenchmarkCollectionModsReopen();
+
+	/**
+	 * @brief Opens and closes NumSelectorMenus selector menus in turn through ModioUI::FSelectorMenuState, the state the
+	 * selector components keep, and checks that only UModioUISettings::MaxIdleSelectorMenus of them keep their content
+	 * once closed. Filling and emptying a menu is only counted, so this measures the open state and idle budget
+	 * bookkeeping rather than building entry widgets
+	 */
+	void BenchmarkSelectorMenuIdleBudget();
+
+	bool WriteReport(const FString& OutputPath) const;
+
+	TArray<FModioModInfo> SyntheticMods;
+	FModioModTagOptions SyntheticTagOptions;
+	TArray<FBenchmarkResult> Results;
+
+	int32 NumIterations = 5;
+	int32 NumMods = 10000;
+	int32 PageSize = 100;
+	int32 NumReceivers = 1000;
+	int32 NumRegistrationReceivers = 10000;
+	int32 NumTagCategories = 50;
+	int32 NumTagsPerCategory = 100;
+	int32 NumCollectionTiles = 60;
+	int32 NumTextRebinds = 10000;
+	int32 NumStoreOpens = 20;
+	int32 NumSelectorMenus = 50;
+
+	bool bConsistencyCheckFailed = false;
+};
@@ -0,0 +1,59 @@
+/*
+ *  Copyright (C) 2025 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io UE Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+#include "CoreMinimal.h"
+
+#include "ModioUIReplayEventsCommandlet.generated.h"
+
+/**
+ * @brief Replays a UI event recording captured with Modio.RecordUIEvents into UModioUISubsystem headlessly, timing
+ * how long the subsystem and every registered receiver take to handle each event. Repeated runs against the same
+ * recording give a deterministic performance regression test for real session traffic.
+ *
+ * Usage: UnrealEditor-Cmd <Project> -run=ModioUIReplayEvents -nullrhi -unattended -File=<Recording.jsonl>
+ * [-Iterations=5] [-Speed=0] [-Output=<Path.json>]
+ *
+ * A Speed of 0 (the default) dispatches events back to back. Any other value waits between events to match the
+ * recorded timing, scaled by Speed.
+ *
+ * Returns a non-zero exit code if the recording cannot be read, an event cannot be replayed, or the report cannot be
+ * written.
+ */
+UCLASS()
+class MODIOUICOREEDITOR_API UModioUIReplayEventsCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UModioUIReplayEventsCommandlet();
+
+	//~ Begin UCommandlet Interface
+	virtual int32 Main(const FString& Params) override;
+	//~ End UCommandlet Interface
+
+protected:
+	struct FEventTypeResult
+	{
+		int32 NumEvents = 0;
+		double TotalMs = 0.0;
+		double MaxMs = 0.0;
+	};
+
+	bool WriteReport(const FString& OutputPath, const FString& RecordingPath, const TArray<double>& IterationMs) const;
+
+	/** Dispatch timings of the final iteration, by event type */
+	TMap<FString, FEventTypeResult> Results;
+
+	int32 NumIterations = 5;
+	float Speed = 0.0f;
+};
@@ -0,0 +1,87 @@
+/*
+ *  Copyright (C) 2025 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io UE Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+#include "CoreMinimal.h"
+#include "UI/Components/ComponentHelpers.h"
+
+#include "ModioUIValidateComponentsCommandlet.generated.h"
+
+class UWidgetBlueprint;
+
+/**
+ * @brief Headless batch counterpart of UModioUIComponentValidatorWidget. Loads every widget Blueprint under the given
+ * content paths and, for each one built on mod.io UI classes, checks:
+ * - that widgets bound to MustImplement properties implement the interfaces they are required to, as the Blueprint
+ *   compiler does through IMPLEMENT_MODIO_WIDGET_VALIDATION
+ * - that the Blueprint fully implements the component contract (UModioUIComponentStatics::GetAllComponentMetadata) it
+ *   most closely matches. A partially implemented contract is reported as a warning, or an error with -Strict
+ *
+ * Assets are loaded in batches on the game thread and each batch is validated in parallel. Per-asset load and
+ * validation times are recorded in a JSON report.
+ *
+ * Usage: UnrealEditor-Cmd <Project> -run=ModioUIValidateComponents -nullrhi -unattended [-Paths=/Game,/Plugin]
+ * [-BatchSize=256] [-Strict] [-SingleThreaded] [-Output=<Path.json>]
+ *
+ * Returns a non-zero exit code if any asset fails validation or the report cannot be written.
+ */
+UCLASS()
+class MODIOUICOREEDITOR_API UModioUIValidateComponentsCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UModioUIValidateComponentsCommandlet();
+
+	//~ Begin UCommandlet Interface
+	virtual int32 Main(const FString& Params) override;
+	//~ End UCommandlet Interface
+
+protected:
+	struct FAssetResult
+	{
+		FString AssetPath;
+		FString MatchedComponent;
+		double LoadMs = 0.0;
+		double ValidateMs = 0.0;
+		bool bSkipped = false;
+		TArray<FString> Errors;
+		TArray<FString> Warnings;
+	};
+
+	/**
+	 * @brief Checks a loaded Blueprint against its bound widget contracts. Only reads reflection data and the contracts
+	 * passed in, so may run on any thread
+	 * @param BoundWidgetContracts Contracts for the Blueprint's class, resolved on the game thread beforehand
+	 */
+	void ValidateBlueprint(const UWidgetBlueprint& Blueprint,
+						   TArrayView<const FModioBoundWidgetContract> BoundWidgetContracts, FAssetResult& Result) const;
+
+	/**
+	 * @brief Returns whether Blueprint is built on mod.io UI classes and so should be validated
+	 */
+	bool IsModioWidget(const UWidgetBlueprint& Blueprint) const;
+
+	bool WriteReport(const FString& OutputPath, double TotalSeconds) const;
+
+	TArray<FAssetResult> Results;
+
+	/** Interfaces required by each component, resolved on the game thread before validation starts */
+	TArray<TPair<FString, TArray<const UClass*>>> ComponentContracts;
+
+	/** Every interface named by ComponentContracts */
+	TSet<const UClass*> ComponentInterfaces;
+
+	int32 BatchSize = 256;
+	bool bStrict = false;
+	bool bSingleThreaded = false;
+};
@@ -15,6 +15,7 @@
 	#include "Containers/Array.h"
 	#include "CoreMinimal.h"
 	#include "Factories/Factory.h"
+	#include "Factories/ModioUIPreviewDataLoader.h"
 	#include "Misc/Optional.h"
 	#include "Types/ModioErrorCode.h"
 	#include "Types/ModioModCollection.h"
@@ -52,8 +53,7 @@ class UModioModCollectionInfoUIFactory : public UFactory
 {
 	GENERATED_BODY()
 protected:
-	volatile bool bOperationInProgress = true;
-	bool bRequiresSDKShutdown = false;
+	TSharedPtr<FModioUIPreviewDataLoader> Loader;
 	TArray<TSharedPtr<FModioModCollectionInfo>> ModCollectionInfos;
 	TSharedPtr<SWindow> ImportWindow;
 	TSharedPtr<SListView<TSharedPtr<FModioModCollectionInfo>>> AvailableModCollectionInfoList;
@@ -74,7 +74,7 @@ public:
 
 	bool ConfigureProperties() override;
 
-	void OnModCollectionListRetrieved(FModioErrorCode ec, TOptional<FModioModCollectionInfoList> ModCollectionList);
+	void OnModCollectionsLoaded(TArray<FModioModCollectionInfo> LoadedModCollectionInfos);
 	FReply OnConfirmClicked();
 	EVisibility IsListVisible() const;
 	bool IsModCollectionInfoSelected() const;
@@ -19,6 +19,7 @@
 	#include "Types/ModioModInfoList.h"
 	#include "Containers/Array.h"
 	#include "Types/SlateEnums.h"
+	#include "Factories/ModioUIPreviewDataLoader.h"
 
 	#include "Misc/EngineVersionComparison.h"
 	#if UE_VERSION_NEWER_THAN(5, 2, 0)
@@ -56,8 +57,7 @@ class UModioModInfoUIFactory : public UFactory
 {
 	GENERATED_BODY()
 protected:
-	volatile bool bOperationInProgress = true;
-	bool bRequiresSDKShutdown = false;
+	TSharedPtr<FModioUIPreviewDataLoader> Loader;
 	TArray<TSharedPtr<FModioModInfo>> ModInfos;
 	TSharedPtr<SWindow> ImportWindow;
 	TSharedPtr<SListView<TSharedPtr<FModioModInfo>>> AvailableModInfoList;
@@ -78,7 +78,7 @@ public:
 
 	bool ConfigureProperties() override;
 
-	void OnModListRetrieved(FModioErrorCode ec, TOptional<FModioModInfoList> ModList);
+	void OnModsLoaded(TArray<FModioModInfo> LoadedModInfos);
 	FReply OnConfirmClicked();
 	EVisibility IsListVisible() const;
 	bool IsModInfoSelected() const;
@@ -0,0 +1,107 @@
+/*
+ *  Copyright (C) 2025 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io UE Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+#if WITH_EDITOR
+
+	#include "Containers/Ticker.h"
+	#include "CoreMinimal.h"
+	#include "Factories/ModioUIPreviewDataSettings.h"
+	#include "Templates/SharedPointer.h"
+	#include "Types/ModioInitializeOptions.h"
+	#include "Types/ModioModCollection.h"
+	#include "Types/ModioModInfo.h"
+	#include "Types/ModioUser.h"
+	#include "UObject/StrongObjectPtr.h"
+
+class UModioUIFakeDataProvider;
+
+/**
+ * @brief Fetches the data offered by the preview data factories from the source selected in
+ * UModioUIPreviewDataSettings without blocking the editor. Results are delivered on the game thread; fixture files are
+ * read and parsed on a worker thread, and live service requests are pumped from the core ticker, which keeps running
+ * while the factories' modal import dialogs are open.
+ *
+ * Owners call Cancel when they are no longer interested in the result, for example when the import dialog is closed.
+ * A live service request then still runs to completion in the background so that the SDK is shut down afterwards, but
+ * its result is discarded.
+ */
+class MODIOUICOREEDITOR_API FModioUIPreviewDataLoader : public TSharedFromThis<FModioUIPreviewDataLoader>
+{
+public:
+	using FOnModsLoaded = TFunction<void(TArray<FModioModInfo>)>;
+	using FOnModCollectionsLoaded = TFunction<void(TArray<FModioModCollectionInfo>)>;
+	using FOnUserLoaded = TFunction<void(TOptional<FModioUser>)>;
+
+	FModioUIPreviewDataLoader();
+	~FModioUIPreviewDataLoader();
+
+	void LoadModsAsync(FOnModsLoaded OnLoaded);
+	void LoadModCollectionsAsync(FOnModCollectionsLoaded OnLoaded);
+	void LoadUserAsync(FOnUserLoaded OnLoaded);
+
+	/**
+	 * @brief Discards the result of the load in progress
+	 */
+	void Cancel();
+
+	bool IsLoading() const
+	{
+		return bLoading;
+	}
+
+	/**
+	 * @brief Returns a description of the load in progress, or of its outcome, for display next to a progress indicator
+	 */
+	FText GetStatusText() const
+	{
+		return StatusText;
+	}
+
+	/**
+	 * @brief Creates a throbber and status line that track this loader, for the factories' import dialogs
+	 */
+	TSharedRef<class SWidget> MakeStatusWidget();
+
+protected:
+	/**
+	 * @brief Reads and parses the named file from the fixture directory on a worker thread
+	 * @param OnParsed Invoked on the game thread with the parsed fixture, or an empty optional if the file is missing
+	 * or malformed
+	 */
+	template<typename ResultType>
+	void LoadFixtureAsync(const TCHAR* FileName, TFunction<void(TOptional<ResultType>)> OnParsed);
+
+	void LoadModsFromFakeBackend(FOnModsLoaded OnLoaded);
+	void LoadModCollectionsFromFakeBackend(FOnModCollectionsLoaded OnLoaded);
+	void LoadUserFromFakeBackend(FOnUserLoaded OnLoaded);
+
+	UModioUIFakeDataProvider& GetFakeBackend();
+
+	/**
+	 * @brief Initializes the SDK if necessary, then runs Request. Request must eventually call FinishServiceRequest
+	 */
+	void RunServiceRequest(const FModioInitializeOptions& InitializeOptions, TFunction<void()> Request);
+
+	void FinishServiceRequest();
+
+	bool PumpServiceHandlers(float DeltaTime);
+
+	void SetStatus(const FText& InStatusText, bool bInLoading);
+
+	TStrongObjectPtr<UModioUIFakeDataProvider> FakeBackend;
+	FTSTicker::FDelegateHandle PumpTickHandle;
+	FText StatusText;
+	bool bLoading = false;
+	bool bCancelled = false;
+	bool bRequiresSDKShutdown = false;
+};
+
+#endif
@@ -0,0 +1,83 @@
+/*
+ *  Copyright (C) 2025 mod.io Pty Ltd. <https://mod.io>
+ *
+ *  This file is part of the mod.io UE Plugin.
+ *
+ *  Distributed under the MIT License. (See accompanying file LICENSE or
+ *   view online at <https://github.com/modio/modio-ue/blob/main/LICENSE>)
+ *
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineTypes.h"
+#include "Misc/Paths.h"
+#include "UObject/Object.h"
+
+#include "ModioUIPreviewDataSettings.generated.h"
+
+/**
+ * @brief Where the preview data factories fetch the mods, collections and users offered for import
+ */
+UENUM()
+enum class EModioUIPreviewDataSource : uint8
+{
+	/** JSON fixture files in the fixture directory, falling back to the local stand-in backend if a file is missing */
+	Fixtures,
+	/** Synthetic data from UModioUIFakeDataProvider, which needs no network connection */
+	FakeBackend,
+	/** The live mod.io service, using the project's initialization options */
+	ModioService
+};
+
+/**
+ * @brief Per-user settings for the preview data factories (Preview ModioModInfoUI and friends) and for the
+ * Modio.GeneratePreviewAssets console command, which creates large numbers of synthetic preview assets for stress
+ * testing layouts:
+ *
+ * Modio.GeneratePreviewAssets <ModInfo|ModCollectionInfo|User> [Count] [/Game/Path]
+ */
+UCLASS(Config = EditorPerProjectUserSettings)
+class MODIOUICOREEDITOR_API UModioUIPreviewDataSettings : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Where the preview data factories fetch data from. Nothing is ever fetched on the editor thread, so the import
+	 * dialog opens immediately and fills in once the data arrives
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "Preview Data")
+	EModioUIPreviewDataSource Source = EModioUIPreviewDataSource::Fixtures;
+
+	/**
+	 * Directory holding the fixture files: Mods.json and ModCollections.json (arrays of FModioModInfo and
+	 * FModioModCollectionInfo objects) and User.json (a single FModioUser object). Relative paths are resolved against
+	 * the project directory
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "Preview Data",
+			  meta = (EditCondition = "Source == EModioUIPreviewDataSource::Fixtures"))
+	FDirectoryPath FixtureDirectory;
+
+	/**
+	 * Number of synthetic assets Modio.GeneratePreviewAssets creates when no count is given
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "Preview Data|Bulk Generation", meta = (ClampMin = "1"))
+	int32 DefaultBulkAssetCount = 1000;
+
+	/**
+	 * Content path Modio.GeneratePreviewAssets creates assets under when no path is given
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "Preview Data|Bulk Generation")
+	FString DefaultBulkAssetPath = TEXT("/Game/ModioPreviewData");
+
+	/**
+	 * Returns the absolute path of the fixture directory
+	 */
+	FString GetFixtureDirectory() const
+	{
+		const FString Directory = FixtureDirectory.Path.IsEmpty() ? TEXT("ModioPreviewFixtures") : FixtureDirectory.Path;
+		return FPaths::ConvertRelativePathToFull(FPaths::ProjectDir(), Directory);
+	}
+};
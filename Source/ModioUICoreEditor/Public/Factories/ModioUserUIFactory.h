@@ -13,6 +13,7 @@
 
 	#include "CoreMinimal.h"
 	#include "Factories/Factory.h"
+	#include "Factories/ModioUIPreviewDataLoader.h"
 	#include "AssetTypeActions_Base.h"
 	#include "Types/ModioErrorCode.h"
 	#include "Misc/Optional.h"
@@ -68,11 +69,13 @@ public:
 
 protected:
 	FReply OnConfirmClicked();
-	bool bRequiresSDKShutdown;
+	void OnUserLoaded(TOptional<FModioUser> LoadedUser);
+	TSharedPtr<FModioUIPreviewDataLoader> Loader;
 	TOptional<FModioUser> CurrentUser;
 	TSharedPtr<class SWindow> ImportWindow;
 	bool bConfirmClicked;
 	TSharedPtr<FStructOnScope> UserStructWrapper;
+	TSharedPtr<class IStructureDetailsView> UserDetailsView;
 };
 
 #endif
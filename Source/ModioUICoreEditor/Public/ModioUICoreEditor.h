@@ -16,6 +16,13 @@ public:
 protected:
 	bool UpdatePackagingSettings() const;
 
+	/**
+	 * @brief Handler for the Modio.GeneratePreviewAssets console command
+	 */
+	void GeneratePreviewAssets(const TArray<FString>& Args);
+
+	TArray<struct IConsoleCommand*> ConsoleCommands;
+
 	TArray<TSharedPtr<class IAssetTypeActions>> AssetActions;
 	TSharedPtr<class IBlueprintWidgetCustomizationExtender> ModioWidgetCustomizer;
 